@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 using std::array;
 #include <memory>
 using std::string;
@@ -32,6 +33,7 @@ using std::vector;
 
 #include <AliAODEvent.h>
 #include <AliESDEvent.h>
+#include <AliESDRun.h>
 
 #include <AliLog.h>
 
@@ -98,6 +100,10 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fCentEstimators{"V0M","CL0"},
   fCentPercentiles{-1.f},
   fPrimaryVertex{nullptr},
+  fIsAOD{false},
+  fTriggerClassesRun{-0xBADCAFE},
+  fUseTriggerClassMask{false},
+  fTriggerClassMask{0ull,0ull},
   fNewEvent{true},
   fOverrideAutoTriggerMask{false},
   fOverrideAutoPileUpCuts{false},
@@ -143,6 +149,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   const int current_run = ev->GetRunNumber();
   if (current_run != fCurrentRun) {
     fCurrentRun = current_run;
+    fIsAOD = dynamic_cast<AliAODEvent*>(ev);
     if (!fManualMode) {
       ::Info("AliEventCuts::AcceptEvent","Current run (%i) is different from the previous (%i): setting automatically the corresponding event cuts.",current_run,fCurrentRun);
       AutomaticSetup(ev);
@@ -176,14 +183,13 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   /// Use of trigger classes overrides the trigger mask
   /// (i.e. if trigger mask is not fired but we see the trigger class we want we enable the trigger bit)
   /// A special bit is set in this case
-  TString classes = ev->GetFiredTriggerClasses();
   if (fTriggerClasses.empty())
     fFlag |= BIT(kTriggerClasses);
-  for (const std::string& myClass : fTriggerClasses) {
-    if (classes.Contains(myClass.data()) && !myClass.empty()) {
+  else {
+    if (fTriggerClassesRun != fCurrentRun) CompileTriggerClasses(ev);
+    if (IsTriggerClassFired(ev)) {
       fFlag |= BIT(kTrigger);
       fFlag |= BIT(kTriggerClasses);
-      break;
     }
   }
 
@@ -194,7 +200,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   const AliVVertex* vtSPD = ev->GetPrimaryVertexSPD();
   /// On current AODs primary vertex could be from TPC or invalid SPD vertex
   /// The following check should be applied only on AOD.
-  bool goodAODvtx = (dynamic_cast<AliAODEvent*>(ev) ? GoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
+  bool goodAODvtx = (fIsAOD ? GoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
 
   if (vtSPD->GetNContributors() > 0) fFlag |= BIT(kVertexSPD);
   if (vtTrc->GetNContributors() > 1 && isTrackV && goodAODvtx) fFlag |= BIT(kVertexTracks);
@@ -246,8 +252,8 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   int nCluSDDSSD=0;
   for(Int_t iLay=2; iLay<6; iLay++) nCluSDDSSD+=mult->GetNumberOfITSClusters(iLay);
   int nCluTPC=0;
-  if (dynamic_cast<AliAODEvent*>(ev)) nCluTPC=dynamic_cast<AliAODEvent*>(ev)->GetNumberOfTPCClusters();
-  else if (dynamic_cast<AliESDEvent*>(ev)) nCluTPC=dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTPCClusters();
+  if (fIsAOD) nCluTPC=static_cast<AliAODEvent*>(ev)->GetNumberOfTPCClusters();
+  else if (dynamic_cast<AliESDEvent*>(ev)) nCluTPC=static_cast<AliESDEvent*>(ev)->GetNumberOfTPCClusters();
   if(fUseVariablesCorrelationCuts || fTOFvsFB32[0] || fUseStrongVarCorrelationCut ||
      fUseTPCTracklCorrelationCut) ComputeTrackMultiplicity(ev);
   const double its_tpcclus_limit = PolN(double(nCluTPC),fITSvsTPCcluPolCut,2);
@@ -1133,5 +1139,48 @@ void AliEventCuts::SetAcceptedTriggerClasses(TString classes) {
     TObjString* thisClass = static_cast<TObjString*>(classArray->At(iClass));
     fTriggerClasses.push_back(thisClass->GetString().Data());
   }
+  /// Force the compilation of the new trigger classes at the next event
+  fTriggerClassesRun = -0xBADCAFE;
+}
+
+void AliEventCuts::CompileTriggerClasses(AliVEvent *ev) {
+  /// The trigger classes selection matches substrings of the fired trigger classes. In ESDs the
+  /// names of the classes of the run are available, so that the selection can be translated once
+  /// per run into a mask of the (up to 100) classes whose names contain one of the accepted ones.
+  /// AODs only store the string of the fired classes, for them the string search is kept.
+  fTriggerClassesRun = fCurrentRun;
+  fUseTriggerClassMask = false;
+  fTriggerClassMask[0] = fTriggerClassMask[1] = 0ull;
+
+  AliESDEvent* esd = fIsAOD ? nullptr : dynamic_cast<AliESDEvent*>(ev);
+  if (!esd || !esd->GetESDRun()) return;
+
+  /// Classes containing blanks could match across two fired class names in the string search
+  for (const std::string& myClass : fTriggerClasses)
+    if (myClass.find(' ') != std::string::npos) return;
+
+  for (int iClass = 0; iClass < 100; ++iClass) {
+    const char* name = esd->GetESDRun()->GetTriggerClass(iClass);
+    if (!name || !name[0]) continue;
+    for (const std::string& myClass : fTriggerClasses) {
+      if (!myClass.empty() && std::strstr(name, myClass.data())) {
+        fTriggerClassMask[iClass / 50] |= (1ull << (iClass % 50));
+        break;
+      }
+    }
+  }
+  fUseTriggerClassMask = true;
+}
+
+bool AliEventCuts::IsTriggerClassFired(AliVEvent *ev) const {
+  if (fUseTriggerClassMask)
+    return (ev->GetTriggerMask() & fTriggerClassMask[0]) || (ev->GetTriggerMaskNext50() & fTriggerClassMask[1]);
+
+  TString classes = ev->GetFiredTriggerClasses();
+  for (const std::string& myClass : fTriggerClasses) {
+    if (!myClass.empty() && std::strstr(classes.Data(), myClass.data()))
+      return true;
+  }
+  return false;
 }
 
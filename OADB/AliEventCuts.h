@@ -197,6 +197,8 @@ class AliEventCuts : public TList {
     AliEventCuts operator=(const AliEventCuts& copy);
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          CompileTriggerClasses(AliVEvent *ev);
+    bool          IsTriggerClassFired(AliVEvent *ev) const;
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -208,6 +210,12 @@ class AliEventCuts : public TList {
     float         fCentPercentiles[2];            ///< Centrality percentiles
     AliVVertex   *fPrimaryVertex;                 //!<! Primary vertex pointer
 
+    /// Run-cached setup, rebuilt when the run changes
+    bool          fIsAOD;                         //!<! The analysed events are AODs
+    int           fTriggerClassesRun;             //!<! Run for which the trigger classes were compiled
+    bool          fUseTriggerClassMask;           //!<! The trigger classes selection can be evaluated on the trigger class mask
+    ULong64_t     fTriggerClassMask[2];           //!<! Mask of the accepted trigger classes (first and next 50 classes)
+
     ///
     bool          fNewEvent;                      ///<  True if the AliVEvent identifier in the AcceptEvent and fIdentifier are different
     /// Overrides
@@ -245,7 +253,7 @@ class AliEventCuts : public TList {
     AliESDtrackCuts* fFB32trackCuts; //!<! Cuts corresponding to FB32 in the ESD (used only for correlations cuts in ESDs)
     AliESDtrackCuts* fTPConlyCuts;   //!<! Cuts corresponding to the standalone TPC cuts in the ESDs (used only for correlations cuts in ESDs)
 
-    ClassDef(AliEventCuts, 16)
+    ClassDef(AliEventCuts, 17)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
@@ -19,6 +19,7 @@
 #include <TObjString.h>
 #include <TClonesArray.h>
 #include <TList.h>
+#include <TArrayC.h>
 #include <TH1F.h>
 //#include <TObjectTable.h>
 #include <TGeoGlobalMagField.h>
@@ -51,6 +52,7 @@ AliAnaCaloTrackCorrMaker::AliAnaCaloTrackCorrMaker() :
 TObject(),
 fReader(0),                   fCaloUtils(0),
 fOutputContainer(new TList ), fAnalysisContainer(new TList ),
+fAnalysisOrder(),
 fProcessEvent(1),
 fMakeHisto(kFALSE),           fMakeAOD(kFALSE),
 fAnaDebug(0),                 fCuts(new TList),
@@ -110,6 +112,7 @@ TObject(),
 fReader(),   //(new AliCaloTrackReader(*maker.fReader)),
 fCaloUtils(),//(new AliCalorimeterUtils(*maker.fCaloUtils)),
 fOutputContainer(new TList()), fAnalysisContainer(new TList()),
+fAnalysisOrder(),
 fProcessEvent(maker.fProcessEvent),
 fMakeHisto(maker.fMakeHisto),  fMakeAOD(maker.fMakeAOD),
 fAnaDebug(maker.fAnaDebug),    fCuts(new TList()),
@@ -1138,6 +1141,113 @@ void AliAnaCaloTrackCorrMaker::Init()
 
   } // Loop on analysis defined
 
+  SetAnalysisOrder();
+}
+
+//_____________________________________________________________________
+/// Set the execution order of the analysis from their AOD branches,
+/// called in Init().
+/// An analysis producing an AOD branch (NewOutputAOD()) must be executed
+/// before the analysis taking it as input, otherwise the input branch is
+/// still empty in the event. Analysis sharing an AOD branch otherwise keep
+/// the configured order, since some modify the input branch particles 
+/// (isolation tag for example) used later by others.
+/// The configured order is kept unless an analysis is configured before
+/// the producer of its input branch. Only then the analysis are reordered,
+/// taking among the allowed orders the closest to the configured one.
+//_____________________________________________________________________
+void AliAnaCaloTrackCorrMaker::SetAnalysisOrder()
+{
+  Int_t nana = fAnalysisContainer->GetEntries() ;
+  
+  fAnalysisOrder.Set(nana);
+  
+  // Dependency matrix, after[i*nana+j] = 1 if analysis i must be executed after analysis j
+  TArrayC after(nana*nana);
+  TArrayI nBefore(nana);
+  
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    AliAnaCaloTrackCorrBaseClass * anai = (AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana) ;
+    
+    for(Int_t jana = 0; jana < iana; jana++)
+    {
+      AliAnaCaloTrackCorrBaseClass * anaj = (AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(jana) ;
+      
+      Bool_t jProducesI = anaj->NewOutputAOD() && anaj->GetOutputAODName() == anai->GetInputAODName();
+      Bool_t iProducesJ = anai->NewOutputAOD() && anai->GetOutputAODName() == anaj->GetInputAODName();
+      
+      Bool_t shared = ( anai->GetInputAODName() == anaj->GetInputAODName() );
+      if ( anai->NewOutputAOD() && anai->GetOutputAODName() == anaj->GetOutputAODName() && anaj->NewOutputAOD() ) 
+        shared = kTRUE;
+      
+      if      ( iProducesJ && !jProducesI ) after[jana*nana+iana] = 1;
+      else if ( jProducesI || shared      ) after[iana*nana+jana] = 1;
+    }
+  }
+  
+  // Keep the configured order if no analysis depends on one configured later
+  Bool_t violated = kFALSE;
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    for(Int_t jana = iana+1; jana < nana; jana++)
+    {
+      if ( !after[iana*nana+jana] ) continue;
+      
+      violated = kTRUE;
+      AliAnaCaloTrackCorrBaseClass * anai = (AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana) ;
+      AliAnaCaloTrackCorrBaseClass * anaj = (AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(jana) ;
+      AliWarning(Form("Analysis %s at position %d reads AOD branch <%s>, produced by %s configured later at position %d",
+                      anai->GetName(),iana,anai->GetInputAODName().Data(),anaj->GetName(),jana));
+    }
+  }
+  
+  if ( !violated )
+  {
+    for(Int_t iana = 0; iana < nana; iana++) fAnalysisOrder[iana] = iana;
+    return;
+  }
+  
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    for(Int_t jana = 0; jana < nana; jana++)
+      nBefore[iana] += after[iana*nana+jana];
+  }
+  
+  // Take each time the first analysis in the configured order with all the
+  // analysis it depends on already executed
+  TArrayC done(nana);
+  Bool_t  reordered = kFALSE;
+  for(Int_t iorder = 0; iorder < nana; iorder++)
+  {
+    Int_t next = -1;
+    for(Int_t iana = 0; iana < nana; iana++)
+    {
+      if ( !done[iana] && nBefore[iana] == 0 ) { next = iana; break; }
+    }
+    
+    if ( next < 0 )
+      AliFatal("Circular dependency of the analysis AOD branches, check the input/output AOD names");
+    
+    fAnalysisOrder[iorder] = next;
+    done[next] = 1;
+    if ( next != iorder ) reordered = kTRUE;
+    
+    for(Int_t iana = 0; iana < nana; iana++)
+    {
+      if ( after[iana*nana+next] ) nBefore[iana]--;
+    }
+  }
+  
+  if ( reordered )
+  {
+    AliWarning("Analysis order changed so that the AOD branch producers above are executed before their users:");
+    for(Int_t iorder = 0; iorder < nana; iorder++)
+    {
+      TObject * ana = fAnalysisContainer->At(fAnalysisOrder[iorder]);
+      AliWarning(Form("\t %d: %s, configured position %d",iorder,ana->GetName(),fAnalysisOrder[iorder]));
+    }
+  }
 }
 
 //_____________________________________________
@@ -1278,10 +1388,13 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   
   AliDebug(1,"*** Begin analysis ***");
   
+  // Execute in the order set in Init(), producers of AOD branches first
   Int_t nana = fAnalysisContainer->GetEntries() ;
-  for(Int_t iana = 0; iana <  nana; iana++)
+  if ( fAnalysisOrder.GetSize() != nana ) SetAnalysisOrder();
+  
+  for(Int_t iorder = 0; iorder <  nana; iorder++)
   {
-    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(fAnalysisOrder[iorder])) ;
     
     ana->ConnectInputOutputAODBranches(); // Sets branches for each analysis
     
@@ -26,6 +26,7 @@
 class TList; 
 class TClonesArray;
 #include<TObject.h>
+#include<TArrayI.h>
 class TH1F;
 
 // --- Analysis system ---
@@ -102,6 +103,10 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   
   void    InitParameters();
   
+  void    SetAnalysisOrder();
+  
+  const TArrayI & GetAnalysisOrder()  const { return fAnalysisOrder     ; }
+  
   void    Print(const Option_t * opt) const;
   
   void    ProcessEvent(Int_t iEntry, const char * currentFileName) ;
@@ -119,6 +124,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   TList *  fOutputContainer ;                        //!<! Output histograms container.
     
   TList *  fAnalysisContainer ;                      ///<  List with analysis pointers.
+  
+  TArrayI  fAnalysisOrder ;                          //!<! Execution order of the analysis in fAnalysisContainer, set in Init(), AOD branch producers before their users.
     
   Bool_t   fProcessEvent ;                           ///< In case of automatic wagon configuration, do not process analysis, but init stuff expected by manager
   
@@ -221,7 +228,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,28) ;
   /// \endcond
 
 } ;
@@ -0,0 +1,225 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- Standard library ---
+#include <algorithm>
+
+// --- AliRoot system ---
+#include "AliLog.h"
+
+#include "AliCaloTrackEtaPhiGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackEtaPhiGrid) ;
+/// \endcond
+
+//______________________________________________________________________________
+/// Default constructor, cells of 0.1 in eta within |eta| < 1 and 64 cells in phi.
+//______________________________________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid() :
+TObject(),
+fNEta(0), fNPhi(0), fEtaMin(0), fEtaMax(0), fEtaStep(0), fPhiStep(0),
+fFilled(kFALSE),
+fPt(), fEta(), fPhi(), fCell(),
+fCellStart(), fCellParticles(),
+fNearCone()
+{
+  SetBinning(20, -1., 1., 64);
+}
+
+//______________________________________________________________________________
+/// Constructor.
+/// \param nEta: number of eta cells in [etaMin, etaMax[.
+/// \param etaMin: lower eta limit of the grid.
+/// \param etaMax: upper eta limit of the grid.
+/// \param nPhi: number of phi cells in [0,2pi[.
+//______________________________________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi) :
+TObject(),
+fNEta(0), fNPhi(0), fEtaMin(0), fEtaMax(0), fEtaStep(0), fPhiStep(0),
+fFilled(kFALSE),
+fPt(), fEta(), fPhi(), fCell(),
+fCellStart(), fCellParticles(),
+fNearCone()
+{
+  SetBinning(nEta, etaMin, etaMax, nPhi);
+}
+
+//______________________________________________________________________________
+/// Set the cell binning, the grid content is cleared.
+//______________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi)
+{
+  if ( nEta < 1 || nPhi < 1 || etaMax <= etaMin )
+  {
+    AliError(Form("Wrong binning: nEta %d, eta [%2.2f,%2.2f], nPhi %d, keep previous",nEta,etaMin,etaMax,nPhi));
+    return;
+  }
+
+  fNEta    = nEta;
+  fNPhi    = nPhi;
+  fEtaMin  = etaMin;
+  fEtaMax  = etaMax;
+  fEtaStep = (etaMax-etaMin)/nEta;
+  fPhiStep = TMath::TwoPi()/nPhi;
+
+  Clear();
+}
+
+//______________________________________________________________________________
+/// Remove all particles, to be called at the beginning of each event.
+//______________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Clear(Option_t * /*opt*/)
+{
+  fFilled = kFALSE;
+
+  fPt  .clear();
+  fEta .clear();
+  fPhi .clear();
+  fCell.clear();
+
+  fCellParticles.clear();
+}
+
+//______________________________________________________________________________
+/// Add a particle, in the order of the list it comes from.
+/// \param pt: transverse momentum.
+/// \param eta: pseudorapidity.
+/// \param phi: azimuthal angle, shifted to [0,2pi[ here if needed.
+//______________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::AddParticle(Float_t pt, Float_t eta, Float_t phi)
+{
+  if ( phi < 0 ) phi += TMath::TwoPi();
+
+  fPt  .push_back(pt);
+  fEta .push_back(eta);
+  fPhi .push_back(phi);
+  fCell.push_back(GetEtaCell(eta)*fNPhi+GetPhiCell(phi));
+}
+
+//______________________________________________________________________________
+/// Sort the added particles by cell.
+/// Counting sort, the particles of a cell stay in list order.
+//______________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Build()
+{
+  Int_t nCells = (fNEta+2)*fNPhi;
+
+  fCellStart.assign(nCells+1, 0);
+
+  Int_t nParticles = GetNParticles();
+  for(Int_t i = 0; i < nParticles; i++)
+    fCellStart[fCell[i]+1]++;
+
+  for(Int_t icell = 0; icell < nCells; icell++)
+    fCellStart[icell+1] += fCellStart[icell];
+
+  fCellParticles.resize(nParticles);
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end()-1);
+  for(Int_t i = 0; i < nParticles; i++)
+    fCellParticles[next[fCell[i]]++] = i;
+
+  fFilled = kTRUE;
+}
+
+//______________________________________________________________________________
+/// \return eta cell index, 0 for underflow, fNEta+1 for overflow.
+//______________________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::GetEtaCell(Float_t eta) const
+{
+  if ( eta <  fEtaMin ) return 0;
+  if ( eta >= fEtaMax ) return fNEta+1;
+
+  Int_t ieta = 1 + Int_t((eta-fEtaMin)/fEtaStep);
+  if ( ieta > fNEta ) ieta = fNEta;
+
+  return ieta;
+}
+
+//______________________________________________________________________________
+/// \return phi cell index for phi in [0,2pi[.
+//______________________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::GetPhiCell(Float_t phi) const
+{
+  Int_t iphi = Int_t(phi/fPhiStep);
+
+  if ( iphi <  0     ) iphi = 0;
+  if ( iphi >= fNPhi ) iphi = fNPhi-1;
+
+  return iphi;
+}
+
+//______________________________________________________________________________
+/// Get the cells touched by the bounding box of a cone.
+/// The phi range is not wrapped, phiLast can be larger than fNPhi-1
+/// and phiFirst negative, use the index modulo fNPhi.
+/// The cone radius is enlarged by a small margin so that rounding in the
+/// caller's distance calculation cannot miss a particle at the cell border.
+//______________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::GetCellRange(Float_t eta, Float_t phi, Float_t r,
+                                          Int_t & etaFirst, Int_t & etaLast,
+                                          Int_t & phiFirst, Int_t & phiLast) const
+{
+  Float_t rr = r + 1.e-4;
+
+  etaFirst = GetEtaCell(eta-rr);
+  etaLast  = GetEtaCell(eta+rr);
+
+  if ( phi < 0 ) phi += TMath::TwoPi();
+
+  phiFirst = TMath::FloorNint((phi-rr)/fPhiStep);
+  phiLast  = TMath::FloorNint((phi+rr)/fPhiStep);
+
+  if ( phiLast-phiFirst+1 >= fNPhi )
+  {
+    phiFirst = 0;
+    phiLast  = fNPhi-1;
+  }
+}
+
+//______________________________________________________________________________
+/// Get the particles in the cells touched by a cone, the distance to the cone axis
+/// is not checked. The indices are sorted, so that the particles are visited in the
+/// same order as in a loop over the full list.
+/// \param eta: cone axis pseudorapidity.
+/// \param phi: cone axis azimuthal angle.
+/// \param r: cone size.
+/// \return indices of the particles in the original list, valid until the next call.
+//______________________________________________________________________________
+const std::vector<Int_t> & AliCaloTrackEtaPhiGrid::GetParticlesNearCone(Float_t eta, Float_t phi, Float_t r)
+{
+  fNearCone.clear();
+
+  Int_t etaFirst = 0, etaLast = 0, phiFirst = 0, phiLast = 0;
+  GetCellRange(eta, phi, r, etaFirst, etaLast, phiFirst, phiLast);
+
+  for(Int_t ieta = etaFirst; ieta <= etaLast; ieta++)
+  {
+    for(Int_t jphi = phiFirst; jphi <= phiLast; jphi++)
+    {
+      Int_t icell = ieta*fNPhi + ((jphi % fNPhi) + fNPhi) % fNPhi;
+
+      for(Int_t ipos = fCellStart[icell]; ipos < fCellStart[icell+1]; ipos++)
+        fNearCone.push_back(fCellParticles[ipos]);
+    }
+  }
+
+  std::sort(fNearCone.begin(), fNearCone.end());
+
+  return fNearCone;
+}
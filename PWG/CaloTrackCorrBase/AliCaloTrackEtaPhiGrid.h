@@ -0,0 +1,101 @@
+#ifndef ALICALOTRACKETAPHIGRID_H
+#define ALICALOTRACKETAPHIGRID_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiGrid
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Per event eta-phi cell grid of the selected tracks or clusters
+///
+///  The kinematics (pT, eta, phi in [0,2pi[) of the particles of one of the reader
+///  lists (CTS, EMCal or PHOS) are stored once per event, in the order of the list,
+///  and the particles are sorted by eta-phi cell.
+///
+///  A region query, GetParticlesNearCone(), returns only the particles of the cells
+///  touched by the bounding box of the cone, in list order, the caller does the exact
+///  distance check for them.
+///
+///  Eta outside the grid range goes to one underflow and one overflow eta cell,
+///  which are never considered fully inside a cone. Phi is periodic.
+///
+///  The grids are filled by AliCaloTrackReader, see AliCaloTrackReader::GetEtaPhiGrid(),
+///  and used in AliIsolationCut.
+///
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+
+class AliCaloTrackEtaPhiGrid : public TObject {
+
+ public:
+
+  AliCaloTrackEtaPhiGrid();
+  AliCaloTrackEtaPhiGrid(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi);
+
+  /// Destructor, nothing to do.
+  virtual ~AliCaloTrackEtaPhiGrid() { ; }
+
+  void            SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi);
+
+  virtual void    Clear(Option_t * opt = "");
+
+  void            AddParticle(Float_t pt, Float_t eta, Float_t phi);
+
+  void            Build();
+
+  Bool_t          IsFilled()                   const { return fFilled               ; }
+
+  Int_t           GetNParticles()              const { return fPt.size()            ; }
+
+  Float_t         GetPt (Int_t i)              const { return fPt [i]               ; }
+
+  Float_t         GetEta(Int_t i)              const { return fEta[i]               ; }
+
+  Float_t         GetPhi(Int_t i)              const { return fPhi[i]               ; }
+
+  const std::vector<Int_t> & GetParticlesNearCone(Float_t eta, Float_t phi, Float_t r) ;
+
+ private:
+
+  Int_t           GetEtaCell(Float_t eta)      const ;
+
+  Int_t           GetPhiCell(Float_t phi)      const ;
+
+  void            GetCellRange(Float_t eta, Float_t phi, Float_t r,
+                               Int_t & etaFirst, Int_t & etaLast,
+                               Int_t & phiFirst, Int_t & phiLast) const ;
+
+  Int_t           fNEta;                   ///<  Number of eta cells, without under/overflow.
+  Int_t           fNPhi;                   ///<  Number of phi cells in [0,2pi[.
+  Float_t         fEtaMin;                 ///<  Lower eta edge of the grid.
+  Float_t         fEtaMax;                 ///<  Upper eta edge of the grid.
+  Float_t         fEtaStep;                ///<  Eta cell size.
+  Float_t         fPhiStep;                ///<  Phi cell size.
+
+  Bool_t          fFilled;                 //!<! Grid is built for the current event.
+
+  std::vector<Float_t> fPt;                //!<! Particle pT, in list order.
+  std::vector<Float_t> fEta;               //!<! Particle eta, in list order.
+  std::vector<Float_t> fPhi;               //!<! Particle phi in [0,2pi[, in list order.
+  std::vector<Int_t>   fCell;              //!<! Cell of each particle.
+
+  std::vector<Int_t>   fCellStart;         //!<! First position of each cell in fCellParticles, one more entry than cells.
+  std::vector<Int_t>   fCellParticles;     //!<! Particle indices sorted by cell.
+
+  std::vector<Int_t>   fNearCone;          //!<! Output buffer of GetParticlesNearCone().
+
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiGrid(              const AliCaloTrackEtaPhiGrid & g) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiGrid & operator = (const AliCaloTrackEtaPhiGrid & g) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackEtaPhiGrid,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKETAPHIGRID_H
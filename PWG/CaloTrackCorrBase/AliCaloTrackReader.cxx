@@ -18,6 +18,7 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -47,6 +48,7 @@
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliMCAnalysisUtils.h"
 
 // ---- Jets ----
@@ -196,6 +198,7 @@ fRejectPileUpMCParticle(0)
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPtCen   [i]= 0x0 ;
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPtCenSignal[i]= 0x0 ;
   for(Int_t j = 0; j < 5; j++) { fMCGenerToAccept    [j] =  ""; fMCGenerIndexToAccept[j] = -1; }
+  for(Int_t i = 0; i < 3; i++) fEtaPhiGrid[i] = 0x0 ;
   for(Int_t j = 0; j < 4; j++) { fhSpherocityMinPtCut[j] = 0  ; fhSpherocityCenMinPtCut[j] = 0 ; fSpherocityPtCut[j] = -10 ;}
   
   InitParameters();
@@ -216,6 +219,8 @@ AliCaloTrackReader::~AliCaloTrackReader()
 void AliCaloTrackReader::DeletePointers()
 {  
   delete fFiducialCut ;
+
+  for(Int_t i = 0; i < 3; i++) delete fEtaPhiGrid[i] ;
 	
   if(fAODBranchList)
   {
@@ -4725,6 +4730,60 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
   //printf("AliCaloTrackReader::RemapMCLabelForAODs() - Label not found set to -1 \n");
 }
 
+//___________________________________________________________________________
+/// Get the eta-phi grid of the selected tracks or clusters of the event, 
+/// filled from the corresponding list on first request in the event.
+/// The particles are added in the list order, so that the grid index is
+/// the list index.
+/// \param detector: AliFiducialCut::kCTS, kEMCAL or kPHOS.
+/// \return the grid, 0 if not available: other detectors or, for clusters, 
+/// mixed events since the cluster kinematics depend on the event vertex. 
+//___________________________________________________________________________
+AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetEtaPhiGrid(Int_t detector)
+{
+  TObjArray * list = 0x0;
+  if      ( detector == AliFiducialCut::kCTS   ) list = fCTSTracks;
+  else if ( detector == AliFiducialCut::kEMCAL ) list = fEMCALClusters;
+  else if ( detector == AliFiducialCut::kPHOS  ) list = fPHOSClusters;
+  
+  if ( !list ) return 0x0;
+  
+  if ( detector != AliFiducialCut::kCTS && fMixedEvent ) return 0x0;
+  
+  if ( !fEtaPhiGrid[detector] ) fEtaPhiGrid[detector] = new AliCaloTrackEtaPhiGrid();
+  
+  AliCaloTrackEtaPhiGrid * grid = fEtaPhiGrid[detector];
+  
+  if ( grid->IsFilled() && grid->GetNParticles() == list->GetEntriesFast() ) return grid;
+  
+  grid->Clear();
+  
+  TVector3 trackMom;
+  for(Int_t i = 0; i < list->GetEntriesFast(); i++)
+  {
+    if ( detector == AliFiducialCut::kCTS )
+    {
+      AliVTrack * track = dynamic_cast<AliVTrack*>(list->At(i));
+      if ( !track ) { grid->AddParticle(0, 1e6, 0); continue; } // far away, never in a cone
+      
+      trackMom.SetXYZ(track->Px(),track->Py(),track->Pz());
+      grid->AddParticle(trackMom.Pt(), trackMom.Eta(), trackMom.Phi());
+    }
+    else
+    {
+      AliVCluster * calo = dynamic_cast<AliVCluster*>(list->At(i));
+      if ( !calo ) { grid->AddParticle(0, 1e6, 0); continue; } // far away, never in a cone
+      
+      calo->GetMomentum(fMomentum, fVertex[0]);
+      grid->AddParticle(fMomentum.Pt(), fMomentum.Eta(), fMomentum.Phi());
+    }
+  }
+  
+  grid->Build();
+  
+  return grid;
+}
+
 //___________________________________
 /// Reset lists, called in AliAnaCaloTrackCorrMaker.
 //___________________________________
@@ -4733,6 +4792,11 @@ void AliCaloTrackReader::ResetLists()
   if(fCTSTracks)       fCTSTracks     -> Clear();
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
+
+  for(Int_t i = 0; i < 3; i++) 
+  {
+    if(fEtaPhiGrid[i]) fEtaPhiGrid[i] -> Clear();
+  }
   
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
@@ -48,6 +48,7 @@ class AliESDtrackCuts;
 //class AliTriggerAnalysis;
 class AliEventplane;
 class AliVCluster;
+class AliCaloTrackEtaPhiGrid;
 #include "AliLog.h"
 #include "AliEventCuts.h"
 //#include "AliAnalysisTaskEmcalEmbeddingHelper.h"
@@ -350,6 +351,8 @@ public:
   virtual TObjArray*     GetPHOSClusters()           const { return fPHOSClusters           ; }
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
+
+  AliCaloTrackEtaPhiGrid * GetEtaPhiGrid(Int_t detector) ;
   
   //-------------------------------------
   // Event/track selection methods
@@ -1294,6 +1297,8 @@ public:
 
   Bool_t           fRejectPileUpMCParticle ;       ///< Reject injected Pile-up MC particles
 
+  AliCaloTrackEtaPhiGrid * fEtaPhiGrid[3];         //!<! Eta-phi grid of the EMCal clusters, PHOS clusters and CTS tracks, index AliFiducialCut::detector, built on first request in the event.
+
   /// Copy constructor not implemented.
   AliCaloTrackReader(              const AliCaloTrackReader & r) ; 
   
@@ -1301,7 +1306,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,97) ;
+  ClassDef(AliCaloTrackReader,98) ;
   /// \endcond
 
 } ;
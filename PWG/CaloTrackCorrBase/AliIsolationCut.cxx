@@ -30,6 +30,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -56,6 +57,7 @@ fPtFraction(0.),     fICMethod(0),                  fPartInCone(0),
 fFracIsThresh(1),    fIsTMClusterInConeRejected(1), fDistMinToTrigger(-1.),
 fUseLeadingPtUEFactor(0), fLeadingPtUEFactor(10000),
 fUseMaxPtUE(0),      fMaxPtUE(1000),
+fUseEtaPhiGrid(0),
 fJetRhoTaskName(""),
 fDebug(0),           fMomentum(),                   fTrackVector(),
 fEMCEtaSize(-1),     fEMCPhiMin(-1),                fEMCPhiMax(-1),
@@ -262,13 +264,25 @@ void AliIsolationCut::CalculateCaloSignalInCone
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
   
+  // Eta-phi grid of the reader clusters, not for mixed or referenced clusters
+  //
+  AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( fUseEtaPhiGrid && !bgCls && !useRefs )
+    grid = reader->GetEtaPhiGrid(calorimeter);
+  
+  const std::vector<Int_t> * nearCone = 0x0;
+  if ( grid ) nearCone = &(grid->GetParticlesNearCone(etaC, phiC, fConeSize));
+  
   //
   // Get the clusters in the cone
   //
   //printf("Loop calo\n");
 
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  Int_t nInConeLoop = nearCone ? (Int_t) nearCone->size() : plNe->GetEntries();
+  for(Int_t icand = 0; icand < nInConeLoop; icand++ )
   {
+    Int_t ipr = nearCone ? (*nearCone)[icand] : icand;
+    
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
     
     if ( calo )
@@ -292,12 +306,21 @@ void AliIsolationCut::CalculateCaloSignalInCone
         if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
       }
       
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-      
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
+      if ( grid )
+      {
+        pt  = grid->GetPt (ipr);
+        eta = grid->GetEta(ipr);
+        phi = grid->GetPhi(ipr);
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+        
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -440,6 +463,8 @@ void AliIsolationCut::CalculateCaloSignalInCone
 
   //
   // Get the UE clusters out of the cone
+  // All clusters are visited, not only the grid cells: the eta-phi histograms take all of
+  // them and the band sums depend on the cluster selection and on the leading cone pT
   //
 
   for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
@@ -467,12 +492,21 @@ void AliIsolationCut::CalculateCaloSignalInCone
         if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
       }
 
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      if ( grid )
+      {
+        pt  = grid->GetPt (ipr);
+        eta = grid->GetEta(ipr);
+        phi = grid->GetPhi(ipr);
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
 
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -756,12 +790,24 @@ void AliIsolationCut::CalculateTrackSignalInCone
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
 
+  // Eta-phi grid of the reader tracks, not for mixed or referenced tracks
+  //
+  AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( fUseEtaPhiGrid && !bgTrk && !useRefs )
+    grid = reader->GetEtaPhiGrid(AliFiducialCut::kCTS);
+
+  const std::vector<Int_t> * nearCone = 0x0;
+  if ( grid ) nearCone = &(grid->GetParticlesNearCone(etaTrig, phiTrig, fConeSize));
+
   //-----------------------------------------------------------
   // Get the tracks in cone
   //-----------------------------------------------------------
 
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  Int_t nInConeLoop = nearCone ? (Int_t) nearCone->size() : plCTS->GetEntries();
+  for(Int_t icand = 0; icand < nInConeLoop; icand++ )
   {
+    Int_t ipr = nearCone ? (*nearCone)[icand] : icand;
+
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
 
     if ( track )
@@ -782,10 +828,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( grid )
+      {
+        ptTrack  = grid->GetPt (ipr);
+        etaTrack = grid->GetEta(ipr);
+        phiTrack = grid->GetPhi(ipr);
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -917,6 +972,8 @@ void AliIsolationCut::CalculateTrackSignalInCone
 
   //-----------------------------------------------------------
   // Select the UE tracks
+  // All tracks are visited, not only the grid cells: the eta-phi histograms take all of
+  // them and the band and perpendicular cone sums depend on the leading cone pT
   //-----------------------------------------------------------
 
   for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
@@ -941,10 +998,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( grid )
+      {
+        ptTrack  = grid->GetPt (ipr);
+        etaTrack = grid->GetEta(ipr);
+        phiTrack = grid->GetPhi(ipr);
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -4015,6 +4081,7 @@ void AliIsolationCut::InitParameters()
   fDistMinToTrigger     = -1.; // no effect
   fLeadingPtUEFactor    = 1.8;
   fMaxPtUE              = 3.0;
+  fUseEtaPhiGrid        = kTRUE;
   fJetRhoTaskName       = "Rho";
 
   // Ratio charged to neutral
@@ -5084,6 +5151,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   printf("minimum distance to candidate, R>%1.2f\n",fDistMinToTrigger);
   printf("leading pT UE factor = %1.2f, UE pt < %2.1f\n",fLeadingPtUEFactor,fMaxPtUE);
   printf("correct cone excess = %d \n",fMakeConeExcessCorr);
+  printf("use eta-phi grid = %d \n",fUseEtaPhiGrid);
   printf("NeutralOverChargedRatio param={%1.2e,%1.2e,%1.2e,%1.2e} \n",
   fNeutralOverChargedRatio[0],fNeutralOverChargedRatio[1],fNeutralOverChargedRatio[2],fNeutralOverChargedRatio[3]) ;
   printf("    \n") ;
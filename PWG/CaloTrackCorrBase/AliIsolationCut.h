@@ -225,6 +225,9 @@ class AliIsolationCut : public TObject {
   void       SwitchOnUseLeadingPtUEFactorCut ()                { fUseLeadingPtUEFactor = kTRUE  ; }
   void       SwitchOffUseLeadingPtUEFactorCut()                { fUseLeadingPtUEFactor = kFALSE ; }
 
+  void       SwitchOnEtaPhiGrid ()                             { fUseEtaPhiGrid = kTRUE  ; }
+  void       SwitchOffEtaPhiGrid()                             { fUseEtaPhiGrid = kFALSE ; }
+
  private:
 
   Bool_t     fFillHistograms;                          ///< Fill histograms if GetCreateOuputObjects() was called. 
@@ -275,6 +278,8 @@ class AliIsolationCut : public TObject {
   Bool_t     fUseMaxPtUE;                              ///< Use maximum pT cut in UE region
   Float_t    fMaxPtUE;                                 ///< Maximum pt for UE estimation
 
+  Bool_t     fUseEtaPhiGrid;                           ///< Loop only on the reader eta-phi grid cells near the cone and use the grid kinematics, see AliCaloTrackReader::GetEtaPhiGrid()
+
   TString    fJetRhoTaskName;                          ///< Name of the container of the jet rho task calculation
 
   Int_t      fDebug;                                   ///< Debug level.
@@ -572,7 +577,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,28) ;
+  ClassDef(AliIsolationCut,29) ;
   /// \endcond
 
 } ;
@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -102,12 +103,14 @@ AliAODBranchReplicator(),
   fV0s(0x0),
   fCascades(0x0),
   fConversionPhotons(0x0),
+  fTrackColumns(0x0),
   fSaveZDC(0),
   fSaveVzero(0),
   fSaveV0s(0),
   fSaveCascades(kFALSE),
   fSaveConversionPhotons(kFALSE),
   fPhotonFromDeltas(kFALSE),
+  fSaveTrackColumns(kFALSE),
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
@@ -142,12 +145,14 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fV0s(0x0),
   fCascades(0x0),
   fConversionPhotons(0x0),
+  fTrackColumns(0x0),
   fSaveZDC(0),
   fSaveVzero(0),
   fSaveV0s(0),
   fSaveCascades(kFALSE),
   fSaveConversionPhotons(kFALSE),
   fPhotonFromDeltas(kFALSE),
+  fSaveTrackColumns(kFALSE),
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
@@ -576,6 +581,13 @@ TList* AliNanoAODReplicator::GetList() const
       fTracks->SetName(fOutputArrayName.Data());
       fList->Add(fTracks);
 
+      if (fSaveTrackColumns) {
+        AliNanoAODTrackMapping::GetInstance(fVarList);
+        fTrackColumns = new AliNanoAODTrackColumns("trackColumns");
+        fTrackColumns->CompileSchema();
+        fList->Add(fTrackColumns);
+      }
+
       Int_t numberOfHeaderParam = 0;
       Int_t numberOfHeaderParamInt = 0;
       for (Int_t i=0; i < fVarListHeader.Length(); i++){
@@ -857,6 +869,10 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     
     trackAssociation[aodtrack] = nanoTrack;
   }
+
+  // Columnar copy of the selected tracks, after the custom setters
+  if (fTrackColumns)
+    fTrackColumns->Fill(fTracks);
   
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
@@ -49,6 +49,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumns;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -86,6 +87,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void SetSaveV0s(Bool_t b)    { fSaveV0s = b; }
   void SetSaveCascades(Bool_t b) { fSaveCascades = b; }
   void SetSaveConversionPhotons(Bool_t b) { fSaveConversionPhotons = b; }
+  void SetSaveTrackColumns(Bool_t b) { fSaveTrackColumns = b; } // also store the tracks in columnar form, see AliNanoAODTrackColumns
   void SetPhotonDeltaBranchName(TString name) {
     fPhotonFromDeltas = true;
     fDeltaAODBranchName = name;
@@ -141,6 +143,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   mutable TClonesArray* fV0s;    //! internal array of AliAODv0
   mutable TClonesArray* fCascades;    //! internal array of AliAODcascade
   mutable TClonesArray* fConversionPhotons;    //! internal array of AliAODConversionPhoton
+  mutable AliNanoAODTrackColumns* fTrackColumns; //! internal columnar copy of fTracks
     
   Bool_t fSaveZDC;    // if kTRUE AliAODZDC will be saved in AliAODEvent
   Bool_t fSaveVzero;  // if kTRUE AliAODVZERO will be saved in AliAODEvent
@@ -148,6 +151,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   Bool_t fSaveCascades; // if kTRUE AliAODcascade will be saved in AliAODEvent
   Bool_t fSaveConversionPhotons; // If kTRUE gamme conversions are stored (needs delta AOD)
   Bool_t fPhotonFromDeltas; // If kTRUE gamma conversions will be directly taken from the Delta AOD
+  Bool_t fSaveTrackColumns; // If kTRUE the tracks are also stored as AliNanoAODTrackColumns
   TString fDeltaAODBranchName; // Name of the photon branch in the Delta AOD
 
   TString fInputArrayName; // name of array if tracks are stored in a TObjectArray
@@ -159,7 +163,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 8) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
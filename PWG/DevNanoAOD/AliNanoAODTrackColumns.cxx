@@ -0,0 +1,171 @@
+#include "AliNanoAODTrackColumns.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliNanoAODTrack.h"
+#include "TClonesArray.h"
+#include "AliLog.h"
+#include <iostream>
+
+ClassImp(AliNanoAODTrackColumns)
+
+AliNanoAODTrackColumns::AliNanoAODTrackColumns() :
+  TNamed(),
+  fNRows(0),
+  fNFloat(0),
+  fNInt(0),
+  fFloatData(),
+  fIntData(),
+  fNanoFlags(),
+  fLabels(),
+  fSchemaCompiled(kFALSE),
+  fColumnNames(),
+  fColumnNamesInt()
+{
+  /// default ctor
+}
+
+AliNanoAODTrackColumns::AliNanoAODTrackColumns(const char * name) :
+  TNamed(name, name),
+  fNRows(0),
+  fNFloat(0),
+  fNInt(0),
+  fFloatData(),
+  fIntData(),
+  fNanoFlags(),
+  fLabels(),
+  fSchemaCompiled(kFALSE),
+  fColumnNames(),
+  fColumnNamesInt()
+{
+  /// ctor
+}
+
+void AliNanoAODTrackColumns::Clear(Option_t * /*opt*/)
+{
+  /// Remove all rows, the capacity of the columns is kept for the next event
+
+  fNRows = 0;
+  fFloatData.clear();
+  fIntData.clear();
+  fNanoFlags.clear();
+  fLabels.clear();
+}
+
+void AliNanoAODTrackColumns::CompileSchema()
+{
+  /// Resolve the column names from the AliNanoAODTrackMapping
+  /// singleton. This is done only once, on first use.
+
+  if (fSchemaCompiled)
+    return;
+
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  if (!mapping)
+    AliFatal("No AliNanoAODTrackMapping available");
+
+  if (fNRows > 0 && (fNFloat != mapping->GetSize() || fNInt != mapping->GetSizeInt()))
+    AliFatal(Form("Columns (%d float, %d int) do not match the track mapping (%d float, %d int)",
+                  fNFloat, fNInt, mapping->GetSize(), mapping->GetSizeInt()));
+  fNFloat = mapping->GetSize();
+  fNInt   = mapping->GetSizeInt();
+
+  fColumnNames.resize(fNFloat);
+  for (Int_t i = 0; i < fNFloat; i++)
+    fColumnNames[i] = mapping->GetVarName(i);
+  fColumnNamesInt.resize(fNInt);
+  for (Int_t i = 0; i < fNInt; i++)
+    fColumnNamesInt[i] = mapping->GetVarNameInt(i);
+
+  fSchemaCompiled = kTRUE;
+}
+
+void AliNanoAODTrackColumns::Fill(const TClonesArray * tracks)
+{
+  /// Copy all AliNanoAODTracks of \a tracks into the columns, replacing
+  /// the previous content. The columns are resized once and then
+  /// filled column by column.
+
+  CompileSchema();
+
+  const Int_t n = tracks->GetEntriesFast();
+  fNRows = n;
+  fFloatData.resize(fNFloat * n);
+  fIntData.resize(fNInt * n);
+  fNanoFlags.resize(n);
+  fLabels.resize(n);
+  if (n == 0)
+    return;
+
+  std::vector<const AliNanoAODTrack*> rows(n);
+  for (Int_t j = 0; j < n; j++) {
+    rows[j] = static_cast<const AliNanoAODTrack*>(tracks->UncheckedAt(j));
+    fNanoFlags[j] = rows[j]->GetNanoFlags();
+    fLabels[j]    = rows[j]->GetLabel();
+  }
+
+  for (Int_t i = 0; i < fNFloat; i++) {
+    Float_t * column = &fFloatData[i * n];
+    for (Int_t j = 0; j < n; j++)
+      column[j] = rows[j]->GetVar(i);
+  }
+  for (Int_t i = 0; i < fNInt; i++) {
+    Int_t * column = &fIntData[i * n];
+    for (Int_t j = 0; j < n; j++)
+      column[j] = rows[j]->GetVarInt(i);
+  }
+}
+
+Int_t AliNanoAODTrackColumns::GetColumnIndex(const char * name)
+{
+  /// Index of the float column \a name, -1 if not stored.
+  /// Cache the result in your task, this is a string comparison.
+
+  CompileSchema();
+  for (Int_t i = 0; i < fNFloat; i++)
+    if (fColumnNames[i] == name) return i;
+  return -1;
+}
+
+Int_t AliNanoAODTrackColumns::GetColumnIndexInt(const char * name)
+{
+  /// Index of the int column \a name, -1 if not stored.
+  /// Cache the result in your task, this is a string comparison.
+
+  CompileSchema();
+  for (Int_t i = 0; i < fNInt; i++)
+    if (fColumnNamesInt[i] == name) return i;
+  return -1;
+}
+
+const char * AliNanoAODTrackColumns::GetColumnName(Int_t index)
+{
+  /// Name of the float column \a index
+
+  CompileSchema();
+  if (index < 0 || index >= fNFloat) {
+    AliWarning(Form("Invalid index %d", index));
+    return "<Invalid index>";
+  }
+  return fColumnNames[index].Data();
+}
+
+const char * AliNanoAODTrackColumns::GetColumnNameInt(Int_t index)
+{
+  /// Name of the int column \a index
+
+  CompileSchema();
+  if (index < 0 || index >= fNInt) {
+    AliWarning(Form("Invalid index %d", index));
+    return "<Invalid index>";
+  }
+  return fColumnNamesInt[index].Data();
+}
+
+void AliNanoAODTrackColumns::Print(const Option_t * /*opt*/) const
+{
+  std::cout << "Printing AliNanoAODTrackColumns " << GetName() << ": " << fNRows << " rows" << std::endl;
+
+  for (Int_t i = 0; i < (Int_t) fColumnNames.size(); i++)
+    std::cout << " " << i << " " << fColumnNames[i] << std::endl;
+  for (Int_t i = 0; i < (Int_t) fColumnNamesInt.size(); i++)
+    std::cout << " " << i << " " << fColumnNamesInt[i] << " (int)" << std::endl;
+}
@@ -0,0 +1,93 @@
+#ifndef _ALINANOAODTRACKCOLUMNS_H_
+#define _ALINANOAODTRACKCOLUMNS_H_
+
+/// \class AliNanoAODTrackColumns
+/// \brief Columnar storage of the NanoAOD tracks of one event
+///
+/// The selected tracks of an event are stored with one array per
+/// variable (column) instead of one AliNanoAODTrack object per track:
+/// the Double_t variables of the AliNanoAODTrackMapping become Float_t
+/// columns, the Int_t variables Int_t columns. The nano flags and the
+/// MC labels are stored as two extra columns.
+///
+/// The schema (column names and indices) is compiled once from the
+/// AliNanoAODTrackMapping singleton, the column indices are the same
+/// as the indices of the mapping, so the indices cached for
+/// AliNanoAODTrack::GetVar() can be used here as well.
+///
+/// Usage in an analysis task:
+///
+///     AliNanoAODTrackColumns* cols = (AliNanoAODTrackColumns*) aod->FindListObject("trackColumns");
+///     static const Int_t kPt = cols->GetColumnIndex("pt");  // once
+///     const Float_t* pt = cols->GetColumn(kPt);
+///     for (Int_t i = 0; i < cols->GetNRows(); i++) ... pt[i] ...
+///
+/// The columns are filled by AliNanoAODReplicator, see
+/// AliNanoAODReplicator::SetSaveTrackColumns().
+
+#include "TNamed.h"
+#include "TString.h"
+#include <vector>
+
+class TClonesArray;
+
+class AliNanoAODTrackColumns : public TNamed
+{
+public:
+  AliNanoAODTrackColumns();
+  AliNanoAODTrackColumns(const char * name);
+  virtual ~AliNanoAODTrackColumns() {;}
+
+  virtual void Clear(Option_t * opt = "");
+  void Print(const Option_t * opt = "") const;
+
+  void CompileSchema();
+
+  void Fill(const TClonesArray * tracks);
+
+  Int_t GetNRows()                       const { return fNRows;   }
+  Int_t GetNColumns()                    const { return fNFloat;  }
+  Int_t GetNColumnsInt()                 const { return fNInt;    }
+
+  Int_t GetColumnIndex(const char * name);
+  Int_t GetColumnIndexInt(const char * name);
+  const char * GetColumnName(Int_t index);
+  const char * GetColumnNameInt(Int_t index);
+
+  /// Float column \a index, GetNRows() values, 0 if the index is invalid
+  const Float_t * GetColumn(Int_t index) const {
+    return (index < 0 || index >= fNFloat || fNRows == 0) ? 0 : &fFloatData[index * fNRows]; }
+  /// Int column \a index, GetNRows() values, 0 if the index is invalid
+  const Int_t * GetColumnInt(Int_t index) const {
+    return (index < 0 || index >= fNInt || fNRows == 0) ? 0 : &fIntData[index * fNRows]; }
+  /// Nano flags, see AliNanoAODTrack::ENanoFlags
+  const UInt_t * GetNanoFlags() const { return fNRows == 0 ? 0 : &fNanoFlags[0]; }
+  /// MC labels
+  const Int_t * GetLabels()     const { return fNRows == 0 ? 0 : &fLabels[0];    }
+
+  Float_t Get(Int_t index, Int_t row)    const { return fFloatData[index * fNRows + row]; }
+  Int_t   GetInt(Int_t index, Int_t row) const { return fIntData[index * fNRows + row];   }
+  Short_t GetCharge(Int_t row)           const { return (fNanoFlags[row] & 1) ? 1 : -1;   }
+
+private:
+
+  Int_t fNRows;   ///< Number of tracks (rows)
+  Int_t fNFloat;  ///< Number of float columns
+  Int_t fNInt;    ///< Number of int columns
+
+  std::vector<Float_t> fFloatData; ///< Float columns, column i at [i*fNRows, (i+1)*fNRows[
+  std::vector<Int_t>   fIntData;   ///< Int columns, column i at [i*fNRows, (i+1)*fNRows[
+  std::vector<UInt_t>  fNanoFlags; ///< Nano flags per track
+  std::vector<Int_t>   fLabels;    ///< MC label per track
+
+  Bool_t fSchemaCompiled;               //!<! Schema has been compiled from the mapping
+  std::vector<TString> fColumnNames;    //!<! Names of the float columns
+  std::vector<TString> fColumnNamesInt; //!<! Names of the int columns
+
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&);
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&);
+
+  ClassDef(AliNanoAODTrackColumns, 1)
+};
+
+#endif /* _ALINANOAODTRACKCOLUMNS_H_ */
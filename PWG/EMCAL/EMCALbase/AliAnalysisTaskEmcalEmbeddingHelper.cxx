@@ -26,6 +26,7 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TBranch.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -118,6 +119,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPtHardJetPtRejectionFactor(4),
   fZVertexCut(10),
   fMaxVertexDist(999),
+  fPreselectEmbeddedEvents(false),
+  fPreselectionBranches({"header", "vertices", "mcHeader"}),
+  fEmbeddedBranches(),
+  fTreeCacheSize(0),
+  fParallelUnzip(false),
   fInitializedConfiguration(false),
   fInitializedNewFile(false),
   fInitializedEmbedding(false),
@@ -161,6 +167,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fPreselectedEntries(),
   fHistManager(),
   fOutput(nullptr),
   fExternalEvent(nullptr),
@@ -195,6 +202,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPtHardJetPtRejectionFactor(4),
   fZVertexCut(10),
   fMaxVertexDist(999),
+  fPreselectEmbeddedEvents(false),
+  fPreselectionBranches({"header", "vertices", "mcHeader"}),
+  fEmbeddedBranches(),
+  fTreeCacheSize(0),
+  fParallelUnzip(false),
   fInitializedConfiguration(false),
   fInitializedNewFile(false),
   fInitializedEmbedding(false),
@@ -238,6 +250,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fPreselectedEntries(),
   fHistManager(name),
   fOutput(nullptr),
   fExternalEvent(nullptr),
@@ -328,6 +341,13 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("embeddedEventZVertexCut", fZVertexCut, false);
   res = fYAMLConfig.GetProperty("maxVertexDifferenceDistance", fMaxVertexDist, false);
 
+  // Embedded event I/O
+  res = fYAMLConfig.GetProperty("preselectEmbeddedEvents", fPreselectEmbeddedEvents, false);
+  res = fYAMLConfig.GetProperty("preselectionBranches", fPreselectionBranches, false);
+  res = fYAMLConfig.GetProperty("embeddedBranches", fEmbeddedBranches, false);
+  res = fYAMLConfig.GetProperty("treeCacheSize", fTreeCacheSize, false);
+  res = fYAMLConfig.GetProperty("parallelUnzip", fParallelUnzip, false);
+
   // Embedding helper properties
   res = fYAMLConfig.GetProperty("treeName", fTreeName, false);
   res = fYAMLConfig.GetProperty("nPtHardBins", fNPtHardBins, false);
@@ -904,6 +924,7 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
   Int_t attempts = -1;
+  Bool_t selected = kFALSE;
 
   do {
     // Reset to start of tree
@@ -927,12 +948,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       InitTree();
     }
 
-    // Load current event
-    // Can be a simple less than, because fFileNumber counts from 0.
-    if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
-    }
-    else {
+    // Check that files are available
+    // Can be a simple greater equal, because fFileNumber counts from 0.
+    if (fFileNumber >= fMaxNumberOfFiles) {
       AliError("====================================================================================================");
       AliError("== No more files available to embed from the TChain! Restarting from the beginning of the TChain! ==");
       AliError("== Be careful to check that this is the desired action!                                           ==");
@@ -945,11 +963,26 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
       // Re-init back to the start
       InitTree();
+    }
+
+    // Provide a check for number of attempts
+    attempts++;
+    if (attempts == 1000)
+      AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
 
-      // Access the relevant entry
-      // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+    // Skip entries rejected by the preselection without loading the full event
+    UInt_t rejection = GetEntryPreselectionRejection(fCurrentEntry);
+    if (rejection != kPreselected) {
+      if (fCreateHisto) {
+        RecordPreselectionRejection(fCurrentEntry, rejection);
+      }
+      fCurrentEntry++;
+      continue;
     }
+
+    // Load current event
+    // We are certain that fFileNumber is less than fMaxNumberOfFiles at this point
+    fChain->GetEntry(fCurrentEntry);
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
     // Set relevant event properties
@@ -957,18 +990,14 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
     // Increment current entry
     fCurrentEntry++;
-    
-    // Provide a check for number of attempts
-    attempts++;
-    if (attempts == 1000)
-      AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
 
     // Record event properties
     if (fCreateHisto) {
       RecordEmbeddedEventProperties();
     }
 
-  } while (!IsEventSelected());
+    selected = IsEventSelected();
+  } while (!selected);
 
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
@@ -1039,6 +1068,24 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RecordEmbeddedEventProperties()
   fHistManager.FillTH1("fHistPtHard", fPythiaPtHard);
 }
 
+/**
+ * Record an entry which is skipped because it was rejected by the preselection. The same
+ * histograms are filled as if the entry was loaded and rejected by the event selection.
+ *
+ * @param[in] entry Entry in the chain
+ * @param[in] rejection Rejection reason, see GetEmbeddedEventPreselectionRejection()
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::RecordPreselectionRejection(Int_t entry, UInt_t rejection)
+{
+  const PreselectedEntry_t & info = fPreselectedEntries[entry - fLowerEntry];
+  fHistManager.FillTH1("fHistTrials", fPtHardBin, info.fTrials);
+  fHistManager.FillProfile("fHistXsection", fPtHardBin, info.fXsection);
+  fHistManager.FillTH1("fHistPtHard", info.fPtHard);
+
+  FillPreselectionRejection(rejection);
+  fHistManager.FillTH1("fHistEventCount", "Rejected");
+}
+
 /**
  * Handles (ie wraps) event selection and proper event counting.
  *
@@ -1064,6 +1111,80 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected()
  * @return kTRUE if the event successfully passes all criteria.
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
+{
+  // Selections which only depend on the embedded event
+  if (!CheckIsEmbeddedEventPreselected()) {
+    return kFALSE;
+  }
+
+  // Vertex distance selection
+  Double_t externalVertex[3]={0};
+  Double_t inputVertex[3]={0};
+  const AliVVertex *externalVert = fExternalEvent->GetPrimaryVertex();
+  const AliVVertex *inputVert = AliAnalysisTaskSE::InputEvent()->GetPrimaryVertex();
+  if (externalVert && inputVert) {
+    externalVert->GetXYZ(externalVertex);
+    inputVert->GetXYZ(inputVertex);
+
+    Double_t dist = TMath::Sqrt((externalVertex[0]-inputVertex[0])*(externalVertex[0]-inputVertex[0])+(externalVertex[1]-inputVertex[1])*(externalVertex[1]-inputVertex[1])+(externalVertex[2]-inputVertex[2])*(externalVertex[2]-inputVertex[2]));
+    if (dist > fMaxVertexDist) {
+      AliDebug(3, Form("Event rejected because the distance between the current and embedded vertices is > %f. "
+       "Current event vertex (%f, %f, %f), embedded event vertex (%f, %f, %f). Distance = %f",
+       fMaxVertexDist, inputVertex[0], inputVertex[1], inputVertex[2], externalVertex[0], externalVertex[1], externalVertex[2], dist));
+      if (fCreateHisto) {
+        fHistManager.FillTH1("fHistEmbeddedEventRejection", "VertexDist", 1);
+      }
+      return kFALSE;
+    }
+  }
+
+  return kTRUE;
+}
+
+/**
+ * Performs the part of the embedded event selection which only depends on the external event
+ * (pt hard, physics selection, z vertex and MC outliers) and records the rejection reason.
+ *
+ * @return kTRUE if the event successfully passes all criteria.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventPreselected()
+{
+  UInt_t rejection = GetEmbeddedEventPreselectionRejection();
+  if (rejection != kPreselected) {
+    FillPreselectionRejection(rejection);
+    return kFALSE;
+  }
+  return kTRUE;
+}
+
+/**
+ * Fill the rejection reason of the selections which only depend on the external event.
+ *
+ * @param[in] rejection Rejection reason, see GetEmbeddedEventPreselectionRejection()
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::FillPreselectionRejection(UInt_t rejection)
+{
+  if (!fCreateHisto) {
+    return;
+  }
+  static const char * labels[kNPreselectionRejections] = {"", "PtHardIs0", "PhysSel", "Vz", "MCOutlier"};
+  if (rejection > kPreselected && rejection < kNPreselectionRejections) {
+    fHistManager.FillTH1("fHistEmbeddedEventRejection", labels[rejection], 1);
+  }
+}
+
+/**
+ * Selections which only depend on the external event (pt hard, physics selection, z vertex and
+ * MC outliers), without filling any histogram. It is also used to build the preselection index
+ * of a new file, in which case only the preselection branches are loaded.
+ *
+ * The z vertex selection is applied whenever the external event has a primary vertex; as before,
+ * an event without vertex is not rejected by it. It does not require the internal vertex anymore,
+ * which only enters the vertex distance selection.
+ *
+ * @return kPreselected if the event passes all criteria, the rejection reason otherwise.
+ */
+UInt_t AliAnalysisTaskEmcalEmbeddingHelper::GetEmbeddedEventPreselectionRejection()
 {
   // Check if pt hard bin is 0, indicating a problem with the event or the grid.
   // In such a case, the event should be rejected.
@@ -1071,10 +1192,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
   // (pt hard should still be set even if the production wasn't done in pt hard bins).
   if (fPythiaPtHard == 0. && fPythiaHeader) {
     AliDebugStream(3) << "Event rejected due to pt hard = 0, indicating a problem with the external event.\n";
-    if (fCreateHisto) {
-      fHistManager.FillTH1("fHistEmbeddedEventRejection", "PtHardIs0", 1);
-    }
-    return kFALSE;
+    return kRejectedPtHardIs0;
   }
 
   // Physics selection
@@ -1099,39 +1217,20 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
     if ((res & fTriggerMask) == 0) {
       AliDebug(3, Form("Event rejected due to physics selection. Event trigger mask: %d, trigger mask selection: %d.",
                       res, fTriggerMask));
-      if (fCreateHisto) {
-        fHistManager.FillTH1("fHistEmbeddedEventRejection", "PhysSel", 1);
-      }
-      return kFALSE;
+      return kRejectedPhysSel;
     }
   }
 
-  // Vertex selection
+  // Z vertex selection
   Double_t externalVertex[3]={0};
-  Double_t inputVertex[3]={0};
   const AliVVertex *externalVert = fExternalEvent->GetPrimaryVertex();
-  const AliVVertex *inputVert = AliAnalysisTaskSE::InputEvent()->GetPrimaryVertex();
-  if (externalVert && inputVert) {
+  if (externalVert) {
     externalVert->GetXYZ(externalVertex);
-    inputVert->GetXYZ(inputVertex);
 
     if (TMath::Abs(externalVertex[2]) > fZVertexCut) {
       AliDebug(3, Form("Event rejected due to Z vertex selection. Event Z vertex: %f, Z vertex cut: %f",
        externalVertex[2], fZVertexCut));
-      if (fCreateHisto) {
-        fHistManager.FillTH1("fHistEmbeddedEventRejection", "Vz", 1);
-      }
-      return kFALSE;
-    }
-    Double_t dist = TMath::Sqrt((externalVertex[0]-inputVertex[0])*(externalVertex[0]-inputVertex[0])+(externalVertex[1]-inputVertex[1])*(externalVertex[1]-inputVertex[1])+(externalVertex[2]-inputVertex[2])*(externalVertex[2]-inputVertex[2]));
-    if (dist > fMaxVertexDist) {
-      AliDebug(3, Form("Event rejected because the distance between the current and embedded vertices is > %f. "
-       "Current event vertex (%f, %f, %f), embedded event vertex (%f, %f, %f). Distance = %f",
-       fMaxVertexDist, inputVertex[0], inputVertex[1], inputVertex[2], externalVertex[0], externalVertex[1], externalVertex[2], dist));
-      if (fCreateHisto) {
-        fHistManager.FillTH1("fHistEmbeddedEventRejection", "VertexDist", 1);
-      }
-      return kFALSE;
+      return kRejectedVz;
     }
   }
 
@@ -1160,14 +1259,13 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
         //Compare jet pT and pt Hard
         if (jet.Pt() > fPtHardJetPtRejectionFactor * fPythiaPtHard) {
           AliDebugStream(3) << "Event rejected because of MC outlier removal. Pythia header jet with: pT Hard " << fPythiaPtHard << ", pycell jet pT " << jet.Pt() << ", rejection factor " << fPtHardJetPtRejectionFactor << "\n";
-          fHistManager.FillTH1("fHistEmbeddedEventRejection", "MCOutlier", 1);
-          return kFALSE;
+          return kRejectedMCOutlier;
         }
       }
     }
   }
 
-  return kTRUE;
+  return kPreselected;
 }
 
 /**
@@ -1193,10 +1291,130 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::InitEvent()
   }
 
   fExternalEvent->ReadFromTree(fChain, fTreeName);
+
+  SetupEmbeddedEventIO();
   
   return kTRUE;
 }
 
+/**
+ * Configure the reading of the embedded chain: restrict the branches which are read to the
+ * ones requested by the user (plus the preselection branches) and setup the TTreeCache, whose
+ * baskets can be decompressed in a background thread. Since the entries are read sequentially
+ * within a file (even with random event number access), the cache prefetches the following
+ * entries, limited by the cache size.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupEmbeddedEventIO()
+{
+  if (fPreselectEmbeddedEvents && fTreeName != "aodTree") {
+    AliWarning("Preselection of the embedded events is only available for AODs. Disabling it!");
+    fPreselectEmbeddedEvents = false;
+  }
+
+  std::vector<std::string> branches = fEmbeddedBranches;
+  if (branches.size() > 0) {
+    if (fPreselectEmbeddedEvents) {
+      branches.insert(branches.end(), fPreselectionBranches.begin(), fPreselectionBranches.end());
+    }
+
+    fChain->SetBranchStatus("*", 0);
+    for (auto branch : branches) {
+      AliDebugStream(2) << "Enabling embedded branch \"" << branch << "\".\n";
+      fChain->SetBranchStatus((branch + "*").c_str(), 1);
+    }
+  }
+
+  if (fParallelUnzip) {
+    fChain->SetParallelUnzip(kTRUE);
+  }
+
+  if (fTreeCacheSize > 0) {
+    fChain->SetCacheSize(fTreeCacheSize);
+    if (branches.size() > 0) {
+      for (auto branch : branches) {
+        fChain->AddBranchToCache(branch.c_str(), kTRUE);
+      }
+    }
+    else {
+      fChain->AddBranchToCache("*", kTRUE);
+    }
+    fChain->StopCacheLearningPhase();
+  }
+}
+
+/**
+ * Build the preselection index of the current tree. For each entry only the preselection
+ * branches are read and the selections which only depend on the embedded event are applied.
+ * The rejected entries are then skipped in GetNextEntry() without reading the full event.
+ *
+ * The selections depending on the internal event (vertex distance, internal event selection
+ * and random rejection) cannot be applied at this stage.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PreselectEntries()
+{
+  fPreselectedEntries.clear();
+  if (!fPreselectEmbeddedEvents) {
+    return;
+  }
+
+  TTree * tree = fChain->GetTree();
+  std::vector<TBranch *> branches;
+  for (auto name : fPreselectionBranches) {
+    TBranch * branch = tree->GetBranch(name.c_str());
+    if (branch) {
+      branches.push_back(branch);
+    }
+    else {
+      AliDebugStream(2) << "Preselection branch \"" << name << "\" not available in the embedded tree.\n";
+    }
+  }
+
+  // Only the rejection reason is stored here. The rejection histogram is filled in
+  // GetNextEntry() for the entries which are actually reached.
+  Long64_t nEntries = fUpperEntry - fLowerEntry;
+  fPreselectedEntries.resize(nEntries);
+  Long64_t nAccepted = 0;
+  for (Long64_t iEntry = 0; iEntry < nEntries; iEntry++) {
+    for (auto branch : branches) {
+      branch->GetEntry(iEntry);
+    }
+    SetEmbeddedEventProperties();
+    PreselectedEntry_t & info = fPreselectedEntries[iEntry];
+    info.fRejection = GetEmbeddedEventPreselectionRejection();
+    info.fPtHard = fPythiaPtHard;
+    info.fTrials = fPythiaTrials;
+    info.fXsection = fPythiaCrossSection;
+    if (info.fRejection == kPreselected) {
+      nAccepted++;
+    }
+  }
+
+  AliDebugStream(2) << "Preselected " << nAccepted << " out of " << nEntries << " entries in embedded file " << fFileNumber << ".\n";
+  if (nAccepted == 0) {
+    AliWarningStream() << "No entry passed the preselection in embedded file " << fFileNumber << ".\n";
+  }
+}
+
+/**
+ * Retrieve the preselection result of an entry of the chain.
+ *
+ * @param[in] entry Entry in the chain
+ * @return kPreselected if the entry passed the preselection or if the preselection is not enabled,
+ *         the rejection reason otherwise.
+ */
+UInt_t AliAnalysisTaskEmcalEmbeddingHelper::GetEntryPreselectionRejection(Int_t entry) const
+{
+  if (!fPreselectEmbeddedEvents) {
+    return kPreselected;
+  }
+  Long64_t localEntry = entry - fLowerEntry;
+  if (localEntry < 0 || localEntry >= static_cast<Long64_t>(fPreselectedEntries.size())) {
+    // Past the end of the last file, see GetNextEntry()
+    return kPreselected;
+  }
+  return fPreselectedEntries[localEntry].fRejection;
+}
+
 /**
  * Performing run-independent initialization to setup embedding.
  *
@@ -1589,6 +1807,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
     }
   }
 
+  // Build the index of the preselected entries of the new tree
+  PreselectEntries();
+
   AliDebug(2, TString::Format("Will start embedding file %i beginning from entry %i (entry %i within the file). NOTE: This file number is not equal to the absolute file number in the file list!", fFileNumber, fCurrentEntry, fCurrentEntry - fLowerEntry));
   // NOTE: Cannot use this print message, as it is possible that fMaxNumberOfFiles != fFilenames.size() because
   //       invalid filenames may be included in the fFilenames count!
@@ -2031,6 +2252,14 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "Z vertex cut: " << fZVertexCut << "\n";
   tempSS << "Max difference between internal and embedded vertex: " << fMaxVertexDist << "\n";
   tempSS << "Random event rejection factor: " << fRandomRejectionFactor << "\n";
+  tempSS << "Preselect embedded events: " << fPreselectEmbeddedEvents << "\n";
+  tempSS << "Embedded branches: " << (fEmbeddedBranches.size() > 0 ? "" : "all");
+  for (auto branch : fEmbeddedBranches) {
+    tempSS << branch << " ";
+  }
+  tempSS << "\n";
+  tempSS << "Tree cache size: " << fTreeCacheSize << "\n";
+  tempSS << "Parallel unzip: " << fParallelUnzip << "\n";
 
   if (includeFileList) {
     tempSS << "\nFiles to embed:\n";
@@ -211,6 +211,33 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetMaxVertexDistance(Double_t distance)                    { fMaxVertexDist = distance; }
   /* @} */
 
+  /**
+   * @{
+   * @name I/O of the embedded event
+   */
+  bool GetPreselectEmbeddedEvents()                         const { return fPreselectEmbeddedEvents; }
+  std::vector<std::string> GetPreselectionBranches()        const { return fPreselectionBranches; }
+  std::vector<std::string> GetEmbeddedBranches()            const { return fEmbeddedBranches; }
+  Long64_t GetTreeCacheSize()                               const { return fTreeCacheSize; }
+  bool GetParallelUnzip()                                   const { return fParallelUnzip; }
+
+  /**
+   * Enable the preselection of the embedded events. When a new file is opened, only the branches
+   * needed for the embedded event selection are read to build an index of the entries passing the
+   * cuts which depend only on the embedded event (pt hard, physics selection, z vertex, MC outliers).
+   * Rejected entries are then skipped without loading the full event. Only available for AODs.
+   */
+  void SetPreselectEmbeddedEvents(bool b = true)                  { fPreselectEmbeddedEvents = b; }
+  /// Set the branches read for the preselection. Defaults to the AOD header, vertices and MC header
+  void SetPreselectionBranches(std::vector<std::string> branches) { fPreselectionBranches = branches; }
+  /// Only read these branches of the embedded event (in addition to the preselection branches). All branches are read if empty.
+  void SetEmbeddedBranches(std::vector<std::string> branches)     { fEmbeddedBranches = branches; }
+  /// Set the size of the TTreeCache of the embedded chain in bytes. The ROOT default cache is used if 0.
+  void SetTreeCacheSize(Long64_t size)                            { fTreeCacheSize = size; }
+  /// Decompress the baskets of the TTreeCache in a background thread
+  void SetParallelUnzip(bool b = true)                            { fParallelUnzip = b; }
+  /* @} */
+
   /**
    * @{
    * @name Properties of the embedded event
@@ -288,6 +315,24 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   /* @} */
 
  protected:
+  /// Result of the selections which only depend on the embedded event
+  enum EPreselectionRejection_t {
+    kPreselected = 0,                  ///< Passed all preselection criteria
+    kRejectedPtHardIs0 = 1,            ///< Rejected due to pt hard = 0
+    kRejectedPhysSel = 2,              ///< Rejected by the physics selection
+    kRejectedVz = 3,                   ///< Rejected by the Z vertex selection
+    kRejectedMCOutlier = 4,            ///< Rejected as pt hard bin outlier
+    kNPreselectionRejections = 5       ///< Number of preselection results
+  };
+
+  /// Preselection result and pythia information of an entry of the current tree
+  struct PreselectedEntry_t {
+    UChar_t  fRejection;               ///< Preselection result, see EPreselectionRejection_t
+    Double_t fPtHard;                  ///< Pythia pt hard
+    Double_t fTrials;                  ///< Pythia trials
+    Double_t fXsection;                ///< Pythia cross section
+  };
+
   virtual void    RetrieveTaskPropertiesFromYAMLConfig();
   bool            GetFilenames()        ;
   void            DeterminePythiaXSecFilename();
@@ -304,10 +349,17 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          GetNextEntry()        ;
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
+  void            RecordPreselectionRejection(Int_t entry, UInt_t rejection);
   Bool_t          IsEventSelected()     ;
   virtual Bool_t  CheckIsEmbeddedEventSelected();
+  Bool_t          CheckIsEmbeddedEventPreselected();
+  UInt_t          GetEmbeddedEventPreselectionRejection();
+  void            FillPreselectionRejection(UInt_t rejection);
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetupEmbeddedEventIO();
+  void            PreselectEntries()    ;
+  UInt_t          GetEntryPreselectionRejection(Int_t entry) const;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Validation helper
   void            ValidatePhysicsSelectionForInternalEventSelection();
@@ -322,6 +374,11 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Double_t                                      fPtHardJetPtRejectionFactor; ///<  Factor which the pt hard bin is multiplied by to compare against pythia header jets pt
   Double_t                                      fZVertexCut;        ///<  Z vertex cut on embedded event
   Double_t                                      fMaxVertexDist;     ///<  Max distance between Z vertex of internal and embedded event
+  bool                                  fPreselectEmbeddedEvents; ///<  If true, build an index of the preselected entries when opening a new file
+  std::vector <std::string>                fPreselectionBranches; ///<  Branches read to perform the preselection
+  std::vector <std::string>                    fEmbeddedBranches; ///<  Branches of the embedded event which are read (all if empty)
+  Long64_t                                        fTreeCacheSize; ///<  Size of the TTreeCache of the embedded chain (ROOT default if 0)
+  bool                                            fParallelUnzip; ///<  If true, decompress the cached baskets in a background thread
 
   bool                                          fInitializedConfiguration; ///< Notes if the configuration has been initialized
   bool                                          fInitializedNewFile; //!<! Notes where the entry indices have been initialized for a new tree in the chain
@@ -371,6 +428,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fOffset           ; //!<! Offset from fLowerEntry where the loop over the tree should start
   UInt_t                                        fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   UInt_t                                        fFileNumber       ; //!<! File number corresponding to the current tree
+  std::vector <PreselectedEntry_t>              fPreselectedEntries; //!<! Preselection result for each entry of the current tree
   THistManager                                  fHistManager      ; ///< Manages access to all histograms
   AliEmcalList                                 *fOutput           ; //!<! List which owns the output histograms to be saved
   AliVEvent                                    *fExternalEvent    ; //!<! Current external event available for embedding
@@ -394,7 +452,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 14);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 15);
   /// \endcond
 };
 #endif
@@ -60,7 +60,8 @@ fHistMCFractions(nullptr), fHistMCWeights(nullptr), fMCEvent(nullptr),
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty),
 fFlag(AliMCSpectraWeights::SysFlag::kNominal), fUseMultiplicity(kTRUE),
-fUseMBFractions(kFALSE) {}
+fUseMBFractions(kFALSE), fTablePtEdges(), fTableMultEdges(),
+fTableFlagOffset(), fTableWeights(), fTableMultOrCent(-1), fTableMultBin(0) {}
 
 /**
  *  @brief standard way for constuctor
@@ -81,7 +82,9 @@ fHistMCGenPrimTrackParticle(nullptr), fHistDataFractions(nullptr),
 fHistMCFractions(nullptr), fHistMCWeights(nullptr), fMCEvent(nullptr),
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty), fFlag(flag),
-fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE) {
+fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE), fTablePtEdges(),
+fTableMultEdges(), fTableFlagOffset(), fTableWeights(), fTableMultOrCent(-1),
+fTableMultBin(0) {
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t1 = std::chrono::high_resolution_clock::now();
 #endif
@@ -327,6 +330,8 @@ void AliMCSpectraWeights::Init() {
             }
         }
     }
+    if (fbTaskStatus == AliMCSpectraWeights::TaskState::kMCWeightCalculated)
+        AliMCSpectraWeights::CompileWeightTables();
 
 DebugPCC("AliMCSpectraWeights::INFO: Init finished with status " << fbTaskStatus
          << std::endl);
@@ -1000,18 +1005,9 @@ AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle) {
         DebugPCC("Can't find particle type\n");
         return 1;
     }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
-    if (_iBin < 0) {
-        DebugPCC("Can't find bin\n");
-        return 1;
-    }
-    float weight = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]
-    ->GetBinContent(_iBin);
-    if (weight <= 0) {
-        DebugPCC("ERROR: negative weight; set to 1\n");
-        weight = 1;
-    }
+    float const weight = AliMCSpectraWeights::GetWeight(
+        mcGenParticle->Pt(), particleType,
+        AliMCSpectraWeights::SysFlag::kNominal);
     DebugPCC("GetMCSpectraWeight: nominal");
     DebugPCC(fstPartTypes[particleType] << " ");
     DebugPCC("pT: " << mcGenParticle->Pt() << " ");
@@ -1041,29 +1037,211 @@ AliMCSpectraWeights::GetMCSpectraWeightSystematics(TParticle* mcGenParticle) {
         DebugPCC("Can't find particle type\n");
         return 1;
     }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
+    float const weight =
+    AliMCSpectraWeights::GetWeight(mcGenParticle->Pt(), particleType, fFlag);
+    DebugPCC("GetMCSpectraWeight: with systematics");
+    DebugPCC(fstPartTypes[particleType] << " ");
+    DebugPCC("pT: " << mcGenParticle->Pt() << " ");
+    DebugPCC("weight: " << weight << "\n");
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto duration =
+    std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    DebugChrono("GetMCSpectraWeightSystematics took " << duration
+                << " microseconds\n");
+#endif
+    return weight;
+}
+
+/**
+ *  @brief weight factor of a particle type at given pT for the current event
+ *
+ *  Uses the compiled weight tables if available, the weight histograms
+ *  otherwise. Weights <= 0 are set to 1; particles below the pT range get 1.
+ */
+float const AliMCSpectraWeights::GetWeight(float pt, int const part,
+                                           SysFlag flag) {
+    if (AliMCSpectraWeights::IsWeightTableCompiled(flag) && part >= 0 &&
+        part < fNPartTypes)
+        return AliMCSpectraWeights::GetWeightFromTable(pt, part, flag);
+    auto const _iBin = AliMCSpectraWeights::FindBinEntry(pt, part);
     if (_iBin < 0) {
         DebugPCC("Can't find bin\n");
         return 1;
     }
-    float weight = fHistMCWeightsSys[fFlag]->GetBinContent(_iBin);
+    float weight = fHistMCWeightsSys[flag]->GetBinContent(_iBin);
     if (weight <= 0) {
         DebugPCC("ERROR: negative weight; set to 1\n");
         weight = 1;
     }
-    DebugPCC("GetMCSpectraWeight: with systematics");
-    DebugPCC(fstPartTypes[particleType] << " ");
-    DebugPCC("pT: " << mcGenParticle->Pt() << " ");
-    DebugPCC("weight: " << weight << "\n");
+    return weight;
+}
+
+/**
+ *  @brief Compile the weight histograms into dense tables
+ *
+ *  One table per systematic flag with a weight histogram, indexed by particle
+ *  type, multiplicity bin and pT bin of the histograms. The bin edges are kept
+ *  for the bin search; the rule for weights <= 0 is applied here. Same
+ *  binning as FindBinEntry, i.e. the one of the nominal histogram.
+ */
+void AliMCSpectraWeights::CompileWeightTables() {
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t1 = std::chrono::high_resolution_clock::now();
+#endif
+    fTablePtEdges.clear();
+    fTableMultEdges.clear();
+    fTableWeights.clear();
+    fTableFlagOffset.assign(AliMCSpectraWeights::SysFlag::kBlastwaveLower + 1,
+                            -1);
+    fTableMultOrCent = -1;
+    fTableMultBin = 0;
+    auto const _itNominal =
+    fHistMCWeightsSys.find(AliMCSpectraWeights::SysFlag::kNominal);
+    if (_itNominal == fHistMCWeightsSys.end() || !_itNominal->second)
+        return;
+    TH3F* hNominal = _itNominal->second;
+    for (int i = 1; i <= hNominal->GetXaxis()->GetNbins() + 1; ++i)
+        fTablePtEdges.push_back(hNominal->GetXaxis()->GetBinLowEdge(i));
+    for (int i = 1; i <= hNominal->GetYaxis()->GetNbins() + 1; ++i)
+        fTableMultEdges.push_back(hNominal->GetYaxis()->GetBinLowEdge(i));
+    int const _nPtBins = static_cast<int>(fTablePtEdges.size()) + 1;
+    int const _nMultBins = static_cast<int>(fTableMultEdges.size()) + 1;
+    std::vector<int> _partBin(fNPartTypes);
+    for (int ipart = 0; ipart < fNPartTypes; ++ipart)
+        _partBin[ipart] =
+        hNominal->GetZaxis()->FindBin(static_cast<float>(ipart));
+
+    for (auto const& _sys : fHistMCWeightsSys) {
+        TH3F* h = _sys.second;
+        if (!h)
+            continue;
+        fTableFlagOffset[_sys.first] = fTableWeights.size();
+        for (int ipart = 0; ipart < fNPartTypes; ++ipart) {
+            for (int imult = 0; imult < _nMultBins; ++imult) {
+                for (int ipt = 0; ipt < _nPtBins; ++ipt) {
+                    float weight =
+                    h->GetBinContent(h->GetBin(ipt, imult, _partBin[ipart]));
+                    if (weight <= 0)
+                        weight = 1;
+                    fTableWeights.push_back(weight);
+                }
+            }
+        }
+    }
+    DebugPCC("Compiled weight tables for " << fTableWeights.size()
+             << " bins\n");
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t2 = std::chrono::high_resolution_clock::now();
     auto duration =
     std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
-    DebugChrono("GetMCSpectraWeightSystematics took " << duration
-                << " microseconds\n");
+    DebugChrono("CompileWeightTables took " << duration << " microseconds\n");
+#endif
+}
+
+bool const AliMCSpectraWeights::IsWeightTableCompiled(SysFlag flag) const {
+    return flag >= 0 && flag < static_cast<int>(fTableFlagOffset.size()) &&
+    fTableFlagOffset[flag] >= 0;
+}
+
+/**
+ *  @brief bin of x for bin edges, as TAxis::FindBin (0: underflow,
+ *  edges.size(): overflow)
+ */
+int const AliMCSpectraWeights::FindBinInEdges(std::vector<double> const& edges,
+                                              double x) {
+    if (x < edges.front())
+        return 0;
+    if (!(x < edges.back()))
+        return edges.size();
+    return std::upper_bound(edges.begin(), edges.end(), x) - edges.begin();
+}
+
+/**
+ *  @brief table version of FindBinEntry and GetBinContent
+ *
+ *  The multiplicity bin is updated once per event.
+ */
+float const AliMCSpectraWeights::GetWeightFromTable(float pt, int const part,
+                                                    SysFlag flag) {
+    if (pt < 0.15) {
+        DebugPCC("Warning: pt too low; pt = " << pt << "\n");
+        return 1;
+    }
+    if (pt >= 20) {
+        pt = 19.9;
+    }
+    if (fTableMultOrCent != fMultOrCent) {
+        auto const icent = AliMCSpectraWeights::GetCentFromMult(fMultOrCent);
+        fTableMultBin = AliMCSpectraWeights::FindBinInEdges(
+            fTableMultEdges,
+            static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent)));
+        fTableMultOrCent = fMultOrCent;
+    }
+    int const _nPtBins = static_cast<int>(fTablePtEdges.size()) + 1;
+    int const _nMultBins = static_cast<int>(fTableMultEdges.size()) + 1;
+    return fTableWeights[fTableFlagOffset[flag] +
+                         (part * _nMultBins + fTableMultBin) * _nPtBins +
+                         AliMCSpectraWeights::FindBinInEdges(fTablePtEdges, pt)];
+}
+
+/**
+ *  @brief weights of all particles of the MC stack
+ *
+ *  Particle type and pT are evaluated once per particle for both weights.
+ *  Particles without PDG, neutral particles or missing particles get 1.
+ *  The call starts a new event (see StartNewEvent()): the multiplicity is
+ *  recounted and the systematic variation is drawn again, so it is meant to
+ *  be called once per event instead of StartNewEvent().
+ *  @param[in] mcEvent
+ *  @param[out] weightsNominal nominal weights, by stack label
+ *  @param[out] weightsSys weights for the systematic variation of the event
+ */
+void AliMCSpectraWeights::GetMCSpectraWeights(
+    AliMCEvent* mcEvent, std::vector<float>& weightsNominal,
+    std::vector<float>& weightsSys) {
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t1 = std::chrono::high_resolution_clock::now();
+#endif
+    weightsNominal.clear();
+    weightsSys.clear();
+    if (!mcEvent)
+        return;
+    // the framework reuses the same AliMCEvent object for all events
+    fMCEvent = mcEvent;
+    AliMCSpectraWeights::StartNewEvent();
+    AliStack* MCStack = fMCEvent->Stack();
+    if (!MCStack) {
+        printf("AliMCSpectraWeights::ERROR: fMCStack not available\n");
+        return;
+    }
+    int const _nParticles = MCStack->GetNtrack();
+    weightsNominal.assign(_nParticles, 1);
+    weightsSys.assign(_nParticles, 1);
+    if (fbTaskStatus < AliMCSpectraWeights::TaskState::kMCWeightCalculated) {
+        DebugPCC("Warning: Status not kMCWeightCalculated\n");
+        return;
+    }
+    for (int iParticle = 0; iParticle < _nParticles; ++iParticle) {
+        TParticle* mcGenParticle = MCStack->Particle(iParticle);
+        if (!mcGenParticle)
+            continue;
+        int const particleType =
+        AliMCSpectraWeights::CheckAndIdentifyParticle(mcGenParticle);
+        if (particleType < 0)
+            continue;
+        float const pt = mcGenParticle->Pt();
+        weightsNominal[iParticle] = AliMCSpectraWeights::GetWeight(
+            pt, particleType, AliMCSpectraWeights::SysFlag::kNominal);
+        weightsSys[iParticle] =
+        AliMCSpectraWeights::GetWeight(pt, particleType, fFlag);
+    }
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto duration =
+    std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    DebugChrono("GetMCSpectraWeights took " << duration << " microseconds\n");
 #endif
-    return weight;
 }
 
 void AliMCSpectraWeights::StartNewEvent() {
@@ -112,6 +112,14 @@ class AliMCSpectraWeights : public TNamed {
                                  dependent ones*/
     bool fDoSystematics;
 
+    // compiled weight tables, filled at the end of Init()
+    std::vector<double> fTablePtEdges;   //! pT bin edges of the weight histograms
+    std::vector<double> fTableMultEdges; //! multiplicity bin edges of the weight histograms
+    std::vector<int> fTableFlagOffset;   //! start of each SysFlag in fTableWeights; -1 if not compiled
+    std::vector<float> fTableWeights;    //! weights per [flag][particle][mult bin][pT bin], bins incl. under/overflow
+    float fTableMultOrCent;              //! fMultOrCent of fTableMultBin
+    int fTableMultBin;                   //! multiplicity bin of the current event
+
     // functions
     // intern getter
     std::string const GetFunctionFromSysFlag(SysFlag flag) const;           //!
@@ -134,6 +142,11 @@ class AliMCSpectraWeights : public TNamed {
 
     int const CheckAndIdentifyParticle(TParticle* part);
     int const FindBinEntry(float pt, int const part);
+    void CompileWeightTables();
+    bool const IsWeightTableCompiled(SysFlag flag) const;
+    float const GetWeightFromTable(float pt, int const part, SysFlag flag);
+    float const GetWeight(float pt, int const part, SysFlag flag);
+    static int const FindBinInEdges(std::vector<double> const& edges, double x);
     
     // private = to be deleted
     AliMCSpectraWeights(const AliMCSpectraWeights&);//copy
@@ -159,6 +172,12 @@ class AliMCSpectraWeights : public TNamed {
                                                          different particle species */
     float const
     GetMCSpectraWeightSystematics(TParticle* mcGenParticle);
+    void GetMCSpectraWeights(AliMCEvent* mcEvent,
+                             std::vector<float>& weightsNominal,
+                             std::vector<float>& weightsSys); /*!< nominal and systematics
+                                                               weights of all particles of
+                                                               the MC stack, by label;
+                                                               calls StartNewEvent() */
 
     void FillMCSpectra(
         AliMCEvent* mcEvent); /*!< function to fill internal mc spectra for
@@ -196,7 +215,7 @@ class AliMCSpectraWeights : public TNamed {
 
     int const IdentifyMCParticle(TParticle* mcParticle);
 
-    ClassDef(AliMCSpectraWeights, 1);
+    ClassDef(AliMCSpectraWeights, 2);
 };
 
 struct AliMCSpectraWeightsHandler : public TNamed {
@@ -533,3 +533,504 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
 
 template class AliTHnT<TArrayF, Float_t>;
 template class AliTHnT<TArrayD, Double_t>;
+
+//____________________________________________________________________
+// AliTHnBlockT
+//____________________________________________________________________
+
+templateClassImp(AliTHnBlockT)
+
+template <typename TemplateType>
+AliTHnBlockT<TemplateType>::AliTHnBlockT() :
+  AliTHnBase(),
+  fNBins(0),
+  fNVars(0),
+  fNSteps(0),
+  fBlockSize(1024),
+  fBlockSlot(),
+  fValues(),
+  fSumw2(),
+  fHasSumw2(),
+  axisCache(0),
+  fNbinsCache(0),
+  fLastVars(0),
+  fLastBins(0)
+{
+  // Constructor
+}
+
+template <typename TemplateType>
+AliTHnBlockT<TemplateType>::AliTHnBlockT(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) :
+  AliTHnBase(name, title, nSelStep, nVarIn, nBinIn),
+  fNBins(0),
+  fNVars(nVarIn),
+  fNSteps(nSelStep),
+  fBlockSize(1024),
+  fBlockSlot(),
+  fValues(),
+  fSumw2(),
+  fHasSumw2(),
+  axisCache(0),
+  fNbinsCache(0),
+  fLastVars(0),
+  fLastBins(0)
+{
+  // Constructor
+
+  fNBins = 1;
+  for (Int_t i=0; i<fNVars; i++)
+    fNBins *= nBinIn[i];
+
+  Init();
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::Init()
+{
+  // initialize
+
+  fBlockSlot.assign(fNSteps, std::vector<Int_t>());
+  fValues.assign(fNSteps, std::vector<TemplateType>());
+  fSumw2.assign(fNSteps, std::vector<TemplateType>());
+  fHasSumw2.assign(fNSteps, kFALSE);
+}
+
+template <typename TemplateType>
+AliTHnBlockT<TemplateType>::AliTHnBlockT(const AliTHnBlockT &c) :
+  AliTHnBase(c),
+  fNBins(c.fNBins),
+  fNVars(c.fNVars),
+  fNSteps(c.fNSteps),
+  fBlockSize(c.fBlockSize),
+  fBlockSlot(c.fBlockSlot),
+  fValues(c.fValues),
+  fSumw2(c.fSumw2),
+  fHasSumw2(c.fHasSumw2),
+  axisCache(0),
+  fNbinsCache(0),
+  fLastVars(0),
+  fLastBins(0)
+{
+  //
+  // AliTHnBlockT copy constructor
+  //
+}
+
+template <typename TemplateType>
+AliTHnBlockT<TemplateType>::~AliTHnBlockT()
+{
+  // Destructor
+
+  delete[] axisCache;
+  delete[] fNbinsCache;
+  delete[] fLastVars;
+  delete[] fLastBins;
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::DeleteContainers()
+{
+  // delete data containers (the memory is released, not only cleared)
+
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    std::vector<Int_t>().swap(fBlockSlot[i]);
+    std::vector<TemplateType>().swap(fValues[i]);
+    std::vector<TemplateType>().swap(fSumw2[i]);
+    fHasSumw2[i] = kFALSE;
+  }
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+AliTHnBlockT<TemplateType> &AliTHnBlockT<TemplateType>::operator=(const AliTHnBlockT<TemplateType> &c)
+{
+  // assigment operator
+
+  if (this != &c) {
+    AliCFContainer::operator=(c);
+    fNBins=c.fNBins;
+    fNVars=c.fNVars;
+    fNSteps=c.fNSteps;
+    fBlockSize=c.fBlockSize;
+    fBlockSlot=c.fBlockSlot;
+    fValues=c.fValues;
+    fSumw2=c.fSumw2;
+    fHasSumw2=c.fHasSumw2;
+
+    // caches are rebuilt on the next Fill
+    delete [] axisCache;
+    delete [] fNbinsCache;
+    delete [] fLastVars;
+    delete [] fLastBins;
+    axisCache = 0;
+    fNbinsCache = 0;
+    fLastVars = 0;
+    fLastBins = 0;
+  }
+  return *this;
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::Copy(TObject& c) const
+{
+  // copy function
+
+  AliTHnBlockT& target = (AliTHnBlockT &) c;
+
+  AliCFContainer::Copy(target);
+
+  target.fNSteps = fNSteps;
+  target.fNBins = fNBins;
+  target.fNVars = fNVars;
+  target.fBlockSize = fBlockSize;
+  target.fBlockSlot = fBlockSlot;
+  target.fValues = fValues;
+  target.fSumw2 = fSumw2;
+  target.fHasSumw2 = fHasSumw2;
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::SetBlockSize(Int_t blockSize)
+{
+  // sets the number of bins per block, only possible before the first fill
+
+  if (blockSize < 1)
+  {
+    AliError(Form("Invalid block size %d", blockSize));
+    return;
+  }
+
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    if (!fBlockSlot[i].empty())
+    {
+      AliError("Block size cannot be changed after the container has been filled");
+      return;
+    }
+  }
+
+  fBlockSize = blockSize;
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+Long64_t AliTHnBlockT<TemplateType>::GetOffset(Int_t step, Long64_t bin, Bool_t create)
+{
+  // returns the position of global bin <bin> in fValues[step] (and fSumw2[step])
+  // if the block is not allocated yet, it is allocated if <create> is set, otherwise -1 is returned
+
+  std::vector<Int_t>& slots = fBlockSlot[step];
+  if (slots.empty())
+  {
+    if (!create)
+      return -1;
+    slots.assign(GetNBlocks(), -1);
+    AliInfo(Form("Created block table with %lld blocks for step %d", GetNBlocks(), step));
+  }
+
+  Long64_t block = bin / fBlockSize;
+  Int_t slot = slots[block];
+  if (slot < 0)
+  {
+    if (!create)
+      return -1;
+    slot = fValues[step].size() / fBlockSize;
+    slots[block] = slot;
+    fValues[step].resize(fValues[step].size() + fBlockSize, 0);
+    if (fHasSumw2[step])
+      fSumw2[step].resize(fValues[step].size(), 0);
+  }
+
+  return (Long64_t) slot * fBlockSize + bin - block * fBlockSize;
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::AddBin(Int_t step, Long64_t bin, TemplateType value, TemplateType sumw2)
+{
+  // adds <value> (and <sumw2> if sumw2 is stored) to global bin <bin>
+
+  Long64_t offset = GetOffset(step, bin, kTRUE);
+  fValues[step][offset] += value;
+  if (fHasSumw2[step])
+    fSumw2[step][offset] += sumw2;
+}
+
+//____________________________________________________________________
+template <typename TemplateType>
+Long64_t AliTHnBlockT<TemplateType>::Merge(TCollection* list)
+{
+  // Merge a list of AliTHnBlockT objects with this (needed for
+  // PROOF).
+  // Only the allocated blocks of the entries are visited.
+  // Returns the number of merged objects (including this).
+
+  if (!list)
+    return 0;
+
+  if (list->IsEmpty())
+    return 1;
+
+  AliCFContainer::Merge(list);
+
+  TIterator* iter = list->MakeIterator();
+  TObject* obj;
+
+  Int_t count = 0;
+  while ((obj = iter->Next())) {
+
+    AliTHnBlockT* entry = dynamic_cast<AliTHnBlockT*> (obj);
+    if (entry == 0)
+      continue;
+
+    if (entry->fNBins != fNBins || entry->fBlockSize != fBlockSize || entry->fNSteps != fNSteps)
+    {
+      AliError(Form("Cannot merge %s: incompatible binning or block size", entry->GetName()));
+      continue;
+    }
+
+    for (Int_t i=0; i<fNSteps; i++)
+    {
+      const std::vector<Int_t>& entrySlots = entry->fBlockSlot[i];
+      if (entrySlots.empty())
+        continue;
+
+      // entries filled only with weight 1 have sumw2 == values
+      if (entry->fHasSumw2[i] && !fHasSumw2[i])
+      {
+        fSumw2[i] = fValues[i];
+        fHasSumw2[i] = kTRUE;
+      }
+
+      const TemplateType* source = &entry->fValues[i][0];
+      const TemplateType* sourceSumw2 = (entry->fHasSumw2[i]) ? &entry->fSumw2[i][0] : source;
+
+      Long64_t nBlocks = entrySlots.size();
+      for (Long64_t b = 0; b<nBlocks; b++)
+      {
+        if (entrySlots[b] < 0)
+          continue;
+
+        Long64_t offset = GetOffset(i, b * fBlockSize, kTRUE);
+        Long64_t entryOffset = (Long64_t) entrySlots[b] * fBlockSize;
+
+        TemplateType* target = &fValues[i][offset];
+        for (Int_t l = 0; l<fBlockSize; l++)
+          target[l] += source[entryOffset + l];
+
+        if (fHasSumw2[i])
+        {
+          TemplateType* targetSumw2 = &fSumw2[i][offset];
+          for (Int_t l = 0; l<fBlockSize; l++)
+            targetSumw2[l] += sourceSumw2[entryOffset + l];
+        }
+      }
+    }
+
+    count++;
+  }
+
+  delete iter;
+
+  return count+1;
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+{
+  // fills an entry
+
+  // fill axis cache
+  if (!axisCache)
+  {
+    axisCache = new TAxis*[fNVars];
+    fNbinsCache = new Int_t[fNVars];
+    for (Int_t i=0; i<fNVars; i++)
+    {
+      axisCache[i] = GetAxis(i, 0);
+      fNbinsCache[i] = axisCache[i]->GetNbins();
+    }
+
+    fLastVars = new Double_t[fNVars];
+    fLastBins = new Int_t[fNVars];
+
+    // initial values to prevent checking for 0 below
+    for (Int_t i=0; i<fNVars; i++)
+    {
+      fLastBins[i] = axisCache[i]->FindBin(var[i]);
+      fLastVars[i] = var[i];
+    }
+  }
+
+  // calculate global bin index
+  Long64_t bin = 0;
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    bin *= fNbinsCache[i];
+
+    Int_t tmpBin = 0;
+    if (fLastVars[i] == var[i])
+      tmpBin = fLastBins[i];
+    else
+    {
+      tmpBin = axisCache[i]->FindBin(var[i]);
+      fLastBins[i] = tmpBin;
+      fLastVars[i] = var[i];
+    }
+
+    // under/overflow not supported
+    if (tmpBin < 1 || tmpBin > fNbinsCache[i])
+      return;
+
+    // bins start from 0 here
+    bin += tmpBin - 1;
+  }
+
+  if (weight != 1 && !fHasSumw2[istep])
+  {
+    // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+    fSumw2[istep] = fValues[istep];
+    fHasSumw2[istep] = kTRUE;
+    AliInfo(Form("Created sumw2 container for step %d", istep));
+  }
+
+  Long64_t offset = GetOffset(istep, bin, kTRUE);
+  fValues[istep][offset] += weight;
+  if (fHasSumw2[istep])
+    fSumw2[istep][offset] += weight * weight;
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::FillContainer(AliCFContainer* cont)
+{
+  // fills the information stored in the blocks of this class into the container <cont>
+  // blocks are visited in global bin order, i.e. the target is filled in the same order as by AliTHnT
+
+  Int_t* binIdx = new Int_t[fNVars];
+  Int_t* nBins  = new Int_t[fNVars];
+
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    const std::vector<Int_t>& slots = fBlockSlot[i];
+    if (slots.empty())
+      continue;
+
+    const TemplateType* source = &fValues[i][0];
+    // if fSumw2 is not stored, the sqrt of the number of bin entries in source is filled below; otherwise we use fSumw2
+    const TemplateType* sourceSumw2 = (fHasSumw2[i]) ? &fSumw2[i][0] : source;
+
+    THnSparse* target = cont->GetGrid(i)->GetGrid();
+    for (Int_t j=0; j<fNVars; j++)
+      nBins[j] = target->GetAxis(j)->GetNbins();
+
+    Long64_t count = 0;
+    Long64_t nBlocks = slots.size();
+    for (Long64_t b = 0; b<nBlocks; b++)
+    {
+      if (slots[b] < 0)
+        continue;
+
+      Long64_t offset = (Long64_t) slots[b] * fBlockSize;
+      for (Int_t l = 0; l<fBlockSize; l++)
+      {
+        if (source[offset + l] == 0)
+          continue;
+
+        Long64_t globalBin = b * fBlockSize + l;
+        for (Int_t j=fNVars-1; j>=0; j--)
+        {
+          binIdx[j] = globalBin % nBins[j] + 1;
+          globalBin /= nBins[j];
+        }
+
+        target->SetBinContent(binIdx, source[offset + l]);
+        target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[offset + l]));
+
+        count++;
+      }
+    }
+
+    AliInfo(Form("Step %d: copied %lld entries out of %lld bins (%lld allocated)", i, count, fNBins, GetNAllocatedBlocks(i) * fBlockSize));
+  }
+
+  delete[] binIdx;
+  delete[] nBins;
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::FillParent()
+{
+  // fills the information stored in the buffer in this class into the baseclass containers
+
+  FillContainer(this);
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::ReduceAxis()
+{
+  // "removes" the last axis, see ReduceAxis(Int_t)
+
+  ReduceAxis(fNVars-1);
+}
+
+template <typename TemplateType>
+void AliTHnBlockT<TemplateType>::ReduceAxis(Int_t axis)
+{
+  // "removes" axis <axis> by summing over the axis and putting the entry to bin 1
+
+  if (axis < 0 || axis >= fNVars)
+  {
+    AliError(Form("Axis %d does not exist (%d axes)", axis, fNVars));
+    return;
+  }
+
+  // global bins are ordered with the last axis running fastest
+  Long64_t stride = 1;
+  for (Int_t j=fNVars-1; j>axis; j--)
+    stride *= GetAxis(j, 0)->GetNbins();
+  Int_t nBinsAxis = GetAxis(axis, 0)->GetNbins();
+
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    if (fBlockSlot[i].empty())
+      continue;
+
+    // move the current content out and refill the (now smaller) set of blocks
+    std::vector<Int_t> slots;
+    std::vector<TemplateType> values;
+    std::vector<TemplateType> sumw2;
+    slots.swap(fBlockSlot[i]);
+    values.swap(fValues[i]);
+    sumw2.swap(fSumw2[i]);
+
+    const TemplateType* sourceSumw2 = (fHasSumw2[i]) ? &sumw2[0] : 0;
+
+    Long64_t count = 0;
+    Long64_t nBlocks = slots.size();
+    for (Long64_t b = 0; b<nBlocks; b++)
+    {
+      if (slots[b] < 0)
+        continue;
+
+      Long64_t offset = (Long64_t) slots[b] * fBlockSize;
+      for (Int_t l = 0; l<fBlockSize; l++)
+      {
+        if (values[offset + l] == 0 && (!sourceSumw2 || sourceSumw2[offset + l] == 0))
+          continue;
+
+        Long64_t globalBin = b * fBlockSize + l;
+        Long64_t binAxis = (globalBin / stride) % nBinsAxis;
+        AddBin(i, globalBin - binAxis * stride, values[offset + l], (sourceSumw2) ? sourceSumw2[offset + l] : 0);
+        count++;
+      }
+    }
+
+    AliInfo(Form("Step %d: reduced axis %d of %lld filled bins to %lld allocated blocks", i, axis, count, GetNAllocatedBlocks(i)));
+  }
+}
+
+template class AliTHnBlockT<Float_t>;
+template class AliTHnBlockT<Double_t>;
@@ -10,6 +10,7 @@
 // As AliTHn derives from AliCFContainer, you can just replace your current AliCFContainer object by AliTHn
 // Once you have the merged output, call FillParent() and you can use AliCFContainer as usual
 
+#include <vector>
 #include "TObject.h"
 #include "TString.h"
 #include "AliCFContainer.h"
@@ -84,4 +85,69 @@ protected:
 typedef AliTHnT<TArrayF, Float_t> AliTHn;
 typedef AliTHnT<TArrayD, Double_t> AliTHnD;
 
+// block-sparse variant of AliTHnT
+//
+// the bins of a step are split in blocks of fBlockSize consecutive global bins. A block is
+// allocated on first touch, untouched blocks cost only one entry in the block table.
+// Merge and FillParent only visit allocated blocks, which is what matters for containers
+// with 10^8-10^9 mostly empty bins per step. Fill/FillParent/ReduceAxis behave as in AliTHnT,
+// ReduceAxis(Int_t) in addition sums over any axis.
+// GetValues/GetSumw2 are not available (there is no dense array) and return 0.
+
+template <typename TemplateType>
+class AliTHnBlockT : public AliTHnBase
+{
+ public:
+  AliTHnBlockT();
+  AliTHnBlockT(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn);
+
+  virtual ~AliTHnBlockT();
+
+  virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillParent();
+  virtual void FillContainer(AliCFContainer* cont);
+
+  virtual TArray* GetValues(Int_t /*step*/) { return 0; }
+  virtual TArray* GetSumw2(Int_t /*step*/)  { return 0; }
+
+  virtual void DeleteContainers();
+  virtual void ReduceAxis();
+  void         ReduceAxis(Int_t axis);
+
+  void     SetBlockSize(Int_t blockSize);
+  Int_t    GetBlockSize() const { return fBlockSize; }
+  Long64_t GetNAllocatedBlocks(Int_t step) const { return (Long64_t) fValues[step].size() / fBlockSize; }
+
+  AliTHnBlockT(const AliTHnBlockT &c);
+  AliTHnBlockT& operator=(const AliTHnBlockT& corr);
+  virtual void Copy(TObject& c) const;
+
+  virtual Long64_t Merge(TCollection* list);
+
+protected:
+  void Init();
+  Long64_t GetNBlocks() const { return (fNBins + fBlockSize - 1) / fBlockSize; }
+  Long64_t GetOffset(Int_t step, Long64_t bin, Bool_t create);
+  void     AddBin(Int_t step, Long64_t bin, TemplateType value, TemplateType sumw2);
+
+  Long64_t fNBins;      // number of total bins
+  Int_t    fNVars;      // number of variables
+  Int_t    fNSteps;     // number of selection steps
+  Int_t    fBlockSize;  // number of bins per block
+  std::vector<std::vector<Int_t> > fBlockSlot;         // [step][block] slot of the block in fValues[step], -1 if not allocated
+  std::vector<std::vector<TemplateType> > fValues;     // [step] allocated blocks, one after the other in slot order
+  std::vector<std::vector<TemplateType> > fSumw2;      // [step] same layout as fValues, only filled if fHasSumw2[step]
+  std::vector<Bool_t> fHasSumw2;                       // [step] sumw2 is stored (a weight != 1 was filled)
+
+  TAxis** axisCache; //! cache axis pointers
+  Int_t* fNbinsCache; //! cache Nbins per axis
+  Double_t* fLastVars; //! caching of last used bins
+  Int_t* fLastBins; //! caching of last used bins
+
+  ClassDef(AliTHnBlockT, 1) // block-sparse THn like container
+};
+
+typedef AliTHnBlockT<Float_t> AliTHnBlock;
+typedef AliTHnBlockT<Double_t> AliTHnBlockD;
+
 #endif
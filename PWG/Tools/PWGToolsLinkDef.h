@@ -19,6 +19,10 @@
 #pragma link C++ class AliTHnBase+;
 #pragma link C++ class AliTHnT<TArrayF, Float_t>+;
 #pragma link C++ class AliTHnT<TArrayD, Double_t>+;
+#pragma link C++ typedef AliTHnBlock;
+#pragma link C++ typedef AliTHnBlockD;
+#pragma link C++ class AliTHnBlockT<Float_t>+;
+#pragma link C++ class AliTHnBlockT<Double_t>+;
 #pragma link C++ class THistManager+;
 #pragma link C++ class AliJSONReader+;
 #pragma link C++ class AliJSONData+;
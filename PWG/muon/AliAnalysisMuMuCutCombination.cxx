@@ -28,7 +28,8 @@ AliAnalysisMuMuCutCombination::AliAnalysisMuMuCutCombination()
 : TObject(), fCuts(0x0), fName(""),
 fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE),
-fIsTriggerClassCutter(kFALSE)
+fIsTriggerClassCutter(kFALSE), fHasCutMasks(kFALSE),
+fEventMask(), fTrackMask(), fTrackPairMask()
 {
   /// Default ctor.
 }
@@ -62,6 +63,7 @@ void AliAnalysisMuMuCutCombination::Add(AliAnalysisMuMuCutElement* ce)
 
   if (!fCuts->FindObject(ce))
   {
+    fHasCutMasks = kFALSE;
     fCuts->Add(ce);
     fName += ce->GetName();
 
@@ -315,6 +317,110 @@ Bool_t AliAnalysisMuMuCutCombination::Pass(const TString& firedTriggerClasses,
   return rv;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutCombination::SetCutMasks(const TObjArray& eventCuts,
+                                                const TObjArray& trackCuts,
+                                                const TObjArray& trackPairCuts)
+{
+  /** Compute the bit masks of this combination, i.e. for each of our cut elements its
+   * index in the array of cut elements of the same type (those arrays are the ones
+   * of the cut registry, in the same order as used by AliAnalysisMuMuCutRegistry::EvaluateCuts).
+   * Equal cut elements share the same bit.
+   */
+
+  fEventMask.assign((eventCuts.GetEntriesFast()+63)/64,0);
+  fTrackMask.assign((trackCuts.GetEntriesFast()+63)/64,0);
+  fTrackPairMask.assign((trackPairCuts.GetEntriesFast()+63)/64,0);
+  fHasCutMasks = kTRUE;
+
+  if (!fCuts) return;
+
+  TIter next(fCuts);
+  AliAnalysisMuMuCutElement* ce;
+
+  while ( ( ce = static_cast<AliAnalysisMuMuCutElement*>(next()) ) )
+  {
+    const TObjArray* cuts(0x0);
+    AliAnalysisMuMuCutElement::CutBits* mask(0x0);
+
+    if ( ce->IsEventCutter() || ce->IsEventHandlerCutter() )
+    {
+      cuts = &eventCuts;
+      mask = &fEventMask;
+    }
+    else if ( ce->IsTrackCutter() )
+    {
+      cuts = &trackCuts;
+      mask = &fTrackMask;
+    }
+    else if ( ce->IsTrackPairCutter() )
+    {
+      cuts = &trackPairCuts;
+      mask = &fTrackPairMask;
+    }
+    else
+    {
+      continue;
+    }
+
+    Int_t index = cuts->IndexOf(ce);
+
+    if ( index < 0 )
+    {
+      // cut element not known to the registry : can only use the regular Pass methods
+      fHasCutMasks = kFALSE;
+      continue;
+    }
+
+    (*mask)[index/64] |= (1ULL << (index%64));
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::IsSubset(const AliAnalysisMuMuCutElement::CutBits& mask,
+                                               const AliAnalysisMuMuCutElement::CutBits& bits)
+{
+  /// Whether all the bits of mask are set in bits
+  for ( std::size_t i = 0; i < mask.size(); ++i )
+  {
+    ULong64_t b = ( i < bits.size() ) ? bits[i] : 0;
+    if ( ( b & mask[i] ) != mask[i] ) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::PassEventBits(const AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /// Same as Pass(const AliVEventHandler&), using the event cut results in bits
+
+  if (!fCuts) return kFALSE;
+
+  if ( !IsEventCutter() && !IsEventHandlerCutter() ) return kFALSE;
+
+  return IsSubset(fEventMask,bits);
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::PassTrackBits(const AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /// Same as Pass(const AliVParticle&), using the track cut results in bits
+
+  if (!fCuts) return kFALSE;
+
+  return IsSubset(fTrackMask,bits);
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::PassTrackPairBits(const AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /// Same as Pass(const AliVParticle&, const AliVParticle&), using the track pair cut results in bits
+
+  if (!fCuts) return kFALSE;
+
+  return IsSubset(fTrackPairMask,bits);
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuCutCombination::Print(Option_t* opt) const
 {
@@ -12,8 +12,9 @@
 
 #include "TObject.h"
 #include "TString.h"
+#include "AliAnalysisMuMuCutElement.h"
 
-class AliAnalysisMuMuCutElement;
+class TObjArray;
 class AliVEvent;
 class AliVEventHandler;
 class AliVParticle;
@@ -35,6 +36,18 @@ public:
   Bool_t Pass(const TString& firedTriggerClasses, TString& acceptedTriggerClasses,
               UInt_t L0, UInt_t L1, UInt_t L2) const;
 
+  /// Bit mask versions of the Pass methods, using the cut results of
+  /// AliAnalysisMuMuCutRegistry::EvaluateCuts (only valid if HasCutMasks())
+  Bool_t PassEventBits(const AliAnalysisMuMuCutElement::CutBits& bits) const;
+
+  Bool_t PassTrackBits(const AliAnalysisMuMuCutElement::CutBits& bits) const;
+
+  Bool_t PassTrackPairBits(const AliAnalysisMuMuCutElement::CutBits& bits) const;
+
+  void SetCutMasks(const TObjArray& eventCuts, const TObjArray& trackCuts, const TObjArray& trackPairCuts);
+
+  Bool_t HasCutMasks() const { return fHasCutMasks; }
+
   const char* GetName() const { return fName.Data(); }
 
   Bool_t IsEventCutter() const { return fIsEventCutter; }
@@ -55,6 +68,8 @@ private:
   /// not implemented on purpose
   AliAnalysisMuMuCutCombination& operator=(const AliAnalysisMuMuCutCombination& rhs);
 
+  static Bool_t IsSubset(const AliAnalysisMuMuCutElement::CutBits& mask, const AliAnalysisMuMuCutElement::CutBits& bits);
+
 private:
   TObjArray* fCuts; // array of cut elements that form this cut combination
   TString fName; // name of the combination
@@ -63,8 +78,12 @@ private:
   Bool_t fIsTrackCutter; // whether or not the combination cuts on track
   Bool_t fIsTrackPairCutter; // whether or not the combination cuts on track pairs
   Bool_t fIsTriggerClassCutter; // whether or not the combination cuts on trigger class
+  Bool_t fHasCutMasks; //! whether the masks below are valid
+  AliAnalysisMuMuCutElement::CutBits fEventMask; //! positions of our cuts among the event cut elements
+  AliAnalysisMuMuCutElement::CutBits fTrackMask; //! positions of our cuts among the track cut elements
+  AliAnalysisMuMuCutElement::CutBits fTrackPairMask; //! positions of our cuts among the track pair cut elements
 
-  ClassDef(AliAnalysisMuMuCutCombination,1) // combination of 1 or more individual cuts
+  ClassDef(AliAnalysisMuMuCutCombination,2) // combination of 1 or more individual cuts
 };
 
 #endif
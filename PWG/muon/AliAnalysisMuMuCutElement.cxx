@@ -29,7 +29,8 @@ AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement()
 : TObject(), fName(""), fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(0x0), fCutMethodName(""), fCutMethodPrototype(""),
-fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fEventFunction(), fEventHandlerFunction(), fTrackFunction(), fTrackPairFunction()
 {
   /// Default ctor, leading to an invalid cut object
 }
@@ -44,7 +45,8 @@ AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement(ECutType expectedType,
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(&cutObject), fCutMethodName(cutMethodName),
 fCutMethodPrototype(cutMethodPrototype),fDefaultParameters(defaultParameters),
-fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fEventFunction(), fEventHandlerFunction(), fTrackFunction(), fTrackPairFunction()
 {
   /**
    * Construct a cut, which is a proxy to another method of (most probably) another object
@@ -108,6 +110,66 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p1, Long_t p2) const
   return (result!=0);
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutElement::SetCutFunction(EventCutFunction f)
+{
+  /** Bind a typed callable doing the same work as the cut method, so that
+   * Pass(const AliVEvent&) does not go through TMethodCall anymore.
+   * The callable must encapsulate the cut object and the default parameters of the
+   * cut method. The name of the cut is still the one given by the NameOfXXX method.
+   */
+
+  if ( !IsEventCutter() )
+  {
+    AliError(Form("Cut %s is not an event cutter. Cut function not bound",GetName()));
+    return kFALSE;
+  }
+  fEventFunction = f;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutElement::SetCutFunction(EventHandlerCutFunction f)
+{
+  /// Bind a typed callable for Pass(const AliVEventHandler&). See SetCutFunction(EventCutFunction)
+
+  if ( !IsEventHandlerCutter() )
+  {
+    AliError(Form("Cut %s is not an event handler cutter. Cut function not bound",GetName()));
+    return kFALSE;
+  }
+  fEventHandlerFunction = f;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutElement::SetCutFunction(TrackCutFunction f)
+{
+  /// Bind a typed callable for Pass(const AliVParticle&). See SetCutFunction(EventCutFunction)
+
+  if ( !IsTrackCutter() )
+  {
+    AliError(Form("Cut %s is not a track cutter. Cut function not bound",GetName()));
+    return kFALSE;
+  }
+  fTrackFunction = f;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutElement::SetCutFunction(TrackPairCutFunction f)
+{
+  /// Bind a typed callable for Pass(const AliVParticle&, const AliVParticle&). See SetCutFunction(EventCutFunction)
+
+  if ( !IsTrackPairCutter() )
+  {
+    AliError(Form("Cut %s is not a track pair cutter. Cut function not bound",GetName()));
+    return kFALSE;
+  }
+  fTrackPairFunction = f;
+  return kTRUE;
+}
+
 //_____________________________________________________________________________
 Int_t AliAnalysisMuMuCutElement::CountOccurences(const TString& prototype, const char* search) const
 {
@@ -475,6 +537,7 @@ Bool_t AliAnalysisMuMuCutElement::IsEqual(const TObject* obj) const
 Bool_t AliAnalysisMuMuCutElement::Pass(const AliVEvent& event) const
 {
   /// Whether the event pass this cut
+  if ( fEventFunction ) return fEventFunction(event);
   return CallCutMethod(reinterpret_cast<Long_t>(&event));
 }
 
@@ -482,6 +545,7 @@ Bool_t AliAnalysisMuMuCutElement::Pass(const AliVEvent& event) const
 Bool_t AliAnalysisMuMuCutElement::Pass(const AliVEventHandler& eventHandler) const
 {
   /// Whether the eventHandler pass this cut
+  if ( fEventHandlerFunction ) return fEventHandlerFunction(eventHandler);
   return CallCutMethod(reinterpret_cast<Long_t>(&eventHandler));
 }
 
@@ -489,6 +553,7 @@ Bool_t AliAnalysisMuMuCutElement::Pass(const AliVEventHandler& eventHandler) con
 Bool_t AliAnalysisMuMuCutElement::Pass(const AliVParticle& part) const
 {
   /// Whether the particle pass this cut
+  if ( fTrackFunction ) return fTrackFunction(part);
   return CallCutMethod(reinterpret_cast<Long_t>(&part));
 }
 
@@ -496,6 +561,7 @@ Bool_t AliAnalysisMuMuCutElement::Pass(const AliVParticle& part) const
 Bool_t AliAnalysisMuMuCutElement::Pass(const AliVParticle& p1, const AliVParticle& p2) const
 {
   /// Whether the particle pair pass this cut
+  if ( fTrackPairFunction ) return fTrackPairFunction(p1,p2);
   return CallCutMethod(reinterpret_cast<Long_t>(&p1),reinterpret_cast<Long_t>(&p2));
 }
 
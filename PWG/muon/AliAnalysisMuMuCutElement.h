@@ -13,6 +13,7 @@
 #include "TString.h"
 
 #include <vector>
+#include <functional>
 
 class TMethodCall;
 class AliVEvent;
@@ -34,6 +35,15 @@ public:
 
   static const char* CutTypeName(ECutType type);
 
+  /// Typed callables that can be bound to a cut element to bypass the TMethodCall dispatch
+  typedef std::function<Bool_t(const AliVEvent&)> EventCutFunction;
+  typedef std::function<Bool_t(const AliVEventHandler&)> EventHandlerCutFunction;
+  typedef std::function<Bool_t(const AliVParticle&)> TrackCutFunction;
+  typedef std::function<Bool_t(const AliVParticle&, const AliVParticle&)> TrackPairCutFunction;
+
+  /// Bitset of cut results (one bit per cut element of a given type, see AliAnalysisMuMuCutRegistry::EvaluateCuts)
+  typedef std::vector<ULong64_t> CutBits;
+
   AliAnalysisMuMuCutElement();
 
   AliAnalysisMuMuCutElement(ECutType expectedType,
@@ -61,6 +71,14 @@ public:
 
   virtual void Print(Option_t* opt="") const;
 
+  Bool_t SetCutFunction(EventCutFunction f);
+  Bool_t SetCutFunction(EventHandlerCutFunction f);
+  Bool_t SetCutFunction(TrackCutFunction f);
+  Bool_t SetCutFunction(TrackPairCutFunction f);
+
+  /// Whether a typed callable is bound to this cut
+  Bool_t HasCutFunction() const { return fEventFunction || fEventHandlerFunction || fTrackFunction || fTrackPairFunction; }
+
   Bool_t IsEventCutter() const { return fIsEventCutter; }
   Bool_t IsEventHandlerCutter() const { return fIsEventHandlerCutter; }
   Bool_t IsTrackCutter() const { return fIsTrackCutter; }
@@ -109,7 +127,12 @@ private:
   mutable std::vector<Long_t> fCallParams; //! vector of parameters for the fCutMethod
   mutable std::vector<Double_t> fDoubleParams; //! temporary vector to hold the references
 
-  ClassDef(AliAnalysisMuMuCutElement,1) // One piece of a cut combination
+  EventCutFunction fEventFunction; //! typed event cut (if bound)
+  EventHandlerCutFunction fEventHandlerFunction; //! typed event handler cut (if bound)
+  TrackCutFunction fTrackFunction; //! typed track cut (if bound)
+  TrackPairCutFunction fTrackPairFunction; //! typed track pair cut (if bound)
+
+  ClassDef(AliAnalysisMuMuCutElement,2) // One piece of a cut combination
 };
 
 class AliAnalysisMuMuCutElementBar : public AliAnalysisMuMuCutElement
@@ -29,6 +29,8 @@
 #include "AliLog.h"
 #include "TMethodCall.h"
 #include "AliVEvent.h"
+#include "AliVEventHandler.h"
+#include "AliVParticle.h"
 #include <set>
 #include "AliAnalysisMuMuCutElement.h"
 #include "AliAnalysisMuMuCutCombination.h"
@@ -42,7 +44,8 @@ ClassImp(AliAnalysisMuMuCutRegistry)
 AliAnalysisMuMuCutRegistry::AliAnalysisMuMuCutRegistry()
 : TObject(),
 fCutElements(0x0),
-fCutCombinations(0x0)
+fCutCombinations(0x0),
+fCutMasksReady(kFALSE)
 {
   /// ctor
 }
@@ -83,6 +86,8 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(const TObjArray& cutElements
 
   GetCutCombinations(AliAnalysisMuMuCutElement::kAny)->Add(cutCombination);
 
+  fCutMasksReady = kFALSE;
+
   if ( cutCombination->IsEventCutter() || cutCombination->IsEventHandlerCutter() )
   {
     GetCutCombinations(AliAnalysisMuMuCutElement::kEvent)->Add(cutCombination);
@@ -232,6 +237,7 @@ AliAnalysisMuMuCutRegistry::AddCutElement(AliAnalysisMuMuCutElement* ce)
   {
     if (!GetCutElements(AliAnalysisMuMuCutElement::kAny)->FindObject(ce))
     {
+      fCutMasksReady = kFALSE;
       GetCutElements(AliAnalysisMuMuCutElement::kAny)->Add(ce);
       if ( ce->IsEventCutter() || ce->IsEventHandlerCutter() )
       {
@@ -299,6 +305,154 @@ AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::AddTriggerClassCut(TObjec
                           cutMethodPrototype,defaultParameters);
 }
 
+//_____________________________________________________________________________
+AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::AddEventCut(TObject& cutClass,
+                                       const char* cutMethodName,
+                                       const char* cutMethodPrototype,
+                                       const char* defaultParameters,
+                                       AliAnalysisMuMuCutElement::EventCutFunction cutFunction)
+{
+  /** Create a cut element of type kEvent, evaluated with cutFunction.
+   * The method name and prototype are still used to name and type the cut (and as a fallback
+   * if the cut function is lost, e.g. when the registry is read back from a file)
+   */
+  AliAnalysisMuMuCutElement* ce = AddEventCut(cutClass,cutMethodName,cutMethodPrototype,defaultParameters);
+  if ( ce ) ce->SetCutFunction(cutFunction);
+  return ce;
+}
+
+//_____________________________________________________________________________
+AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::AddEventCut(TObject& cutClass,
+                                       const char* cutMethodName,
+                                       const char* cutMethodPrototype,
+                                       const char* defaultParameters,
+                                       AliAnalysisMuMuCutElement::EventHandlerCutFunction cutFunction)
+{
+  /// Create a cut element of type kEvent (on event handler), evaluated with cutFunction
+  AliAnalysisMuMuCutElement* ce = AddEventCut(cutClass,cutMethodName,cutMethodPrototype,defaultParameters);
+  if ( ce ) ce->SetCutFunction(cutFunction);
+  return ce;
+}
+
+//_____________________________________________________________________________
+AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::AddTrackCut(TObject& cutClass,
+                                       const char* cutMethodName,
+                                       const char* cutMethodPrototype,
+                                       const char* defaultParameters,
+                                       AliAnalysisMuMuCutElement::TrackCutFunction cutFunction)
+{
+  /// Create a cut element of type kTrack, evaluated with cutFunction
+  AliAnalysisMuMuCutElement* ce = AddTrackCut(cutClass,cutMethodName,cutMethodPrototype,defaultParameters);
+  if ( ce ) ce->SetCutFunction(cutFunction);
+  return ce;
+}
+
+//_____________________________________________________________________________
+AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::AddTrackPairCut(TObject& cutClass,
+                                        const char* cutMethodName,
+                                        const char* cutMethodPrototype,
+                                        const char* defaultParameters,
+                                        AliAnalysisMuMuCutElement::TrackPairCutFunction cutFunction)
+{
+  /// Create a cut element of type kTrackPair, evaluated with cutFunction
+  AliAnalysisMuMuCutElement* ce = AddTrackPairCut(cutClass,cutMethodName,cutMethodPrototype,defaultParameters);
+  if ( ce ) ce->SetCutFunction(cutFunction);
+  return ce;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::UpdateCutMasks() const
+{
+  /// (Re)compute the bit masks of all the cut combinations, i.e. the positions of
+  /// their cut elements in the per-type arrays of cut elements
+
+  if ( fCutMasksReady ) return;
+
+  AliAnalysisMuMuCutRegistry* self = const_cast<AliAnalysisMuMuCutRegistry*>(this);
+
+  TIter next(self->GetCutCombinations(AliAnalysisMuMuCutElement::kAny));
+  AliAnalysisMuMuCutCombination* cutCombination;
+
+  while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(next()) ) )
+  {
+    cutCombination->SetCutMasks(*(self->GetCutElements(AliAnalysisMuMuCutElement::kEvent)),
+                                *(self->GetCutElements(AliAnalysisMuMuCutElement::kTrack)),
+                                *(self->GetCutElements(AliAnalysisMuMuCutElement::kTrackPair)));
+  }
+
+  fCutMasksReady = kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::EvaluateCuts(const AliVEventHandler& eventHandler,
+                                              AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /** Evaluate all the event cut elements for this event, so that each elementary cut
+   * is called only once whatever the number of cut combinations it is part of.
+   * The result is to be used with AliAnalysisMuMuCutCombination::PassEventBits
+   */
+
+  UpdateCutMasks();
+
+  const TObjArray* cuts = GetCutElements(AliAnalysisMuMuCutElement::kEvent);
+  Int_t n = cuts ? cuts->GetEntriesFast() : 0;
+
+  bits.assign((n+63)/64,0);
+
+  const AliVEvent* event = eventHandler.GetEvent();
+
+  for ( Int_t i = 0; i < n; ++i )
+  {
+    const AliAnalysisMuMuCutElement* ce = static_cast<const AliAnalysisMuMuCutElement*>(cuts->UncheckedAt(i));
+    Bool_t pass = ce->IsEventCutter() ? ( event && ce->Pass(*event) ) : ce->Pass(eventHandler);
+    if ( pass ) bits[i/64] |= (1ULL << (i%64));
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::EvaluateCuts(const AliVParticle& particle,
+                                              AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /// Evaluate all the track cut elements for this particle (see AliAnalysisMuMuCutCombination::PassTrackBits)
+
+  UpdateCutMasks();
+
+  const TObjArray* cuts = GetCutElements(AliAnalysisMuMuCutElement::kTrack);
+  Int_t n = cuts ? cuts->GetEntriesFast() : 0;
+
+  bits.assign((n+63)/64,0);
+
+  for ( Int_t i = 0; i < n; ++i )
+  {
+    if ( static_cast<const AliAnalysisMuMuCutElement*>(cuts->UncheckedAt(i))->Pass(particle) )
+    {
+      bits[i/64] |= (1ULL << (i%64));
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::EvaluateCuts(const AliVParticle& p1, const AliVParticle& p2,
+                                              AliAnalysisMuMuCutElement::CutBits& bits) const
+{
+  /// Evaluate all the track pair cut elements for this pair (see AliAnalysisMuMuCutCombination::PassTrackPairBits)
+
+  UpdateCutMasks();
+
+  const TObjArray* cuts = GetCutElements(AliAnalysisMuMuCutElement::kTrackPair);
+  Int_t n = cuts ? cuts->GetEntriesFast() : 0;
+
+  bits.assign((n+63)/64,0);
+
+  for ( Int_t i = 0; i < n; ++i )
+  {
+    if ( static_cast<const AliAnalysisMuMuCutElement*>(cuts->UncheckedAt(i))->Pass(p1,p2) )
+    {
+      bits[i/64] |= (1ULL << (i%64));
+    }
+  }
+}
+
 //_____________________________________________________________________________
 const TObjArray* AliAnalysisMuMuCutRegistry::GetCutCombinations(AliAnalysisMuMuCutElement::ECutType type) const
 {
@@ -48,6 +48,31 @@ public:
                                                 const char* cutMethodPrototype,
                                                 const char* defaultParameters);
 
+  /// Same as above, but the cut is evaluated through a typed callable instead of TMethodCall
+  AliAnalysisMuMuCutElement* AddEventCut(TObject& cutClass,
+                                         const char* cutMethodName,
+                                         const char* cutMethodPrototype,
+                                         const char* defaultParameters,
+                                         AliAnalysisMuMuCutElement::EventCutFunction cutFunction);
+
+  AliAnalysisMuMuCutElement* AddEventCut(TObject& cutClass,
+                                         const char* cutMethodName,
+                                         const char* cutMethodPrototype,
+                                         const char* defaultParameters,
+                                         AliAnalysisMuMuCutElement::EventHandlerCutFunction cutFunction);
+
+  AliAnalysisMuMuCutElement* AddTrackCut(TObject& cutClass,
+                                         const char* cutMethodName,
+                                         const char* cutMethodPrototype,
+                                         const char* defaultParameters,
+                                         AliAnalysisMuMuCutElement::TrackCutFunction cutFunction);
+
+  AliAnalysisMuMuCutElement* AddTrackPairCut(TObject& cutClass,
+                                             const char* cutMethodName,
+                                             const char* cutMethodPrototype,
+                                             const char* defaultParameters,
+                                             AliAnalysisMuMuCutElement::TrackPairCutFunction cutFunction);
+
   AliAnalysisMuMuCutElement* Not(const AliAnalysisMuMuCutElement& cutElement);
 
   AliAnalysisMuMuCutElement* AddCutElement(AliAnalysisMuMuCutElement* ce);
@@ -72,6 +97,13 @@ public:
   const TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type) const;
   TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type);
 
+  /// Evaluate each event (and event handler) cut element once, one bit per element
+  void EvaluateCuts(const AliVEventHandler& eventHandler, AliAnalysisMuMuCutElement::CutBits& bits) const;
+  /// Evaluate each track cut element once, one bit per element
+  void EvaluateCuts(const AliVParticle& particle, AliAnalysisMuMuCutElement::CutBits& bits) const;
+  /// Evaluate each track pair cut element once, one bit per element
+  void EvaluateCuts(const AliVParticle& p1, const AliVParticle& p2, AliAnalysisMuMuCutElement::CutBits& bits) const;
+
   virtual void Print(Option_t* opt="") const;
 
   Bool_t AlwaysTrue(const AliVEvent& /*event*/) const { return kTRUE; }
@@ -93,12 +125,15 @@ private:
                                               const char* cutMethodPrototype,
                                               const char* defaultParameters);
 
+  void UpdateCutMasks() const;
+
 private:
 
   mutable TObjArray* fCutElements; // cut elements
   mutable TObjArray* fCutCombinations; // cut combinations
+  mutable Bool_t fCutMasksReady; //! whether the cut combination masks are up-to-date
 
-  ClassDef(AliAnalysisMuMuCutRegistry,1) // storage for cut pointers
+  ClassDef(AliAnalysisMuMuCutRegistry,2) // storage for cut pointers
 };
 
 #endif
@@ -90,7 +90,12 @@ fDisableHistoLoop(kFALSE),
 fLegacyCentrality(kFALSE),
 fPool(0x0),
 fMaxPoolSize(0),
-fMix(kFALSE)
+fMix(kFALSE),
+fEventCutBits(),
+fCutBitsMuonIndex(),
+fTrackCutBits(),
+fTrackPairCutBits(),
+fNofCutBitsMuons(0)
 {
   /// Constructor with a predefined list of triggers to consider
   /// Note that we take ownership of cutRegister
@@ -417,7 +422,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
         // Loop on all track selections and fill histos for track that pass it
         while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
         {
-          if ( trackCut->Pass(*tracki) )
+          if ( PassTrack(*trackCut,*tracki,i) )
           {
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
             analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
@@ -440,9 +445,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
           while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
           {
             // Weither or not the pairs pass the tests
-            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
+            Bool_t testi  = (pairCut->IsTrackCutter()) ? PassTrack(*pairCut,*tracki,i) : kTRUE;
+            Bool_t testj  = (pairCut->IsTrackCutter()) ? PassTrack(*pairCut,*trackj,j) : kTRUE;
+            Bool_t testij = PassTrackPair(*pairCut,*tracki,i,*trackj,j);
 
             if ( ( testi && testj ) && testij )
             {
@@ -478,7 +483,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
               trackj = static_cast<AliVParticle*>(currentPool->At(iTrack2));
 
               // Weither or not the pairs pass the tests
-              Bool_t testi  = trackCut->Pass(*tracki);
+              Bool_t testi  = PassTrack(*trackCut,*tracki,i);
               Bool_t testj  = trackCut->Pass(*trackj);
               Bool_t testij = pairCut->Pass(*tracki,*trackj);
 
@@ -491,6 +496,90 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   }
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskMuMu::EvaluateCutBits()
+{
+  /// Evaluate all the elementary cuts of the cut registry once for the current event,
+  /// its muon tracks and its muon track pairs. The cut combinations are then
+  /// resolved as bit mask tests (see PassEvent, PassTrack and PassTrackPair)
+
+  CutRegistry()->EvaluateCuts(*fInputHandler,fEventCutBits);
+
+  fNofCutBitsMuons = 0;
+  fCutBitsMuonIndex.clear();
+
+  if ( IsHistogrammingDisabled() || fDisableHistoLoop ) return;
+
+  Int_t nTracks = AliAnalysisMuonUtility::GetNTracks(Event());
+
+  fCutBitsMuonIndex.assign(nTracks,-1);
+
+  std::vector<AliVParticle*> muons;
+
+  for ( Int_t i = 0; i < nTracks; ++i )
+  {
+    AliVParticle* track = AliAnalysisMuonUtility::GetTrack(i,Event());
+    if ( !AliAnalysisMuonUtility::IsMuonTrack(track) ) continue;
+    fCutBitsMuonIndex[i] = muons.size();
+    muons.push_back(track);
+  }
+
+  fNofCutBitsMuons = muons.size();
+
+  if ( (Int_t)fTrackCutBits.size() < fNofCutBitsMuons ) fTrackCutBits.resize(fNofCutBitsMuons);
+  if ( (Int_t)fTrackPairCutBits.size() < fNofCutBitsMuons*fNofCutBitsMuons ) fTrackPairCutBits.resize(fNofCutBitsMuons*fNofCutBitsMuons);
+
+  for ( Int_t i = 0; i < fNofCutBitsMuons; ++i )
+  {
+    CutRegistry()->EvaluateCuts(*muons[i],fTrackCutBits[i]);
+
+    for ( Int_t j = i+1; j < fNofCutBitsMuons; ++j )
+    {
+      CutRegistry()->EvaluateCuts(*muons[i],*muons[j],fTrackPairCutBits[i*fNofCutBitsMuons+j]);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskMuMu::PassEvent(const AliAnalysisMuMuCutCombination& cutCombination) const
+{
+  /// Whether the current event passes the event cut combination (from CutRegistry())
+  if ( cutCombination.HasCutMasks() ) return cutCombination.PassEventBits(fEventCutBits);
+  return cutCombination.Pass(*fInputHandler);
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskMuMu::PassTrack(const AliAnalysisMuMuCutCombination& cutCombination,
+                                      const AliVParticle& track, Int_t itrack) const
+{
+  /// Whether the event track number itrack passes the cut combination (from CutRegistry())
+
+  Int_t imuon = ( itrack >= 0 && itrack < (Int_t)fCutBitsMuonIndex.size() ) ? fCutBitsMuonIndex[itrack] : -1;
+
+  if ( imuon >= 0 && cutCombination.HasCutMasks() ) return cutCombination.PassTrackBits(fTrackCutBits[imuon]);
+
+  return cutCombination.Pass(track);
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskMuMu::PassTrackPair(const AliAnalysisMuMuCutCombination& cutCombination,
+                                          const AliVParticle& p1, Int_t itrack1,
+                                          const AliVParticle& p2, Int_t itrack2) const
+{
+  /// Whether the pair of event tracks itrack1 < itrack2 passes the cut combination (from CutRegistry())
+
+  Int_t n = fCutBitsMuonIndex.size();
+  Int_t imuon1 = ( itrack1 >= 0 && itrack1 < n ) ? fCutBitsMuonIndex[itrack1] : -1;
+  Int_t imuon2 = ( itrack2 >= 0 && itrack2 < n ) ? fCutBitsMuonIndex[itrack2] : -1;
+
+  if ( imuon1 >= 0 && imuon2 > imuon1 && cutCombination.HasCutMasks() )
+  {
+    return cutCombination.PassTrackPairBits(fTrackPairCutBits[imuon1*fNofCutBitsMuons+imuon2]);
+  }
+
+  return cutCombination.Pass(p1,p2);
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskMuMu::FillPoolsWithTracks(const char* eventSelection,
                                              const char* triggerClassName,
@@ -891,6 +980,9 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
     analysis->SetEvent(Event(),MCEvent()); // Set the new event properties derived in the analysis
   }
 
+  // evaluate each elementary cut once for this event (and its tracks)
+  EvaluateCutBits();
+
   TString firedTriggerClasses(Event()->GetFiredTriggerClasses());
 
   TIter nextEventCutCombination(CutRegistry()->GetCutCombinations(AliAnalysisMuMuCutElement::kEvent));
@@ -901,7 +993,7 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
 
   // loop over cut combination on event level. Fill counters
   while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(nextEventCutCombination()))){
-    if ( cutCombination->Pass(*fInputHandler) )
+    if ( PassEvent(*cutCombination) )
     {
       // Fill counters
       FillCounters(cutCombination->GetName(), "EVERYTHING",  "ALL", fCurrentRunNumber);
@@ -923,7 +1015,7 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
     nextEventCutCombination.Reset();
 
     while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(nextEventCutCombination())) ){
-      if ( cutCombination->Pass(*fInputHandler) ) Fill(cutCombination->GetName(),tname->String().Data());
+      if ( PassEvent(*cutCombination) ) Fill(cutCombination->GetName(),tname->String().Data());
     }
   }
 
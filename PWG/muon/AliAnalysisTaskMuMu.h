@@ -31,6 +31,9 @@
 #  include "TMath.h"
 #endif
 
+#include <vector>
+#include "AliAnalysisMuMuCutElement.h"
+
 class AliAnalysisMuMuBinning;
 class AliCounterCollection;
 class AliMergeableCollection;
@@ -39,6 +42,7 @@ class TList;
 class TObjArray;
 class AliAnalysisMuMuBase;
 class AliAnalysisMuMuCutRegistry;
+class AliAnalysisMuMuCutCombination;
 class AliMultiInputEventHandler;
 class AliMixInputEventHandler;
 class AliAnalysisManager;
@@ -130,6 +134,16 @@ private:
 
   Bool_t IsPP() const;
 
+  void EvaluateCutBits();
+
+  Bool_t PassEvent(const AliAnalysisMuMuCutCombination& cutCombination) const;
+
+  Bool_t PassTrack(const AliAnalysisMuMuCutCombination& cutCombination, const AliVParticle& track, Int_t itrack) const;
+
+  Bool_t PassTrackPair(const AliAnalysisMuMuCutCombination& cutCombination,
+                       const AliVParticle& p1, Int_t itrack1,
+                       const AliVParticle& p2, Int_t itrack2) const;
+
 private:
 
   AliAnalysisTaskMuMu(const AliAnalysisTaskMuMu&); // not implemented (on purpose)
@@ -174,7 +188,13 @@ private:
 
   Int_t fMaxPoolSize; // pool size
 
-  ClassDef(AliAnalysisTaskMuMu,31) // a class to analyse muon pairs (and single also ;-) )
+  AliAnalysisMuMuCutElement::CutBits fEventCutBits; //! event cut results for the current event
+  std::vector<Int_t> fCutBitsMuonIndex; //! index of each event track among the muon tracks (-1 if not a muon)
+  std::vector<AliAnalysisMuMuCutElement::CutBits> fTrackCutBits; //! track cut results, per muon track
+  std::vector<AliAnalysisMuMuCutElement::CutBits> fTrackPairCutBits; //! track pair cut results, per muon track pair
+  Int_t fNofCutBitsMuons; //! number of muon tracks in the current event
+
+  ClassDef(AliAnalysisTaskMuMu,32) // a class to analyse muon pairs (and single also ;-) )
 };
 
 #endif
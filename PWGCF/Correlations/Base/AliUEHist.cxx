@@ -41,7 +41,7 @@ ClassImp(AliUEHist)
 
 const Int_t AliUEHist::fgkCFSteps = 11;
 
-AliUEHist::AliUEHist(const char* reqHist, const char* binning) : 
+AliUEHist::AliUEHist(const char* reqHist, const char* binning, Bool_t useBlockStorage) : 
   TObject(),
   fkRegions(4),
   fEventHist(0),
@@ -137,12 +137,14 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
   Double_t* vertexBinsEff = GetBinning(binning, "vertex_eff", nVertexBinsEff);
   
   Int_t useVtxAxis = 0;
-  Int_t useAliTHn = 1; // 0 = don't use | 1 = with float | 2 = with double
+  Int_t useAliTHn = 1; // 0 = don't use | 1 = with float | 2 = with double | 3 = block-sparse with float | 4 = block-sparse with double
   
   if (TString(reqHist).Contains("Sparse"))
     useAliTHn = 0;
   if (TString(reqHist).Contains("Double"))
     useAliTHn = 2;
+  if (useBlockStorage && useAliTHn > 0)
+    useAliTHn = (useAliTHn == 2) ? 4 : 3;
   
   // selection depending on requested histogram
   Int_t axis = -1; // 0 = pT,lead, 1 = phi,lead
@@ -268,6 +270,10 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
       fTrackHist[i] = new AliTHn(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
     else if (axis >= 2 && useAliTHn == 2)
       fTrackHist[i] = new AliTHnD(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
+    else if (axis >= 2 && useAliTHn == 3)
+      fTrackHist[i] = new AliTHnBlock(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
+    else if (axis >= 2 && useAliTHn == 4)
+      fTrackHist[i] = new AliTHnBlockD(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
     else
       fTrackHist[i] = new AliCFContainer(Form("fTrackHist_%d", i), title, nSteps, nTrackVars, iTrackBin);
     
@@ -27,7 +27,7 @@ class THnBase;
 class AliUEHist : public TObject
 {
  public:
-  AliUEHist(const char* reqHist = "", const char* binning = 0);
+  AliUEHist(const char* reqHist = "", const char* binning = 0, Bool_t useBlockStorage = kFALSE);
   virtual ~AliUEHist();
   
   const UInt_t fkRegions;
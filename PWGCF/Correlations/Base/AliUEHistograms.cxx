@@ -41,7 +41,7 @@ ClassImp(AliUEHistograms)
 
 const Int_t AliUEHistograms::fgkUEHists = 3;
 
-AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const char* binning) : 
+AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const char* binning, Bool_t useBlockStorage) : 
   TNamed(name, name),
   fNumberDensitypT(0),
   fSumpT(0),
@@ -162,7 +162,7 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
     else if (histogramsStr.Contains("D"))
       configStr += "Double";
     
-    fNumberDensityPhi = new AliUEHist(configStr, binningStr);
+    fNumberDensityPhi = new AliUEHist(configStr, binningStr, useBlockStorage);
   }
   
   // do not add this hists to the directory
@@ -25,7 +25,7 @@ class TH3F;
 class AliUEHistograms : public TNamed
 {
  public:
-  AliUEHistograms(const char* name = "AliUEHistograms", const char* histograms = "", const char* binning = 0);
+  AliUEHistograms(const char* name = "AliUEHistograms", const char* histograms = "", const char* binning = 0, Bool_t useBlockStorage = kFALSE);
   virtual ~AliUEHistograms();
   
   void Fill(Int_t eventType, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* toward, TList* away, TList* min, TList* max);
@@ -84,7 +84,9 @@ ClassImp(AliJCORRAN)
         fEfficiency(0),
         fRunTable(0),
         fIsolationR(0),
-        fHadronSelectionCut(0)
+        fHadronSelectionCut(0),
+        fInclusivePt(),
+        fInclusivePtWeight()
 {
     // constructor
 }
@@ -130,7 +132,9 @@ AliJCORRAN::AliJCORRAN(Bool_t execLocal) :
     fEfficiency(0),
     fRunTable(0),
     fIsolationR(0),
-    fHadronSelectionCut(0)
+    fHadronSelectionCut(0),
+    fInclusivePt(),
+    fInclusivePtWeight()
 {
     // constructor
 }
@@ -180,7 +184,9 @@ AliJCORRAN::AliJCORRAN(const AliJCORRAN& obj) :
     fEfficiency(obj.fEfficiency),
     fRunTable(obj.fRunTable),
     fIsolationR(obj.fIsolationR),
-    fHadronSelectionCut(obj.fHadronSelectionCut)
+    fHadronSelectionCut(obj.fHadronSelectionCut),
+    fInclusivePt(),
+    fInclusivePtWeight()
 {
     // copy constructor
     JUNUSED(obj);
@@ -456,6 +462,7 @@ void AliJCORRAN::UserExec(){
 	if(fRunTable->IsHeavyIon()){
 		double vdelta[2] = {0};
 		int    vdeltaNorm = 0;
+		AliJTH1Handle<TH1D> hVN = fhistos->fhVN[cBin].Handle(); // resolved once for the pair loop
 		for(int it1=0; it1<noAllTriggTracks-1; it1++){
 			AliJBaseTrack *ftk1 = (AliJBaseTrack*)finputList->At(it1);
 			if(ftk1->Pt()<flowerPtAssocBoarder) continue;
@@ -464,7 +471,7 @@ void AliJCORRAN::UserExec(){
 				if(ftk2->Pt()<flowerPtAssocBoarder) continue;
 				if(fabs(ftk1->Eta() - ftk2->Eta())<1.0) continue;
 				double fdphi = ftk1->DeltaPhi(*ftk2);
-				fhistos->fhVN[cBin]->Fill(fdphi);
+				hVN->Fill(fdphi);
 				vdelta[0] += cos(2*fdphi); 
 				vdelta[1] += cos(3*fdphi); 
 				//cout<< ftk1->Pt() <<" "<< ftk2->Pt() <<" "<< fabs(ftk1->Eta() - ftk2->Eta()) <<" "<< 2*fdphi <<" "<< 3*fdphi <<endl; 
@@ -491,6 +498,14 @@ void AliJCORRAN::UserExec(){
 	AliJBaseTrack *lPTr = NULL;
 	int noTriggs=0;
 	ftriggList->Clear();
+	// centrality-binned inclusive histograms are resolved once per event, pt is filled in bulk after the loop
+	AliJTH1Handle<TH1D> hChargedPt = fhistos->fhChargedPt[cBin].Handle();
+	AliJTH1Handle<TH1D> hChargedPtNoCorr = fhistos->fhChargedPtNoCorr[cBin].Handle();
+	AliJTH1Handle<TH1D> hChargedPtJacek = fhistos->fhChargedPtJacek[cBin].Handle();
+	AliJTH1Handle<TH1D> hChargedPtJacekEta[3];
+	for(int ieta=0; ieta<3; ieta++) hChargedPtJacekEta[ieta] = fhistos->fhChargedPtJacekEta[cBin][ieta].Handle();
+	fInclusivePt.clear();
+	fInclusivePtWeight.clear();
 	for(int itrack=0; itrack<noAllTriggTracks; itrack++){
 		AliJBaseTrack *triggTr = (AliJBaseTrack*)finputList->At(itrack);
 		triggTr->SetTriggBin( fcard->GetBin(kTriggType, triggTr->Pt()) );
@@ -504,14 +519,14 @@ void AliJCORRAN::UserExec(){
 		if( ptt>flowerPtAssocBoarder ){
 			//FK//double effCorr = 1./fcard->TrackEfficiency(ptt, fcent);  // here you generate warning if ptt>30
 			//double effCorr = 1./fcard->TrackEfficiency(ptt, etat, cBin);  // here you generate warning if ptt>30
-			fhistos->fhChargedPt[cBin]->Fill(ptt, effCorr );
-			fhistos->fhChargedPtNoCorr[cBin]->Fill( ptt );
+			fInclusivePt.push_back( ptt );
+			fInclusivePtWeight.push_back( effCorr );
 			fhistos->fhChargedEta->Fill(triggTr->Eta(), effCorr);
 			//fhistos->fhChargedPtJacek[cBin]->Fill(ptt, effCorr );
-			fhistos->fhChargedPtJacek[cBin]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0); //One CANNOT do 1/ptt here!! First unfold.
-			if( -0.8<etat && etat<-0.2) fhistos->fhChargedPtJacekEta[cBin][0]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
-			if( -0.2<etat && etat< 0.3) fhistos->fhChargedPtJacekEta[cBin][1]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
-			if(  0.3<etat && etat< 0.8) fhistos->fhChargedPtJacekEta[cBin][2]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
+			hChargedPtJacek->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0); //One CANNOT do 1/ptt here!! First unfold.
+			if( -0.8<etat && etat<-0.2) hChargedPtJacekEta[0]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
+			if( -0.2<etat && etat< 0.3) hChargedPtJacekEta[1]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
+			if(  0.3<etat && etat< 0.8) hChargedPtJacekEta[2]->Fill(ptt, ptt>0 ? 1./ptt*effCorr : 0);
 			fhistos->fhChargedPtFiete->Fill(ptt, effCorr );
 		}
 
@@ -529,6 +544,8 @@ void AliJCORRAN::UserExec(){
 		new ((*ftriggList)[noTriggs++]) AliJBaseTrack(*triggTr);
 		fhistos->fhTriggMult[cBin][iptt]->Fill(noAllTriggTracks);
 	}
+	hChargedPtNoCorr.FillN( fInclusivePt );
+	hChargedPt.FillN( fInclusivePt, fInclusivePtWeight );
 
 	//----------------------------------------------------
 	//----- Find sum of two leading particles ------------
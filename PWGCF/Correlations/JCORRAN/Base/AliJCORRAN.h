@@ -7,6 +7,7 @@
 #include <AliJDataManager.h>
 #include <AliJConst.h>
 #include <TH1D.h>
+#include <vector>
 
 // jcorran main class
 // used in local and grid execution
@@ -120,8 +121,10 @@ class AliJCORRAN : public TObject
 	AliJRunTable *fRunTable; // comment needed
 	float fIsolationR; // comment1
 	int fHadronSelectionCut; /// comment2
+	std::vector<double> fInclusivePt; //! pt of the inclusive tracks of the event, filled in bulk
+	std::vector<double> fInclusivePtWeight; //! efficiency weights of fInclusivePt
 
-	ClassDef(AliJCORRAN, 1); // EMCAL for jcorran
+	ClassDef(AliJCORRAN, 2); // EMCAL for jcorran
 
 };
 
@@ -370,31 +370,89 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 	delete fHMG;
 }
 
-#define A i
-#define B (1-i)
 #define C(u) TComplex::Conjugate(u)
-//TODO: conjugate macro
-inline TComplex TwoGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
-	return pQq[A][a][1]*C(pQq[B][b][1]);
+// Q-vectors of one subevent, read from the flat real/imaginary arrays
+struct SubQ{
+	const Double_t (*re)[AliJFFlucAnalysis::nKL];
+	const Double_t (*im)[AliJFFlucAnalysis::nKL];
+	TComplex operator()(uint n, uint p) const{ return TComplex(re[n][p],im[n][p]); }
+};
+
+// 1-, 2- and 3-particle terms within a subevent with the autocorrelations removed.
+// Every gap correlator factorizes into (terms of A)*C(terms of B).
+inline TComplex TwoSub(const SubQ &q, uint a, uint b){
+	return q(a,1)*q(b,1)-q(a+b,2);
+}
+
+inline TComplex ThreeSub(const SubQ &q, uint a, uint b, uint c){
+	return q(a,1)*q(b,1)*q(c,1)-q(a+b,2)*q(c,1)-q(a+c,2)*q(b,1)-q(b+c,2)*q(a,1)+2.0*q(a+b+c,3);
 }
 
-inline TComplex ThreeGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]-pQq[B][b+c][2]);
+inline TComplex TwoGap(const SubQ &qa, const SubQ &qb, uint a, uint b){
+	return qa(a,1)*C(qb(b,1));
 }
 
-inline TComplex FourGap22(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a+b][2]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c+d][2])+pQq[A][a+b][2]*C(pQq[B][c+d][2]);
+inline TComplex ThreeGap(const SubQ &qa, const SubQ &qb, uint a, uint b, uint c){
+	return qa(a,1)*C(TwoSub(qb,b,c));
 }
 
-inline TComplex FourGap13(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]*pQq[B][d][1]-pQq[B][b+c][2]*pQq[B][d][1]-pQq[B][b+d][2]*pQq[B][c][1]-pQq[B][c+d][2]*pQq[B][b][1]+2.0*pQq[B][b+c+d][3]);
+inline TComplex FourGap22(const SubQ &qa, const SubQ &qb, uint a, uint b, uint c, uint d){
+	return TwoSub(qa,a,b)*C(TwoSub(qb,c,d));
 }
 
-inline TComplex SixGap33(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
-	return pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+2.0*pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5+n6][3])+2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+4.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5+n6][3]);
+inline TComplex FourGap13(const SubQ &qa, const SubQ &qb, uint a, uint b, uint c, uint d){
+	return qa(a,1)*C(ThreeSub(qb,b,c,d));
+}
+
+inline TComplex SixGap33(const SubQ &qa, const SubQ &qb, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
+	return ThreeSub(qa,n1,n2,n3)*C(ThreeSub(qb,n4,n5,n6));
 }
 #undef C
 
+// Mixed-harmonic and nonlinear-response correlators of fh_correlator, in histogram order.
+// The first harmonic is taken from subevent A, the others from subevent B.
+enum{kCorrQ, kCorrThreeGap, kCorrFourGap22, kCorrFourGap13}; // kCorrQ: plain product Q_A*Q_B*..., no autocorrelation removal
+enum{kNorm1, kNorm3p, kNorm4p, kNorm4pB};
+enum{kWeight1, kWeight3p, kWeight4p, kWeight4pB};
+struct CorrelatorDef{
+	UInt_t type;
+	UInt_t h[5]; // harmonics, 0 terminates the list for kCorrQ
+	UInt_t norm;
+	UInt_t vnh, vnk; // if vnh > 0, multiply by the 2k-particle correlator <vn^2k>
+	UInt_t weight;
+};
+static const CorrelatorDef correlatorDefs[] = {
+	{kCorrQ,         {4,2,2,0,0}, kNorm1,   2,1, kWeight1},   //  0 V4V2star_2 v2^2
+	{kCorrQ,         {4,2,2,0,0}, kNorm1,   2,2, kWeight1},   //  1 V4V2star_2 v2^4
+	{kCorrQ,         {4,2,2,0,0}, kNorm1,   0,0, kWeight3p},  //  2 V4V2star_2
+	{kCorrQ,         {5,2,3,0,0}, kNorm1,   2,1, kWeight1},   //  3 V5V2starV3star v2^2
+	{kCorrQ,         {5,2,3,0,0}, kNorm1,   0,0, kWeight3p},  //  4 V5V2starV3star
+	{kCorrQ,         {5,2,3,0,0}, kNorm1,   3,1, kWeight1},   //  5 V5V2starV3star v3^2
+	{kCorrQ,         {6,2,2,2,0}, kNorm1,   0,0, kWeight4pB}, //  6 V6V2star_3
+	{kCorrQ,         {6,3,3,0,0}, kNorm1,   0,0, kWeight3p},  //  7 V6V3star_2
+	{kCorrQ,         {7,2,2,3,0}, kNorm1,   0,0, kWeight4pB}, //  8 V7V2star_2V3star
+	{kCorrThreeGap,  {4,2,2},     kNorm3p,  0,0, kWeight3p},  //  9 nV4V2star_2
+	{kCorrThreeGap,  {5,2,3},     kNorm3p,  0,0, kWeight3p},  // 10 nV5V2starV3star
+	{kCorrThreeGap,  {6,3,3},     kNorm3p,  0,0, kWeight3p},  // 11 nV6V3star_2
+	{kCorrFourGap22, {4,2,4,2},   kNorm4p,  0,0, kWeight4p},  // 12 nV4V4V2V2
+	{kCorrFourGap22, {3,2,3,2},   kNorm4p,  0,0, kWeight4p},  // 13 nV3V3V2V2
+	{kCorrFourGap22, {5,2,5,2},   kNorm4p,  0,0, kWeight4p},  // 14 nV5V5V2V2
+	{kCorrFourGap22, {5,3,5,3},   kNorm4p,  0,0, kWeight4p},  // 15 nV5V5V3V3
+	{kCorrFourGap22, {4,3,4,3},   kNorm4p,  0,0, kWeight4p},  // 16 nV4V4V3V3
+	{kCorrQ,         {8,2,3,3,0}, kNorm1,   0,0, kWeight4pB}, // 17 V8V2starV3star_2
+	{kCorrQ,         {8,2,2,2,2}, kNorm1,   0,0, kWeight1},   // 18 V8V2star_4
+	{kCorrFourGap13, {6,2,2,2},   kNorm4pB, 0,0, kWeight4pB}, // 19 nV6V2star_3
+	{kCorrFourGap13, {7,2,2,3},   kNorm4pB, 0,0, kWeight4pB}, // 20 nV7V2star_2V3star
+	{kCorrFourGap13, {8,2,3,3},   kNorm4pB, 0,0, kWeight4pB}, // 21 nV8V2starV3star_2
+	{kCorrQ,         {6,2,4,0,0}, kNorm1,   0,0, kWeight3p},  // 22 V6V2starV4star
+	{kCorrQ,         {7,2,5,0,0}, kNorm1,   0,0, kWeight3p},  // 23 V7V2starV5star
+	{kCorrQ,         {7,3,4,0,0}, kNorm1,   0,0, kWeight3p},  // 24 V7V3starV4star
+	{kCorrThreeGap,  {6,2,4},     kNorm3p,  0,0, kWeight3p},  // 25 nV6V2starV4star
+	{kCorrThreeGap,  {7,2,5},     kNorm3p,  0,0, kWeight3p},  // 26 nV7V2starV5star
+	{kCorrThreeGap,  {7,3,4},     kNorm3p,  0,0, kWeight3p}   // 27 nV7V3starV4star
+};
+static const UInt_t kNCorrelators = sizeof(correlatorDefs)/sizeof(correlatorDefs[0]);
+
 //________________________________________________________________________
 void AliJFFlucAnalysis::UserExec(Option_t *) {
 	// find Centrality
@@ -438,11 +496,11 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	CalculateQvectorsQC(fEta_min,fEta_max);
 
 	for(int ih=2; ih<kNH; ih++){
-		fh_cos_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].Re()/QvectorQC[0][1].Re());
-		fh_sin_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].Im()/QvectorQC[0][1].Re());
+		fh_cos_n_phi[ih][fCBin]->Fill(fQvecRe[kFullQ][ih][1]/fQvecRe[kFullQ][0][1]);
+		fh_sin_n_phi[ih][fCBin]->Fill(fQvecIm[kFullQ][ih][1]/fQvecRe[kFullQ][0][1]);
 		//
 		//
-		Double_t psi = QvectorQC[ih][1].Theta();
+		Double_t psi = Q(ih,1).Theta();
 		fh_psi_n[ih][fCBin]->Fill(psi);
 		fh_cos_n_psi_n[ih][fCBin]->Fill(TMath::Cos((Double_t)ih*psi));
 		fh_sin_n_psi_n[ih][fCBin]->Fill(TMath::Sin((Double_t)ih*psi));
@@ -451,23 +509,24 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	// v2^2 :  k=1  /// remember QnQn = vn^(2k) not k
 	// use k=0 for check v2, v3 only
 	Double_t vn2[kNH][nKL];
-	Double_t vn2_vn2[kNH][nKL][kNH][nKL];
 
 	TComplex corr[kNH][nKL];
 	TComplex ncorr[kNH][nKL];
 	TComplex ncorr2[kNH][nKL][kcNH][nKL];
 
-	const TComplex (*pQq)[kNH][nKL] = QvectorQCeta10;
+	Double_t corrVal[kNCorrelators];
+	Double_t corrWeight[kNCorrelators];
 
 	for(int i = 0; i < 2; ++i){
 		if((subeventMask & (1<<i)) == 0)
 			continue;
-		//Double_t ref_2p = N[i][0]*N[i][1];//TwoGap(pQq,i,0,0).Re();
-		Double_t ref_2p = TwoGap(pQq,i,0,0).Re();
-		Double_t ref_3p = ThreeGap(pQq,i,0,0,0).Re();
-		Double_t ref_4p = FourGap22(pQq,i,0,0,0,0).Re();
-		Double_t ref_4pB = FourGap13(pQq,i,0,0,0,0).Re();
-		Double_t ref_6p = SixGap33(pQq,i,0,0,0,0,0,0).Re();
+		const SubQ qa = {fQvecRe[i],fQvecIm[i]};
+		const SubQ qb = {fQvecRe[1-i],fQvecIm[1-i]};
+		Double_t ref_2p = TwoGap(qa,qb,0,0).Re();
+		Double_t ref_3p = ThreeGap(qa,qb,0,0,0).Re();
+		Double_t ref_4p = FourGap22(qa,qb,0,0,0,0).Re();
+		Double_t ref_4pB = FourGap13(qa,qb,0,0,0,0).Re();
+		Double_t ref_6p = SixGap33(qa,qb,0,0,0,0,0,0).Re();
 
 		Double_t ebe_2p_weight = 1.0;
 		Double_t ebe_3p_weight = 1.0;
@@ -475,10 +534,10 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		Double_t ebe_4p_weightB = 1.0;
 		Double_t ebe_6p_weight = 1.0;
 		if(flags & FLUC_EBE_WEIGHTING){
-			ebe_2p_weight = ref_2p;//N[i][0]*N[i][1];//NSubTracks[kSubA] * NSubTracks[kSubB] ;
-			ebe_3p_weight = ref_3p;//ebe_2p_weight*(N[i][1]-1.0);// * (NSubTracks[kSubB]-1.0);
+			ebe_2p_weight = ref_2p;
+			ebe_3p_weight = ref_3p;
 			ebe_4p_weight = ref_4p;
-			ebe_4p_weightB = ref_4pB;//ebe_3p_weight*(N[i][1]-2.0);// * (NSubTracks[kSubB]-2.0);
+			ebe_4p_weightB = ref_4pB;
 			ebe_6p_weight = ref_6p;
 		}
 		Double_t ref_2Np[2*nKL] = {
@@ -491,39 +550,35 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 			ebe_4p_weight,
 			ebe_6p_weight
 		};
-		if(flags & FLUC_EBE_WEIGHTING){
-			for(int ik=3; ik<2*nKL; ik++){
-				double dk = (double)ik;
-				ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
-				ebe_2Np_weight[ik] = ebe_2Np_weight[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
-			}
-		}else for(int ik=3; ik<2*nKL; ik++){
+		for(int ik=3; ik<2*nKL; ik++){
 			double dk = (double)ik;
-			ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
-			ebe_2Np_weight[ik] = 1.0;
+			ref_2Np[ik] = ref_2Np[ik-1]*max(qa(0,1).Re()-dk,1.0)*max(qb(0,1).Re()-dk,1.0);
+			ebe_2Np_weight[ik] = (flags & FLUC_EBE_WEIGHTING)?
+				ebe_2Np_weight[ik-1]*max(qa(0,1).Re()-dk,1.0)*max(qb(0,1).Re()-dk,1.0):1.0;
 		}
 
+		// correlator tensor: single harmonics first, then the mixed [ih][ik][ihh][ikk] terms
 		for(int ih=2; ih<kNH; ih++){
-			//corr[ih][1] = pQn[i][0][ih]*pQn[i][1][ih]*N[i][0]*N[i][1];//QnA[ih]*QnB_star[ih];
-			corr[ih][1] = TwoGap(pQq,i,ih,ih);
+			corr[ih][1] = TwoGap(qa,qb,ih,ih);
 			for(int ik=2; ik<nKL; ik++)
-				corr[ih][ik] = corr[ih][ik-1]*corr[ih][1];//TComplex::Power(corr[ih][1],ik);
+				corr[ih][ik] = corr[ih][ik-1]*corr[ih][1];
 			ncorr[ih][1] = corr[ih][1];
-			ncorr[ih][2] = FourGap22(pQq,i,ih,ih,ih,ih);//mf*(corr[ih][2]*N[i][0]*N[i][1]-pQn[i][1][2*ih]*pQn[i][0][ih]*pQn[i][0][ih]*N[i][0]-pQn[i][0][2*ih]*pQn[i][1][ih]*pQn[i][1][ih]*N[i][1]+pQn[i][1][2*ih]*pQn[i][0][2*ih]);
-			ncorr[ih][3] = SixGap33(pQq,i,ih,ih,ih,ih,ih,ih);
+			ncorr[ih][2] = FourGap22(qa,qb,ih,ih,ih,ih);
+			ncorr[ih][3] = SixGap33(qa,qb,ih,ih,ih,ih,ih,ih);
 			for(int ik=4; ik<nKL; ik++)
 				ncorr[ih][ik] = corr[ih][ik]; //for 8,...-particle correlations, ignore the autocorrelation / weight dependency for now
-
+		}
+		for(int ih=2; ih<kNH; ih++){
 			for(int ihh=2; ihh<kcNH; ihh++){
-				ncorr2[ih][1][ihh][1] = FourGap22(pQq,i,ih,ihh,ih,ihh);
-				ncorr2[ih][1][ihh][2] = SixGap33(pQq,i,ih,ihh,ihh,ih,ihh,ihh);
-				ncorr2[ih][2][ihh][1] = SixGap33(pQq,i,ih,ih,ihh,ih,ih,ihh);
+				ncorr2[ih][1][ihh][1] = FourGap22(qa,qb,ih,ihh,ih,ihh);
+				ncorr2[ih][1][ihh][2] = SixGap33(qa,qb,ih,ihh,ihh,ih,ihh,ihh);
+				ncorr2[ih][2][ihh][1] = SixGap33(qa,qb,ih,ih,ihh,ih,ih,ihh);
 				for(int ik=2; ik<nKL; ik++)
 					for(int ikk=2; ikk<nKL; ikk++)
 						ncorr2[ih][ik][ihh][ikk] = ncorr[ih][ik]*ncorr[ihh][ikk];
 			}
 		}
-		
+
 		for(int ih=2; ih<kNH; ih++){
 			for(int ik=1; ik<nKL; ik++){ // 2k(0) =1, 2k(1) =2, 2k(2)=4....
 				vn2[ih][ik] = corr[ih][ik].Re()/ref_2Np[ik-1];
@@ -531,8 +586,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 				fh_vna[ih][ik][fCBin]->Fill(ncorr[ih][ik].Re()/ref_2Np[ik-1],ebe_2Np_weight[ik-1]);
 				for(int ihh=2; ihh<kcNH; ihh++){
 					for(int ikk=1; ikk<nKL; ikk++){
-						vn2_vn2[ih][ik][ihh][ikk] = ncorr2[ih][ik][ihh][ikk]/ref_2Np[ik+ikk-1];//(ncorr[ih][ik]*ncorr[ihh][ikk]).Re()/ref_2Np[ik+ikk-1];
-						fh_vn_vn[ih][ik][ihh][ikk][fCBin]->Fill(vn2_vn2[ih][ik][ihh][ikk],ebe_2Np_weight[ik+ikk-1]); // Fill hvn_vn
+						fh_vn_vn[ih][ik][ihh][ikk][fCBin]->Fill(ncorr2[ih][ik][ihh][ikk].Re()/ref_2Np[ik+ikk-1],ebe_2Np_weight[ik+ikk-1]); // Fill hvn_vn
 					}
 				}
 			}
@@ -540,96 +594,56 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		}
 
 		//************************************************************************
-		TComplex V4V2star_2 = pQq[A][4][1] * pQq[B][2][1] * pQq[B][2][1];
-		TComplex V4V2starv2_2 =	V4V2star_2 * corr[2][1]/ref_2Np[0];//vn[2][1]
-		TComplex V4V2starv2_4 = V4V2star_2 * corr[2][2]/ref_2Np[1];//vn2[2][2]
-		TComplex V5V2starV3starv2_2 = pQq[A][5][1] * pQq[B][2][1] * pQq[B][3][1] * corr[2][1]/ref_2Np[0]; //vn2[2][1]
-		TComplex V5V2starV3star = pQq[A][5][1] * pQq[B][2][1] * pQq[B][3][1];
-		TComplex V5V2starV3startv3_2 = V5V2starV3star * corr[3][1]/ref_2Np[0]; //vn2[3][1]
-		TComplex V6V2star_3 = pQq[A][6][1] * pQq[B][2][1] * pQq[B][2][1] * pQq[B][2][1];
-		TComplex V6V3star_2 = pQq[A][6][1] * pQq[B][3][1] * pQq[B][3][1];
-		TComplex V6V2starV4star = pQq[A][6][1] * pQq[B][2][1] * pQq[B][4][1];
-		TComplex V7V2star_2V3star = pQq[A][7][1] * pQq[B][2][1] * pQq[B][2][1] * pQq[B][3][1];
-		TComplex V7V2starV5star = pQq[A][7][1] * pQq[B][2][1] * pQq[B][5][1];
-		TComplex V7V3starV4star = pQq[A][7][1] * pQq[B][3][1] * pQq[B][4][1];
-		TComplex V8V2starV3star_2 = pQq[A][8][1] * pQq[B][2][1] * pQq[B][3][1] * pQq[B][3][1];
-		TComplex V8V2star_4 = pQq[A][8][1] * TComplex::Power(pQq[B][2][1],4);
-
-		// New correlators (Modified by You's correction term for self-correlations)
-		//double nf = 1.0/(N[i][1]-1.0);
-		///double ef = nf/(N[i][1]-2.0);
-		TComplex nV4V2star_2 = ThreeGap(pQq,i,4,2,2)/ref_3p;//V4V2_star2-pQq[i][A][4][1]*pQq[i][B][4][2]; //nf*( V4V2star_2*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );
-		//TComplex nV4V2star_2 = nf*( pQn[i][0][4]*pQn[i][1][2]*pQn[i][1][2]*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );//nf*( V4V2star_2*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );
-		TComplex nV5V2starV3star = ThreeGap(pQq,i,5,2,3)/ref_3p;//V5V2starV3star-pQq[i][A][5][1]*pQq[i][B][5][2]; //nf*( V5V2starV3star*N[i][1] - pQn[i][0][5]*pQn[i][1][5] );
-		TComplex nV6V2star_3 = FourGap13(pQq,i,6,2,2,2)/ref_4pB;//V6V2star_3-pQq[i][A][6][2]*pQq[i][B][4][2]*pQq[i][B][2][1]- //pQn[i][0][6]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][2]*N[i][1]*N[i][1] - 3.0*pQn[i][1][2]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][6] );
-		TComplex nV6V3star_2 = ThreeGap(pQq,i,6,3,3)/ref_3p;//nf*(V6V3star_2*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
-		TComplex nV6V2starV4star = ThreeGap(pQq,i,6,2,4)/ref_3p;//nf*(V6V2starV4star*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
-		TComplex nV7V2star_2V3star = FourGap13(pQq,i,7,2,2,3)/ref_4pB;//pQn[i][0][7]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][2]*pQn[i][1][5]*N[i][1] - pQn[i][1][3]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][7] );
-		TComplex nV7V2starV5star = ThreeGap(pQq,i,7,2,5)/ref_3p;//nf*(V7V2starV5star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
-		TComplex nV7V3starV4star = ThreeGap(pQq,i,7,3,4)/ref_3p;//nf*(V7V3starV4star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
-		TComplex nV8V2starV3star_2 = FourGap13(pQq,i,8,2,3,3)/ref_4pB;//pQn[i][0][8]*ef*( pQn[i][1][2]*pQn[i][1][3]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][3]*pQn[i][1][5]*N[i][1] - pQn[i][1][2]*pQn[i][1][6]*N[i][1] + 2.0*pQn[i][1][8] );
-
-		TComplex nV4V4V2V2 = FourGap22(pQq,i,4,2,4,2)/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][6] * pQn[i][0][4] *pQn[i][0][2] ))
-			//- ((1/(N[i][0]-1) * pQn[i][0][6]*pQn[i][1][4] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][6]*pQn[i][1][6] );
-		TComplex nV3V3V2V2 = FourGap22(pQq,i,3,2,3,2)/ref_4p;//(pQn[i][0][3]*pQn[i][1][3]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][5] * pQn[i][0][3] *pQn[i][0][2] ))
-			//- ((1/(N[i][0]-1) * pQn[i][0][5]*pQn[i][1][3] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][5]*pQn[i][1][5] );
-		TComplex nV5V5V2V2 = FourGap22(pQq,i,5,2,5,2)/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][5] *pQn[i][0][2] ))
-			//- ((1/(N[i][0]-1) * pQn[i][0][7]*pQn[i][1][5] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][7]*pQn[i][1][7] );
-		TComplex nV5V5V3V3 = FourGap22(pQq,i,5,3,5,3)/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][8] * pQn[i][0][5] *pQn[i][0][3] ))
-			//- ((1/(N[i][0]-1) * pQn[i][0][8]*pQn[i][1][5] * pQn[i][1][3])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][8]*pQn[i][1][8] );
-		TComplex nV4V4V3V3 = FourGap22(pQq,i,4,3,4,3)/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][4] *pQn[i][0][3] ))
-			//- ((1/(N[i][0]-1) * pQn[i][0][7]*pQn[i][1][4] * pQn[i][1][3])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][7]*pQn[i][1][7] );
-
-		fh_correlator[0][fCBin]->Fill( V4V2starv2_2.Re() );
-		fh_correlator[1][fCBin]->Fill( V4V2starv2_4.Re() );
-		fh_correlator[2][fCBin]->Fill( V4V2star_2.Re(),ebe_3p_weight ) ; // added 2015.3.18
-		fh_correlator[3][fCBin]->Fill( V5V2starV3starv2_2.Re() );
-		fh_correlator[4][fCBin]->Fill( V5V2starV3star.Re(),ebe_3p_weight );
-		fh_correlator[5][fCBin]->Fill( V5V2starV3startv3_2.Re() );
-		fh_correlator[6][fCBin]->Fill( V6V2star_3.Re(),ebe_4p_weightB );
-		fh_correlator[7][fCBin]->Fill( V6V3star_2.Re(),ebe_3p_weight );
-		fh_correlator[8][fCBin]->Fill( V7V2star_2V3star.Re(),ebe_4p_weightB ) ;
-
-		fh_correlator[9][fCBin]->Fill( nV4V2star_2.Re(),ebe_3p_weight ); // added 2015.6.10
-		fh_correlator[10][fCBin]->Fill( nV5V2starV3star.Re(),ebe_3p_weight );
-		fh_correlator[11][fCBin]->Fill( nV6V3star_2.Re(),ebe_3p_weight ) ;
-
-		// use this to avoid self-correlation 4p correlation (2 particles from A, 2 particles from B) -> MA(MA-1)MB(MB-1) : evt weight..
-		fh_correlator[12][fCBin]->Fill( nV4V4V2V2.Re(),ebe_2Np_weight[1]);
-		fh_correlator[13][fCBin]->Fill( nV3V3V2V2.Re(),ebe_2Np_weight[1]);
-
-		fh_correlator[14][fCBin]->Fill( nV5V5V2V2.Re(),ebe_2Np_weight[1]);
-		fh_correlator[15][fCBin]->Fill( nV5V5V3V3.Re(),ebe_2Np_weight[1]);
-		fh_correlator[16][fCBin]->Fill( nV4V4V3V3.Re(),ebe_2Np_weight[1]);
-
-		//higher order correlators, added 2017.8.10
-		fh_correlator[17][fCBin]->Fill( V8V2starV3star_2.Re(),ebe_4p_weightB );
-		fh_correlator[18][fCBin]->Fill( V8V2star_4.Re() ); //5p weight
-		fh_correlator[19][fCBin]->Fill( nV6V2star_3.Re(),ebe_4p_weightB );
-		fh_correlator[20][fCBin]->Fill( nV7V2star_2V3star.Re(),ebe_4p_weightB );
-		fh_correlator[21][fCBin]->Fill( nV8V2starV3star_2.Re(),ebe_4p_weightB );
-
-		fh_correlator[22][fCBin]->Fill( V6V2starV4star.Re(),ebe_3p_weight );
-		fh_correlator[23][fCBin]->Fill( V7V2starV5star.Re(),ebe_3p_weight );
-		fh_correlator[24][fCBin]->Fill( V7V3starV4star.Re(),ebe_3p_weight );
-		fh_correlator[25][fCBin]->Fill( nV6V2starV4star.Re(),ebe_3p_weight );
-		fh_correlator[26][fCBin]->Fill( nV7V2starV5star.Re(),ebe_3p_weight );
-		fh_correlator[27][fCBin]->Fill( nV7V3starV4star.Re(),ebe_3p_weight );
+		// mixed-harmonic and nonlinear-response correlators, see correlatorDefs
+		const Double_t ref_norm[] = {1.0,ref_3p,ref_4p,ref_4pB};
+		const Double_t ebe_weight[] = {1.0,ebe_3p_weight,ebe_4p_weight,ebe_4p_weightB};
+		for(UInt_t ic = 0; ic < kNCorrelators; ic++){
+			const CorrelatorDef &cd = correlatorDefs[ic];
+			TComplex v;
+			switch(cd.type){
+				case kCorrQ:
+					v = qa(cd.h[0],1);
+					for(UInt_t j = 1; j < 5 && cd.h[j] > 0; j++)
+						v = v*qb(cd.h[j],1);
+					break;
+				case kCorrThreeGap:
+					v = ThreeGap(qa,qb,cd.h[0],cd.h[1],cd.h[2]);
+					break;
+				case kCorrFourGap22:
+					v = FourGap22(qa,qb,cd.h[0],cd.h[1],cd.h[2],cd.h[3]);
+					break;
+				case kCorrFourGap13:
+					v = FourGap13(qa,qb,cd.h[0],cd.h[1],cd.h[2],cd.h[3]);
+					break;
+			}
+			if(cd.vnh > 0)
+				v = v*corr[cd.vnh][cd.vnk]/ref_2Np[cd.vnk-1];
+			corrVal[ic] = v.Re()/ref_norm[cd.norm];
+			corrWeight[ic] = ebe_weight[cd.weight];
+		}
+		for(UInt_t ic = 0; ic < kNCorrelators; ic++)
+			fh_correlator[ic][fCBin]->Fill(corrVal[ic],corrWeight[ic]);
 	}
 
+	const SubQ qsubA = {fQvecRe[kSubQA],fQvecIm[kSubQA]};
+	const SubQ qsubB = {fQvecRe[kSubQB],fQvecIm[kSubQB]};
+	const Double_t ref_four = Four(0,0,0,0).Re();
+	const Double_t ref_two = Two(0,0).Re();
+	const Double_t ref_two_eta10 = (qsubA(0,1)*qsubB(0,1)).Re();
+
 	Double_t event_weight_four = 1.0;
 	Double_t event_weight_two = 1.0;
 	Double_t event_weight_two_eta10 = 1.0;
 	if(flags & FLUC_EBE_WEIGHTING){
-		event_weight_four = Four(0,0,0,0).Re();
-		event_weight_two = Two(0,0).Re();
-		event_weight_two_eta10 = (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		event_weight_four = ref_four;
+		event_weight_two = ref_two;
+		event_weight_two_eta10 = ref_two_eta10;
 	}
 
 	for(int ih=2; ih < kNH; ih++){
 		//for(int ihh=2; ihh<ih; ihh++){ //all SC
 		for(int ihh=2, mm = (ih < kcNH?ih:kcNH); ihh<mm; ihh++){ //limited
-			TComplex scfour = Four( ih, ihh, -ih, -ihh ) / Four(0,0,0,0).Re();
+			TComplex scfour = Four( ih, ihh, -ih, -ihh ) / ref_four;
 			
 			fh_SC_with_QC_4corr[ih][ihh][fCBin]->Fill( scfour.Re(), event_weight_four );
 			//QC_4p_value[ih][ihh] = scfour.Re();
@@ -640,13 +654,13 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		// two(2,2) = Q2 Q2* - Q0 = Q2Q2* - M
 		// two(0,0) = Q0 Q0* - Q0 = M^2 - M
 		//two[ih] = Two(ih, -ih) / Two(0,0).Re();
-		TComplex sctwo = Two(ih, -ih) / Two(0,0).Re();
+		TComplex sctwo = Two(ih, -ih) / ref_two;
 		fh_SC_with_QC_2corr[ih][fCBin]->Fill( sctwo.Re(), event_weight_two );
 		//QC_2p_value[ih] = sctwo.Re();
 		// fill single vn  with QC without EtaGap as method 2
 		fSingleVn[ih][2] = TMath::Sqrt(sctwo.Re());
 		
-		TComplex sctwo10 = (QvectorQCeta10[kSubA][ih][1]*TComplex::Conjugate(QvectorQCeta10[kSubB][ih][1])) / (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		TComplex sctwo10 = (qsubA(ih,1)*TComplex::Conjugate(qsubB(ih,1))) / ref_two_eta10;
 		fh_SC_with_QC_2corr_eta10[ih][fCBin]->Fill( sctwo10.Re(), event_weight_two_eta10 );
 		// fill single vn with QC method with Eta Gap as method 1
 		fSingleVn[ih][1] = TMath::Sqrt(sctwo10.Re());
@@ -693,14 +707,10 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 			}
 		}
 
-		// calculate Qn for each pt bin
+		// calculate Qn for each pt bin, all harmonics in one track loop
+		CalculateQvectorsPt(Eta_config, ptbin_borders, SCNH, QnA_pt, QnB_pt);
 		for(int ih=2; ih<SCNH; ih++){
 			for(int ipt=0; ipt<N_ptbins; ipt++){
-				Double_t pt_bin_min = ptbin_borders[ipt];
-				Double_t pt_bin_max = ptbin_borders[ipt+1];
-				QnA_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-				QnB_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
 				QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ;
 			}
 		}
@@ -826,15 +836,19 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 //________________________________________________________________________
 void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 	// calcualte Q-vector for QC method ( no subgroup )
+	// All harmonics and weight powers are accumulated into the flat arrays, cos(n phi) and
+	// sin(n phi) come from the angle-addition recurrence (one cos/sin evaluation per track).
 	//init
-	for(int ih=0; ih<kNH; ih++){
-		for(int ik=0; ik<nKL; ++ik){
-			QvectorQC[ih][ik] = TComplex(0,0);
-			for(int isub=0; isub<2; isub++){
-				QvectorQCeta10[isub][ih][ik] = TComplex(0,0);
+	for(int iq=0; iq<kNQ; iq++){
+		for(int ih=0; ih<kNHQ; ih++){
+			for(int ik=0; ik<nKL; ++ik){
+				fQvecRe[iq][ih][ik] = 0.0;
+				fQvecIm[iq][ih][ik] = 0.0;
 			}
 		}
 	} // for max harmonics
+	Double_t cosn[kNHQ], sinn[kNHQ];
+	Double_t wk[nKL];
 	//Calculate Q-vector with particle loop
 	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
@@ -854,34 +868,110 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 
 		int isub = (int)(eta > 0.0);
 		Double_t phi = itrack->Phi();
-		Double_t pt = itrack->Pt();
 
-		Double_t effCorr = itrack->GetTrackEff();//fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);	
+		Double_t effCorr = itrack->GetTrackEff();//fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 		Double_t phi_module_corr = itrack->GetWeight();
 
-		for(int ih=0; ih<kNH; ih++){
-			Double_t tf = 1.0;
-			TComplex q[nKL];
-			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
-
-				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
+		// weight^k for k = 0..nKL-1
+		Double_t tf = 1.0/(phi_module_corr*effCorr);
+		wk[0] = 1.0;
+		for(int ik=1; ik<nKL; ik++)
+			wk[ik] = wk[ik-1]*tf;
+
+		Double_t c1 = TMath::Cos(phi), s1 = TMath::Sin(phi);
+		cosn[0] = 1.0;
+		sinn[0] = 0.0;
+		for(int ih=1; ih<kNHQ; ih++){
+			cosn[ih] = cosn[ih-1]*c1-sinn[ih-1]*s1;
+			sinn[ih] = sinn[ih-1]*c1+cosn[ih-1]*s1;
+		}
 
-				tf *= 1.0/(phi_module_corr*effCorr);
+		for(int ih=0; ih<kNHQ; ih++){
+			for(int ik=0; ik<nKL; ik++){
+				fQvecRe[kFullQ][ih][ik] += wk[ik]*cosn[ih];
+				fQvecIm[kFullQ][ih][ik] += wk[ik]*sinn[ih];
+			}
+		}
+		//this is for normalized SC ( denominator needs an eta gap )
+		if(TMath::Abs(eta) > etamin){//fQC_eta_gap_half)
+			for(int ih=0; ih<kNHQ; ih++){
+				for(int ik=0; ik<nKL; ik++){
+					fQvecRe[isub][ih][ik] += wk[ik]*cosn[ih];
+					fQvecIm[isub][ih][ik] += wk[ik]*sinn[ih];
+				}
 			}
 		}
 	} // track loop done.
 }
 //________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQvectorsPt(const Double_t (*etaConfig)[2], const Double_t *ptBorders, int nh, TComplex (*QnA)[N_ptbins], TComplex (*QnB)[N_ptbins]){
+	// Same as Get_Qn_pt for both subevents, harmonics 2..nh-1 and all pt bins,
+	// filled in a single loop over the tracks
+	Double_t QRe[2][kNH][N_ptbins], QIm[2][kNH][N_ptbins];
+	Double_t Sub_Ntrk[2][N_ptbins];
+	for(int isub=0; isub<2; isub++){
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			Sub_Ntrk[isub][ipt] = 0.0;
+			for(int ih=0; ih<nh; ih++){
+				QRe[isub][ih][ipt] = 0.0;
+				QIm[isub][ih][ipt] = 0.0;
+			}
+		}
+	}
+	Double_t cosn[kNH], sinn[kNH];
+	Long64_t ntracks = fInputList->GetEntriesFast();
+	for( Long64_t it = 0; it < ntracks; it++){
+		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+		Double_t eta = itrack->Eta();
+		Double_t pt = itrack->Pt();
+		Bool_t harmonicsDone = kFALSE;
+		Double_t tf = 0.0;
+		for(int isub=0; isub<2; isub++){
+			if(eta < etaConfig[isub][0] || eta > etaConfig[isub][1])
+				continue;
+			for(int ipt=0; ipt<N_ptbins; ipt++){
+				if(pt < ptBorders[ipt] || pt > ptBorders[ipt+1])
+					continue;
+				if(!harmonicsDone){
+					Double_t phi = itrack->Phi();
+					Double_t effCorr = itrack->GetTrackEff();
+					Double_t phi_module_corr = itrack->GetWeight();
+					tf = 1.0/(phi_module_corr*effCorr);
+					Double_t c1 = TMath::Cos(phi), s1 = TMath::Sin(phi);
+					cosn[0] = 1.0;
+					sinn[0] = 0.0;
+					for(int ih=1; ih<nh; ih++){
+						cosn[ih] = cosn[ih-1]*c1-sinn[ih-1]*s1;
+						sinn[ih] = sinn[ih-1]*c1+cosn[ih-1]*s1;
+					}
+					harmonicsDone = kTRUE;
+				}
+				for(int ih=0; ih<nh; ih++){
+					QRe[isub][ih][ipt] += tf*cosn[ih];
+					QIm[isub][ih][ipt] += tf*sinn[ih];
+				}
+				Sub_Ntrk[isub][ipt] += tf;
+			}
+		}
+	}
+
+	TComplex (*pQn[2])[N_ptbins] = {QnA,QnB};
+	for(int isub=0; isub<2; isub++){
+		int iside = (int)(etaConfig[isub][0] > 0.0);
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			for(int ih=2; ih<nh; ih++)
+				pQn[isub][ih][ipt] = TComplex(QRe[isub][ih][ipt],QIm[isub][ih][ipt])/Sub_Ntrk[isub][ipt];
+			NSubTracks_pt[iside][ipt] = Sub_Ntrk[isub][ipt];
+		}
+	}
+}
+//________________________________________________________________________
 TComplex AliJFFlucAnalysis::Q(int n, int p){
-	// Return QvectorQC
+	// Return the full-acceptance Q-vector
 	// Q{-n, p} = Q{n, p}*
 	if(n >= 0)
-		return QvectorQC[n][p];
-	return TComplex::Conjugate(QvectorQC[-n][p]);
+		return TComplex(fQvecRe[kFullQ][n][p],fQvecIm[kFullQ][n][p]);
+	return TComplex(fQvecRe[kFullQ][-n][p],-fQvecIm[kFullQ][-n][p]);
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Two(int n1, int n2 ){
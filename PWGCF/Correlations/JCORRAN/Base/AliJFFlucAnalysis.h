@@ -110,6 +110,8 @@ public:
 
 	enum{kH0, kH1, kH2, kH3, kH4, kH5, kH6, kH7, kH8, kH9, kH10, kH11, kH12, kNH}; //harmonics
 	enum{kK0, kK1, kK2, kK3, kK4, nKL}; // order
+	enum{kNHQ = 3*(kNH-1)+1}; // harmonics reached by the 3-particle terms of a subevent
+	enum{kSubQA, kSubQB, kFullQ, kNQ}; // Q-vector sets: eta-gap subevents and full acceptance
 #define kcNH kH6 //max second dimension + 1
 private:
 
@@ -140,8 +142,9 @@ private:
 	Double_t fQC_eta_cut_max;
 	Double_t fQC_eta_gap_half;
 
-	TComplex QvectorQC[kNH][nKL];
-	TComplex QvectorQCeta10[2][kNH][nKL]; // ksub
+	// Q-vectors [set][harmonic][power] kept as flat real/imaginary arrays
+	Double_t fQvecRe[kNQ][kNHQ][nKL];
+	Double_t fQvecIm[kNQ][kNHQ][nKL];
 
 	AliJHistManager * fHMG;//!
 
@@ -189,6 +192,7 @@ private:
 	enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 	double NSubTracks_pt[2][N_ptbins];
 	AliJBin fBin_Nptbins;//!
+	void CalculateQvectorsPt(const Double_t (*)[2], const Double_t *, int, TComplex (*)[N_ptbins], TComplex (*)[N_ptbins]);
 	AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 	AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
 	// additinal variables for SC with QC
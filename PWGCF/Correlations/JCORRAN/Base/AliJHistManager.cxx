@@ -269,6 +269,22 @@ void* AliJArrayBase::GetItem(){
     return item;
 }
 //_____________________________________________________
+void* AliJArrayBase::GetItem( const ArrayInt & index ){
+    // Set the full index tuple at once and return ( build if needed ) the item
+    if( int(index.size()) != Dimension() ){
+        JERROR( Form("Wrong number of indices %d for dimension %d", int(index.size()), Dimension()) );
+        return NULL;
+    }
+    for( int d=0;d<Dimension();d++ ){
+        if( OutOfSize( index[d], d ) ){
+            JERROR( Form("Wrong Index %d of %dth", index[d], d) );
+            return NULL;
+        }
+        fIndex[d] = index[d];
+    }
+    return GetItem();
+}
+//_____________________________________________________
 void* AliJArrayBase::GetSingleItem(){
     if(fMode == kSingle )return GetItem();
     JERROR("This is not single array");
@@ -31,6 +31,7 @@ class AliJTH1;
 class AliJHistManager;
 template<typename t> class AliJTH1Derived;
 template<typename t> class AliJTH1DerivedPlayer;
+template<typename t> class AliJTH1Handle;
 
 //////////////////////////////////////////////////////
 //  Utils
@@ -157,6 +158,7 @@ class AliJArrayBase : public AliJNamed{
         void ClearIndex(){ fIndex.clear();fIndex.resize( Dimension(), 0 ); }
 
         void * GetItem();
+        void * GetItem( const ArrayInt & index );
         void * GetSingleItem();
 
         ///void LockBin(bool is=true){}//TODO
@@ -318,6 +320,9 @@ class AliJTH1Derived : public AliJTH1 {
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
         T * operator->(){ return static_cast<T*>(GetSingleItem()); }
         operator T*(){ return static_cast<T*>(GetSingleItem()); }
+        // Resolve a full index tuple once, outside of the fill loop
+        T * Resolve( const ArrayInt & index ){ return static_cast<T*>(GetItem(index)); }
+        AliJTH1Handle<T> GetHandle( const ArrayInt & index ){ return AliJTH1Handle<T>( Resolve(index) ); }
         // Virtual from AliJArrayBase
 
         // Virtual from AliJTH1
@@ -365,11 +370,47 @@ class AliJTH1DerivedPlayer {
         operator T*(){ return static_cast<T*>(fCMD->GetItem()); } 
         operator TObject*(){ return static_cast<TObject*>(fCMD->GetItem()); } 
         operator TH1*(){ return static_cast<TH1*>(fCMD->GetItem()); } 
+        AliJTH1Handle<T> Handle(){ return AliJTH1Handle<T>( static_cast<T*>(fCMD->GetItem()) ); }
     private:
         int fLevel;
         AliJTH1Derived<T> * fCMD;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// AliJTH1Handle                                                        //
+//                                                                      //
+// Pre-resolved histogram of an AliJTH1Derived array. The index tuple   //
+// is resolved once ( h[i][j]...Handle() or GetHandle(index) ) and the  //
+// fills go directly to the histogram, with FillN for bulk fills.       //
+//////////////////////////////////////////////////////////////////////////
+template< typename T>
+class AliJTH1Handle {
+    public:
+        AliJTH1Handle( T * hist=NULL ):fHist(hist){}
+        bool IsValid() const { return fHist != NULL; }
+        T* operator->() const { return fHist; }
+        operator T*() const { return fHist; }
+        // w=NULL means unit weights
+        void FillN( int n, const double * x, const double * w=NULL ){
+            if( n>0 ) fHist->FillN( n, x, w );
+        }
+        // 2D histograms only, TH1::FillN(n,x,y,w) does nothing for 1D histograms
+        void FillN( int n, const double * x, const double * y, const double * w ){
+            TH2 * h2 = dynamic_cast<TH2*>( static_cast<TH1*>(fHist) );
+            if( !h2 ){ JERROR( "FillN : x,y fill of a histogram that is not 2D" ); return; }
+            if( n>0 ) h2->FillN( n, x, y, w );
+        }
+        void FillN( const std::vector<double> & x ){
+            FillN( x.size(), x.empty()?NULL:&x[0] );
+        }
+        void FillN( const std::vector<double> & x, const std::vector<double> & w ){
+            if( x.size() != w.size() ){ JERROR( "FillN : x and w size mismatch" ); return; }
+            FillN( x.size(), x.empty()?NULL:&x[0], w.empty()?NULL:&w[0] );
+        }
+    private:
+        T * fHist;
+};
+
 typedef AliJTH1Derived<TH1D> AliJTH1D;
 typedef AliJTH1Derived<TH2D> AliJTH2D;
 typedef AliJTH1Derived<TH3D> AliJTH3D;
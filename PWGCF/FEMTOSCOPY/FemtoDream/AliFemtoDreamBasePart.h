@@ -63,7 +63,7 @@ class AliFemtoDreamBasePart {
     return TVector3(-999,-999,-999);
   }
   ;
-  std::vector<TVector3> GetMomenta() const {
+  const std::vector<TVector3>& GetMomenta() const {
     return fP;
   }
   float GetP() const {
@@ -105,7 +105,7 @@ class AliFemtoDreamBasePart {
     fEta.push_back(eta);
   }
   ;
-  std::vector<float> GetEta() const {
+  const std::vector<float>& GetEta() const {
     return fEta;
   }
   ;
@@ -129,7 +129,7 @@ class AliFemtoDreamBasePart {
     fPhi.push_back(phi);
   }
   ;
-  std::vector<float> GetPhi() const {
+  const std::vector<float>& GetPhi() const {
     return fPhi;
   }
   ;
@@ -137,7 +137,7 @@ class AliFemtoDreamBasePart {
     fPhiAtRadius.push_back(phiAtRad);
   }
   ;
-  std::vector<std::vector<float>> GetPhiAtRaidius() const {
+  const std::vector<std::vector<float>>& GetPhiAtRaidius() const {
     return fPhiAtRadius;
   }
   ;
@@ -176,7 +176,7 @@ class AliFemtoDreamBasePart {
     fIDTracks.push_back(idTracks);
   }
   ;
-  std::vector<int> GetIDTracks() const {
+  const std::vector<int>& GetIDTracks() const {
     return fIDTracks;
   }
   ;
@@ -184,7 +184,7 @@ class AliFemtoDreamBasePart {
     fCharge.push_back(charge);
   }
   ;
-  std::vector<int> GetCharge() const {
+  const std::vector<int>& GetCharge() const {
     return fCharge;
   }
   ;
@@ -21,11 +21,20 @@ AliFemtoDreamHigherPairMath::AliFemtoDreamHigherPairMath(
       fDeltaEtaSqMax(conf->GetDeltaEtaMax() * conf->GetDeltaEtaMax()),
       fDeltaPhiEtaMax(conf->GetSqDeltaPhiEtaMax()),
       fRandom(),
-      fPi(TMath::Pi()) {
+      fPi(TMath::Pi()),
+      fPDGCodes(conf->GetPDGCodes()),
+      fMasses() {
   fRandom.SetSeed(0);
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
+  //Look up the masses of the species once, GetMass falls back to the
+  //data base for anything else
+  for (auto it : fPDGCodes) {
+    TParticlePDG *pdgPart =
+        (it != 0) ? TDatabasePDG::Instance()->GetParticle(it) : nullptr;
+    fMasses.push_back(pdgPart ? pdgPart->Mass() : -1.f);
+  }
 }
 
 AliFemtoDreamHigherPairMath::~AliFemtoDreamHigherPairMath() {
@@ -42,7 +51,9 @@ AliFemtoDreamHigherPairMath::AliFemtoDreamHigherPairMath(
       fDeltaEtaSqMax(samp.fDeltaEtaSqMax),
       fDeltaPhiEtaMax(samp.fDeltaPhiEtaMax),
       fRandom(),
-      fPi(TMath::Pi()) {
+      fPi(TMath::Pi()),
+      fPDGCodes(samp.fPDGCodes),
+      fMasses(samp.fMasses) {
   fRandom.SetSeed(0);
 }
 AliFemtoDreamHigherPairMath& AliFemtoDreamHigherPairMath::operator=(
@@ -60,6 +71,8 @@ AliFemtoDreamHigherPairMath& AliFemtoDreamHigherPairMath::operator=(
   fDeltaPhiEtaMax = math.fDeltaPhiEtaMax;
   fRandom = math.fRandom;
   fPi = TMath::Pi();
+  fPDGCodes = math.fPDGCodes;
+  fMasses = math.fMasses;
   return *this;
 }
 
@@ -149,9 +162,9 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
 // here cause we are
 // only looking at the mother mass
   PartOne.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                  GetMass(PDGPart1));
   PartTwo.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                  GetMass(PDGPart2));
   PartSum = PartOne + PartTwo;
   float PartSumPt = PartSum.Pt();
   float RelativeK = RelativePairMomentum(PartOne, PartTwo);
@@ -218,10 +231,8 @@ void AliFemtoDreamHigherPairMath::MassQA(int iHC, float RelK,
                                          AliFemtoDreamBasePart &part1, int PDGPart1,
                                          AliFemtoDreamBasePart &part2, int PDGPart2) {
   if (fWhichPairs.at(iHC) && fHists->GetDoMassQA()) {
-    const float massPart1 = TDatabasePDG::Instance()->GetParticle(
-              PDGPart1)->Mass();
-    const float massPart2 = TDatabasePDG::Instance()->GetParticle(
-              PDGPart2)->Mass();
+    const float massPart1 = GetMass(PDGPart1);
+    const float massPart2 = GetMass(PDGPart2);
     fHists->FillMassQADist(iHC, RelK, part1.GetInvMass(), part2.GetInvMass());
     fHists->FillPairInvMassQAD(iHC, part1, part2);
     fHists->FillPDGPairInvMassQAD(iHC, RelK, part1, massPart1, part2, massPart2);
@@ -231,10 +242,8 @@ void AliFemtoDreamHigherPairMath::MEMassQA(int iHC, float RelK,
                                          AliFemtoDreamBasePart &part1, int PDGPart1,
                                          AliFemtoDreamBasePart &part2, int PDGPart2) {
   if (fWhichPairs.at(iHC) && fHists->GetDoMassQA()) {
-    const float massPart1 = TDatabasePDG::Instance()->GetParticle(
-              PDGPart1)->Mass();
-    const float massPart2 = TDatabasePDG::Instance()->GetParticle(
-              PDGPart2)->Mass();
+    const float massPart1 = GetMass(PDGPart1);
+    const float massPart2 = GetMass(PDGPart2);
     fHists->FillMEMassQADist(iHC, RelK, part1.GetInvMass(), part2.GetInvMass());
     fHists->FillPairInvMEMassQAD(iHC, part1, part2);
     fHists->FillPDGPairInvMEMassQAD(iHC, RelK, part1, massPart1, part2, massPart2);
@@ -256,9 +265,9 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
 // here cause we are
 // only looking at the mother mass
   PartOne.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                  GetMass(PDGPart1));
   PartTwo.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                  GetMass(PDGPart2));
 // Do the randomization here
   if (mode == AliFemtoDreamCollConfig::kStravinsky) {
     if (fRandom.Uniform() < 0.5) {
@@ -318,10 +327,10 @@ void AliFemtoDreamHigherPairMath::SEDetaDPhiPlots(int iHC,
       TLorentzVector PartOne, PartTwo;
       PartOne.SetXYZM(part1.GetMCMomentum().X(), part1.GetMCMomentum().Y(),
                       part1.GetMCMomentum().Z(),
-                      TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                      GetMass(PDGPart1));
       PartTwo.SetXYZM(part2.GetMCMomentum().X(), part2.GetMCMomentum().Y(),
                       part2.GetMCMomentum().Z(),
-                      TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                      GetMass(PDGPart2));
       mT = RelativePairmT(PartOne, PartTwo);
     }
     if (dphi < 0) {
@@ -363,10 +372,10 @@ void AliFemtoDreamHigherPairMath::MEDetaDPhiPlots(int iHC,
       TLorentzVector PartOne, PartTwo;
       PartOne.SetXYZM(part1.GetMCMomentum().X(), part1.GetMCMomentum().Y(),
                       part1.GetMCMomentum().Z(),
-                      TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                      GetMass(PDGPart1));
       PartTwo.SetXYZM(part2.GetMCMomentum().X(), part2.GetMCMomentum().Y(),
                       part2.GetMCMomentum().Z(),
-                      TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                      GetMass(PDGPart2));
       mT = RelativePairmT(PartOne, PartTwo);
     }
     if (dphi < 0) {
@@ -393,10 +402,10 @@ void AliFemtoDreamHigherPairMath::SEMomentumResolution(
     // only looking at the mother mass
     PartOne.SetXYZM(part1->GetMCMomentum().X(), part1->GetMCMomentum().Y(),
                     part1->GetMCMomentum().Z(),
-                    TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                    GetMass(PDGPart1));
     PartTwo.SetXYZM(part2->GetMCMomentum().X(), part2->GetMCMomentum().Y(),
                     part2->GetMCMomentum().Z(),
-                    TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                    GetMass(PDGPart2));
     float RelKTrue = RelativePairMomentum(PartOne, PartTwo);
     fHists->FillMomentumResolutionSEAll(iHC, RelKTrue, RelativeK);
     if ((PDGPart1 == TMath::Abs(part1->GetMCPDGCode()))
@@ -422,10 +431,10 @@ void AliFemtoDreamHigherPairMath::MEMomentumResolution(
     // only looking at the mother mass
     PartOne.SetXYZM(part1->GetMCMomentum().X(), part1->GetMCMomentum().Y(),
                     part1->GetMCMomentum().Z(),
-                    TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                    GetMass(PDGPart1));
     PartTwo.SetXYZM(part2->GetMCMomentum().X(), part2->GetMCMomentum().Y(),
                     part2->GetMCMomentum().Z(),
-                    TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                    GetMass(PDGPart2));
     float RelKTrue = RelativePairMomentum(PartOne, PartTwo);
     fHists->FillMomentumResolutionMEAll(iHC, RelKTrue, RelativeK);
     if ((PDGPart1 == TMath::Abs(part1->GetMCPDGCode()))
@@ -516,10 +525,51 @@ float AliFemtoDreamHigherPairMath::RelativePairmT(TLorentzVector &PartOne,
   return results;
 }
 
-bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
-                                                   AliFemtoDreamBasePart &part1,
-                                                   AliFemtoDreamBasePart &part2,
-                                                   bool SEorME, float relk) {
+float AliFemtoDreamHigherPairMath::RelativePairMomentum(
+    const AliFemtoDreamPartKine &PartOne, const AliFemtoDreamPartKine &PartTwo) {
+  //k* = 0.5 * sqrt((q.P)^2/P^2 - q^2) with q = p1 - p2 and P = p1 + p2,
+  //identical to the momentum of either particle in the pair rest frame
+  const double qE = PartOne.fE - PartTwo.fE;
+  const double qx = PartOne.fPx - PartTwo.fPx;
+  const double qy = PartOne.fPy - PartTwo.fPy;
+  const double qz = PartOne.fPz - PartTwo.fPz;
+  const double PE = PartOne.fE + PartTwo.fE;
+  const double Px = PartOne.fPx + PartTwo.fPx;
+  const double Py = PartOne.fPy + PartTwo.fPy;
+  const double Pz = PartOne.fPz + PartTwo.fPz;
+  const double qP = qE * PE - qx * Px - qy * Py - qz * Pz;
+  const double PP = PE * PE - Px * Px - Py * Py - Pz * Pz;
+  const double qq = qE * qE - qx * qx - qy * qy - qz * qz;
+  const double kstar2 = (PP > 0) ? qP * qP / PP - qq : -qq;
+  return (kstar2 > 0) ? 0.5 * TMath::Sqrt(kstar2) : 0.;
+}
+
+float AliFemtoDreamHigherPairMath::RelativePairkT(
+    const AliFemtoDreamPartKine &PartOne, const AliFemtoDreamPartKine &PartTwo) {
+  const float Px = PartOne.fPx + PartTwo.fPx;
+  const float Py = PartOne.fPy + PartTwo.fPy;
+  return 0.5 * TMath::Sqrt(Px * Px + Py * Py);
+}
+
+float AliFemtoDreamHigherPairMath::RelativePairmT(
+    const AliFemtoDreamPartKine &PartOne, const AliFemtoDreamPartKine &PartTwo) {
+  const float pairKT = RelativePairkT(PartOne, PartTwo);
+  const float averageMass = 0.5 * (PartOne.fM + PartTwo.fM);
+  return TMath::Sqrt(pairKT * pairKT + averageMass * averageMass);
+}
+
+float AliFemtoDreamHigherPairMath::GetMass(int pdg) const {
+  for (unsigned int iSpec = 0; iSpec < fPDGCodes.size(); ++iSpec) {
+    if (fPDGCodes[iSpec] == pdg && fMasses[iSpec] >= 0) {
+      return fMasses[iSpec];
+    }
+  }
+  return TDatabasePDG::Instance()->GetParticle(pdg)->Mass();
+}
+
+bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(
+    int Hist, const AliFemtoDreamBasePart &part1,
+    const AliFemtoDreamBasePart &part2, bool SEorME, float relk) {
   bool pass = true;
   // if nDaug == 1 => Single Track, else decay
   unsigned int DoThisPair = fWhichPairs.at(Hist);
@@ -543,11 +593,11 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
             Hist, nDaug2, (unsigned int)part2.GetPhiAtRaidius().size());
     AliWarning(outMessage.Data());
   }
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
+  const std::vector<float> &eta1 = part1.GetEta();
+  const std::vector<float> &eta2 = part2.GetEta();
 
   for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
+    const std::vector<float> &PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
     float etaPar1;
     if (nDaug1 == 1) {
       etaPar1 = eta1.at(0);
@@ -555,7 +605,8 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
       etaPar1 = eta1.at(iDaug1 + 1);
     }
     for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
+      const std::vector<float> &phiAtRad2 = part2.GetPhiAtRaidius().at(
+          iDaug2);
       float etaPar2;
       if (nDaug2 == 1) {
         etaPar2 = eta2.at(0);
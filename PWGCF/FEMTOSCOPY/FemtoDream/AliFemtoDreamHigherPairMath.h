@@ -13,6 +13,7 @@
 #include "AliFemtoDreamBasePart.h"
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
+#include "AliFemtoDreamPartContainer.h"
 #include <vector>
 class AliFemtoDreamHigherPairMath {
  public:
@@ -91,10 +92,20 @@ class AliFemtoDreamHigherPairMath {
   static float RelativePairmT(AliFemtoDreamBasePart *PartOne, const int pdg1,
                               AliFemtoDreamBasePart *PartTwo, const int pdg2);
   static float RelativePairmT(TLorentzVector &PartOne, TLorentzVector &PartTwo);
+  //Pair kernel on the precomputed kinematics, k* is evaluated in the
+  //invariant form instead of boosting both particles into the pair rest frame
+  static float RelativePairMomentum(const AliFemtoDreamPartKine &PartOne,
+                                    const AliFemtoDreamPartKine &PartTwo);
+  static float RelativePairkT(const AliFemtoDreamPartKine &PartOne,
+                              const AliFemtoDreamPartKine &PartTwo);
+  static float RelativePairmT(const AliFemtoDreamPartKine &PartOne,
+                              const AliFemtoDreamPartKine &PartTwo);
+  float GetMass(int pdg) const;
 
  private:
-  bool DeltaEtaDeltaPhi(int Hist, AliFemtoDreamBasePart &part1,
-                        AliFemtoDreamBasePart &part2, bool SEorME, float relk);
+  bool DeltaEtaDeltaPhi(int Hist, const AliFemtoDreamBasePart &part1,
+                        const AliFemtoDreamBasePart &part2, bool SEorME,
+                        float relk);
   AliFemtoDreamCorrHists *fHists;
   std::vector<unsigned int> fWhichPairs;
   float fBField;
@@ -105,6 +116,8 @@ class AliFemtoDreamHigherPairMath {
   float fDeltaPhiEtaMax;
   TRandom3 fRandom;
   double fPi;
+  std::vector<int> fPDGCodes;   // particle species of the collection
+  std::vector<float> fMasses;   // cached masses of the species
 
 };
 
@@ -9,16 +9,21 @@
 #include "AliFemtoDreamPartContainer.h"
 #include "TLorentzVector.h"
 #include "TVector3.h"
+#include "TMath.h"
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
-      fMixingDepth(0) {
+      fMixingDepth(0),
+      fMass(0),
+      fKineBuffer() {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
-      fMixingDepth(MixingDepth) {
+      fMixingDepth(MixingDepth),
+      fMass(0),
+      fKineBuffer() {
 
 }
 
@@ -36,6 +41,8 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fMass = obj.fMass;
+  this->fKineBuffer = obj.fKineBuffer;
   return (*this);
 }
 
@@ -47,8 +54,13 @@ void AliFemtoDreamPartContainer::SetEvent(
   if (!(fPartBuffer.size() < fMixingDepth)) {
 //    std::cout << "Popping Front" << std::endl;
     fPartBuffer.pop_front();
+    if (!fKineBuffer.empty()) {
+      fKineBuffer.pop_front();
+    }
   }
   fPartBuffer.push_back(Particles);
+  fKineBuffer.emplace_back();
+  FillKinematics(fPartBuffer.back(), fMass, fKineBuffer.back());
 //  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
 //      << Particles.size() << '\n';
   return;
@@ -72,3 +84,31 @@ std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
       .begin() + Depth;
   return *itEvt;
 }
+
+const std::vector<AliFemtoDreamPartKine> &AliFemtoDreamPartContainer::GetKinematics(
+    int Depth) {
+  //The kinematics are transient, rebuild them if the buffer was read back
+  //or filled without them
+  if (fKineBuffer.size() != fPartBuffer.size()) {
+    fKineBuffer.resize(fPartBuffer.size());
+    for (unsigned int iEvt = 0; iEvt < fPartBuffer.size(); ++iEvt) {
+      FillKinematics(fPartBuffer[iEvt], fMass, fKineBuffer[iEvt]);
+    }
+  }
+  return fKineBuffer[Depth];
+}
+
+void AliFemtoDreamPartContainer::FillKinematics(
+    const std::vector<AliFemtoDreamBasePart> &Particles, float mass,
+    std::vector<AliFemtoDreamPartKine> &Kine) {
+  Kine.resize(Particles.size());
+  for (unsigned int iPart = 0; iPart < Particles.size(); ++iPart) {
+    const TVector3 &mom = Particles[iPart].GetMomenta().at(0);
+    AliFemtoDreamPartKine &kine = Kine[iPart];
+    kine.fPx = mom.X();
+    kine.fPy = mom.Y();
+    kine.fPz = mom.Z();
+    kine.fE = TMath::Sqrt(mom.Mag2() + mass * mass);
+    kine.fM = mass;
+  }
+}
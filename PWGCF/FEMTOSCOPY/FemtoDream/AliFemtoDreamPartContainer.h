@@ -13,6 +13,18 @@
 
 #include "AliFemtoDreamBasePart.h"
 
+//Compact kinematics of one particle, stored in the same order as the
+//particles of the event. The energy is computed once with the mass of the
+//particle species, so that the pair loops neither copy the particles nor look
+//up the mass in TDatabasePDG for every pair.
+struct AliFemtoDreamPartKine {
+  float fPx;
+  float fPy;
+  float fPz;
+  float fE;
+  float fM;
+};
+
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
@@ -24,18 +36,33 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
+  const std::deque<std::vector<AliFemtoDreamBasePart>>& GetEventBuffer() const {
     return fPartBuffer;
   }
   ;
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  const std::vector<AliFemtoDreamPartKine> &GetKinematics(int Depth);
+  void SetMass(float mass) {
+    fMass = mass;
+  }
+  ;
+  float GetMass() const {
+    return fMass;
+  }
+  ;
+  static void FillKinematics(const std::vector<AliFemtoDreamBasePart> &Particles,
+                             float mass,
+                             std::vector<AliFemtoDreamPartKine> &Kine);
   unsigned int GetMixingDepth() const {
     return fPartBuffer.size();
   }
   ;
  private:
   std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  unsigned int fMixingDepth;
+  float fMass;
+  std::deque<std::vector<AliFemtoDreamPartKine>> fKineBuffer;  //!
+  ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
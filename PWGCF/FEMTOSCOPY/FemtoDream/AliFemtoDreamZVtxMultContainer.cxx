@@ -15,9 +15,11 @@ ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
       fPDGParticleSpecies(0),
+      fMassSpecies(0),
       fWhichPairs(),
       fSummedPtLimit1(0.0),
-      fSummedPtLimit2(999.0){
+      fSummedPtLimit2(999.0),
+      fKineSE(){
 }
 
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
@@ -25,12 +27,25 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
       fPDGParticleSpecies(conf->GetPDGCodes()),
+      fMassSpecies(),
       fWhichPairs(conf->GetWhichPairs()),
       fSummedPtLimit1(conf->GetSummedPtLimit1()),
-      fSummedPtLimit2(conf->GetSummedPtLimit2()){
+      fSummedPtLimit2(conf->GetSummedPtLimit2()),
+      fKineSE(){
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
+  //The masses are needed for every pair, look them up only once
+  for (unsigned int iSpec = 0; iSpec < fPDGParticleSpecies.size(); ++iSpec) {
+    TParticlePDG *pdgPart =
+        (fPDGParticleSpecies[iSpec] != 0) ?
+            TDatabasePDG::Instance()->GetParticle(fPDGParticleSpecies[iSpec]) :
+            nullptr;
+    fMassSpecies.push_back(pdgPart ? pdgPart->Mass() : 0.f);
+    if (iSpec < fPartContainer.size()) {
+      fPartContainer[iSpec].SetMass(fMassSpecies.back());
+    }
+  }
 }
 
 AliFemtoDreamZVtxMultContainer::~AliFemtoDreamZVtxMultContainer() {
@@ -60,23 +75,39 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
   }
   //  }
 }
+void AliFemtoDreamZVtxMultContainer::FillKinematics(
+    const std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
+  fKineSE.resize(Particles.size());
+  for (unsigned int iSpec = 0; iSpec < Particles.size(); ++iSpec) {
+    const float mass =
+        (iSpec < fMassSpecies.size()) ? fMassSpecies[iSpec] : 0.f;
+    AliFemtoDreamPartContainer::FillKinematics(Particles[iSpec], mass,
+                                               fKineSE[iSpec]);
+  }
+}
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
+  FillKinematics(Particles);
   //First loop over all the different Species
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
       ++itSpec1) {
     auto itPDGPar2 = fPDGParticleSpecies.begin();
     itPDGPar2 += itSpec1 - Particles.begin();
+    const std::vector<AliFemtoDreamPartKine> &Kine1 = fKineSE[itSpec1
+        - Particles.begin()];
     for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
+      const std::vector<AliFemtoDreamPartKine> &Kine2 = fKineSE[itSpec2
+          - Particles.begin()];
       HigherMath->FillPairCounterSE(HistCounter, itSpec1->size(),
                                     itSpec2->size());
       //Now loop over the actual Particles and correlate them
       for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
           ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
+        const AliFemtoDreamPartKine &kine1 = Kine1[itPart1 - itSpec1->begin()];
         std::vector<AliFemtoDreamBasePart>::iterator itPart2;
         if (itSpec1 == itSpec2) {
           itPart2 = itPart1 + 1;
@@ -84,26 +115,17 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
           itPart2 = itSpec2->begin();
         }
         while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
-          TLorentzVector PartOne, PartTwo;
-          PartOne.SetXYZM(
-              itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-              itPart1->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-          PartTwo.SetXYZM(
-              itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-              itPart2->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-          float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
+          float RelativeK = HigherMath->RelativePairMomentum(
+              kine1, Kine2[itPart2 - itSpec2->begin()]);
           if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
                                                RelativeK, true, false)) {
             ++itPart2;
             continue;
           }
           RelativeK = HigherMath->FillSameEvent(HistCounter, iMult, cent,
-                                                part1,
+                                                *itPart1,
                                                 *itPDGPar1,
-                                                part2,
+                                                *itPart2,
                                                 *itPDGPar2,
 						fSummedPtLimit1,
 						fSummedPtLimit2);
@@ -127,6 +149,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
+  FillKinematics(Particles);
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   //First loop over all the different Species
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
@@ -135,6 +158,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     //Particle1 + Particle2 == Particle2 + Particle 1
     int SkipPart = itSpec1 - Particles.begin();
     auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
+    const std::vector<AliFemtoDreamPartKine> &Kine1 = fKineSE[SkipPart];
     for (auto itSpec2 = fPartContainer.begin() + SkipPart;
         itSpec2 != fPartContainer.end(); ++itSpec2) {
       if (itSpec1->size() > 0) {
@@ -142,25 +166,20 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
                                              (int) itSpec2->GetMixingDepth());
       }
       for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
+        //Work directly on the buffer, the particles are not copied
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec2->GetEvent(
             iDepth);
+        const std::vector<AliFemtoDreamPartKine> &Kine2 =
+            itSpec2->GetKinematics(iDepth);
         HigherMath->FillPairCounterME(HistCounter, itSpec1->size(),
                                       ParticlesOfEvent.size());
         for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
             ++itPart1) {
+          const AliFemtoDreamPartKine &kine1 = Kine1[itPart1 - itSpec1->begin()];
           for (auto itPart2 = ParticlesOfEvent.begin();
               itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-
-            TLorentzVector PartOne, PartTwo;
-            PartOne.SetXYZM(
-                itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-            PartTwo.SetXYZM(
-                itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-            float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
+            float RelativeK = HigherMath->RelativePairMomentum(
+                kine1, Kine2[itPart2 - ParticlesOfEvent.begin()]);
             if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
                                                  RelativeK, false, false)) {
               continue;
@@ -36,6 +36,8 @@ class AliFemtoDreamZVtxMultContainer {
   float ComputeDeltaPhi(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
+  void FillKinematics(
+      const std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   TString ClassName() {
     return "zVtxMult Container";
   }
@@ -43,6 +45,7 @@ class AliFemtoDreamZVtxMultContainer {
  private:
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
+  std::vector<float> fMassSpecies;
   std::vector<unsigned int> fWhichPairs;
 //  std::vector<bool> fRejPairs;
 //  bool fDoDeltaEtaDeltaPhiCut;
@@ -51,7 +54,8 @@ class AliFemtoDreamZVtxMultContainer {
 //  float fDeltaPhiEtaMax;
   float fSummedPtLimit1;
   float fSummedPtLimit2;
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+  std::vector<std::vector<AliFemtoDreamPartKine>> fKineSE;  //!
+ClassDef(AliFemtoDreamZVtxMultContainer, 5)
   ;
 };
 
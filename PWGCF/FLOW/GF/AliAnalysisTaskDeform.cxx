@@ -425,6 +425,7 @@ void AliAnalysisTaskDeform::UserCreateOutputObjects(){
     fGFW->AddRegion("OLprN",5,pows,-0.8,-0.4,1,256);
     fGFW->AddRegion("OLprP",5,pows,0.4,0.8,1,256);*/
     CreateCorrConfigs();
+    CompileCorrConfigs();
     //Covariance
     fCovList = new TList();
     fCovList->SetOwner(kTRUE);
@@ -970,13 +971,15 @@ for(Int_t i=0;i<1;i++) { //No PID = index is only 1
   PostData(1,fptVarList);
   //Filling FCs
   for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
-    Bool_t filled = FillFCs(corrconfigs.at(l_ind),l_Multi,l_Random);
+    Bool_t filled = FillFCs(l_ind,l_Multi,l_Random);
   };
   PostData(2,fFC);
+  //All covariance profiles have the same number of subsamples
+  Int_t l_SubInd = fCovariance[0]->GetSubIndex(l_Random);
   for(Int_t i=0;i<1;i++) {
-    FillCovariance(fCovariance[i],corrconfigs.at(i*4),l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_Random);
-    FillCovariance(fCovariance[i+4],corrconfigs.at((i+1)*4),l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_Random);
-    FillCovariance(fCovariance[8],corrconfigs.at(14),l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_Random);
+    FillCovariance(fCovariance[i],i*4,l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_SubInd);
+    FillCovariance(fCovariance[i+4],(i+1)*4,l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_SubInd);
+    FillCovariance(fCovariance[8],14,l_Multi,outVals[i][3]-outVals[i][0],wp[i][0],l_SubInd);
     //following is not necessary since we don't have any POIs
   };
   PostData(3,fCovList);
@@ -987,8 +990,8 @@ for(Int_t i=0;i<1;i++) { //No PID = index is only 1
   fV2dPtMulti->Fill(l_Multi);
   // printf("Will use dpt v2 profile index %i (out of %i-1), multiplicity is %f\n",indx,fV2dPtList->GetEntries(),l_Multi);
   if(indx==1) fdPt->Fill(outVals[0][3]/outVals[0][0]-1);
-  Fillv2dPtFCs(corrconfigs.at(0),outVals[0][3]/outVals[0][0]-1,0,indx);
-  Fillv2dPtFCs(corrconfigs.at(4),outVals[0][3]/outVals[0][0]-1,0,indx);
+  Fillv2dPtFCs(0,outVals[0][3]/outVals[0][0]-1,0,indx);
+  Fillv2dPtFCs(4,outVals[0][3]/outVals[0][0]-1,0,indx);
   PostData(4,fV2dPtList);
 }
 void AliAnalysisTaskDeform::ProduceALICEPublished_MptProd(AliAODEvent *fAOD, const Double_t &vz, const Double_t &l_Cent, Double_t *vtxp) {
@@ -1124,27 +1127,31 @@ void AliAnalysisTaskDeform::ProduceEfficiencies(AliAODEvent *fAOD, const Double_
   PostData(1,fEfficiencyList);
 }
 
-Bool_t AliAnalysisTaskDeform::FillFCs(const AliGFW::CorrConfig &corconf, const Double_t &cent, const Double_t &rndmn, const Bool_t debug) {
+Bool_t AliAnalysisTaskDeform::FillFCs(const Int_t &confInd, const Double_t &cent, const Double_t &rndmn, const Bool_t debug) {
+  const AliGFW::CorrConfig &corconf = corrconfigs.at(confInd);
   Double_t dnx, val;
-  dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
+  dnx = fGFW->CalculateCompiled(fCorrDen.at(confInd)).Re();
   if(debug) printf("FillFCs: dnx = %f\n",dnx);
   if(dnx==0) return kFALSE;
   if(!corconf.pTDif) {
-    val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
+    val = fGFW->CalculateCompiled(fCorrNum.at(confInd)).Re()/dnx;
     if(debug) printf("FillFCs: val = %f\n",val);
-    if(TMath::Abs(val)<1)
-      fFC->FillProfile(corconf.Head.Data(),cent,val,fUseWeightsOne?1:dnx,rndmn);
+    if(TMath::Abs(val)<1) {
+      if(!fFCIndex.at(confInd)) fFCIndex.at(confInd) = fFC->GetProfileIndex(corconf.Head.Data());
+      fFC->FillProfileByIndex(fFCIndex.at(confInd),cent,val,fUseWeightsOne?1:dnx,rndmn);
+    };
     return kTRUE;
   };
   return kTRUE;
 };
-Bool_t AliAnalysisTaskDeform::Fillv2dPtFCs(const AliGFW::CorrConfig &corconf, const Double_t &dpt, const Double_t &rndmn, const Int_t index) {
+Bool_t AliAnalysisTaskDeform::Fillv2dPtFCs(const Int_t &confInd, const Double_t &dpt, const Double_t &rndmn, const Int_t index) {
   if(!index || index>fV2dPtList->GetEntries()) return kFALSE;
+  const AliGFW::CorrConfig &corconf = corrconfigs.at(confInd);
   Double_t dnx, val;
-  dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
+  dnx = fGFW->CalculateCompiled(fCorrDen.at(confInd)).Re();
   if(dnx==0) return kFALSE;
   if(!corconf.pTDif) {
-    val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
+    val = fGFW->CalculateCompiled(fCorrNum.at(confInd)).Re()/dnx;
     if(TMath::Abs(val)<1)
       ((AliGFWFlowContainer*)fV2dPtList->At(index))->FillProfile(corconf.Head.Data(),dpt,val,fUseWeightsOne?1:dnx,rndmn);
     return kTRUE;
@@ -1152,14 +1159,14 @@ Bool_t AliAnalysisTaskDeform::Fillv2dPtFCs(const AliGFW::CorrConfig &corconf, co
   return kTRUE;
 };
 
-Bool_t AliAnalysisTaskDeform::FillCovariance(AliProfileBS *target, const AliGFW::CorrConfig &corconf, const Double_t &cent, const Double_t &d_mpt, const Double_t &dw_mpt, const Double_t &l_rndm) {
+Bool_t AliAnalysisTaskDeform::FillCovariance(AliProfileBS *target, const Int_t &confInd, const Double_t &cent, const Double_t &d_mpt, const Double_t &dw_mpt, const Int_t &subInd) {
   Double_t dnx, val;
-  dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
+  dnx = fGFW->CalculateCompiled(fCorrDen.at(confInd)).Re();
   if(dnx==0) return kFALSE;
-  if(!corconf.pTDif) {
-    val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
+  if(!corrconfigs.at(confInd).pTDif) {
+    val = fGFW->CalculateCompiled(fCorrNum.at(confInd)).Re()/dnx;
     if(TMath::Abs(val)<1)
-      target->FillProfile(cent,val*d_mpt,fUseWeightsOne?1:dnx*dw_mpt,l_rndm);
+      target->FillProfileBySubIndex(cent,val*d_mpt,fUseWeightsOne?1:dnx*dw_mpt,subInd);
     return kTRUE;
   };
   return kTRUE;
@@ -1209,8 +1216,17 @@ void AliAnalysisTaskDeform::CreateCorrConfigs() {
   corrconfigs.push_back(GetConf("PrNeg22","prN {2} refP {-2}", kFALSE));
   corrconfigs.push_back(GetConf("PrPos24","prP refP | OLprP {2 2} refN {-2 -2}", kFALSE));
   corrconfigs.push_back(GetConf("PrNeg24","prN refN | OLprN {2 2} refP {-2 -2}", kFALSE));
-
-
+};
+void AliAnalysisTaskDeform::CompileCorrConfigs() {
+  //Compile the correlators once, they are then evaluated by handle in the event loop
+  fCorrNum.clear();
+  fCorrDen.clear();
+  for(Int_t i=0;i<(Int_t)corrconfigs.size();i++) {
+    fCorrNum.push_back(fGFW->CompileCorrelator(corrconfigs.at(i),kFALSE));
+    fCorrDen.push_back(fGFW->CompileCorrelator(corrconfigs.at(i),kTRUE));
+  };
+  //Profile indices in fFC are resolved at the first fill
+  fFCIndex.assign(corrconfigs.size(),0);
 };
 void AliAnalysisTaskDeform::GetSingleWeightFromList(AliGFWWeights **inWeights, TString pf) {
   (*inWeights) = (AliGFWWeights*)fWeightList->FindObject(Form("weight_%s",pf.Data()));
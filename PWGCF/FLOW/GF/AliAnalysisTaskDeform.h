@@ -62,6 +62,7 @@ class AliAnalysisTaskDeform : public AliAnalysisTaskSE {
   Int_t GetStageSwitch(TString instr);
   AliGFW::CorrConfig GetConf(TString head, TString desc, Bool_t ptdif) { return fGFW->GetCorrelatorConfig(desc,head,ptdif);};
   void CreateCorrConfigs();
+  void CompileCorrConfigs();
   void LoadWeightAndMPT();
   void GetSingleWeightFromList(AliGFWWeights **inWeights, TString pf="");
   Bool_t WithinSigma(Double_t SigmaCut, AliAODTrack *inTrack, AliPID::EParticleType partType);
@@ -150,6 +151,9 @@ class AliAnalysisTaskDeform : public AliAnalysisTaskSE {
   AliGFWFlowContainer *fFC;
   AliGFW *fGFW; //! not stored
   vector<AliGFW::CorrConfig> corrconfigs; //! do not store
+  vector<Int_t> fCorrNum; //! compiled correlators of corrconfigs
+  vector<Int_t> fCorrDen; //! compiled normalizations (harmonics set to 0) of corrconfigs
+  vector<Int_t> fFCIndex; //! profile indices of corrconfigs in fFC, 0 if not resolved yet
   TList *fSpectraList;
   TH2D **fSpectra;
   TList *fEfficiencyList;
@@ -157,16 +161,16 @@ class AliAnalysisTaskDeform : public AliAnalysisTaskSE {
   TH1D **fEfficiencies; //TH1Ds for picking up efficiencies
   TH1D *fV0MMulti;
   TH1D *fV2dPtMulti;
-  Bool_t FillFCs(const AliGFW::CorrConfig &corconf, const Double_t &cent, const Double_t &rndmn, const Bool_t deubg=kFALSE);
-  Bool_t Fillv2dPtFCs(const AliGFW::CorrConfig &corconf, const Double_t &dpt, const Double_t &rndmn, const Int_t index);
-  Bool_t FillCovariance(AliProfileBS* target, const AliGFW::CorrConfig &corconf, const Double_t &cent, const Double_t &d_mpt, const Double_t &dw_mpt, const Double_t &l_rndm);
+  Bool_t FillFCs(const Int_t &confInd, const Double_t &cent, const Double_t &rndmn, const Bool_t deubg=kFALSE);
+  Bool_t Fillv2dPtFCs(const Int_t &confInd, const Double_t &dpt, const Double_t &rndmn, const Int_t index);
+  Bool_t FillCovariance(AliProfileBS* target, const Int_t &confInd, const Double_t &cent, const Double_t &d_mpt, const Double_t &dw_mpt, const Int_t &subInd);
   Bool_t AcceptAODTrack(AliAODTrack *lTr, Double_t*, const Double_t &ptMin=0.5, const Double_t &ptMax=2, Double_t *vtxp=0);
   Bool_t AcceptAODTrack(AliAODTrack *lTr, Double_t*, const Double_t &ptMin, const Double_t &ptMax, Double_t *vtxp, Int_t &nTot);
   Bool_t fDisablePID;
   UInt_t fConsistencyFlag;
   Bool_t fRequireReloadOnRunChange;
   Double_t *GetBinsFromAxis(TAxis *inax);
-  ClassDef(AliAnalysisTaskDeform,5);
+  ClassDef(AliAnalysisTaskDeform,6);
 };
 
 #endif
\ No newline at end of file
@@ -360,6 +360,174 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   // return retval;
 };
 
+Int_t AliGFW::AddSlot(CorrPlan &plan, Int_t cumulant, Int_t n, Int_t p, Bool_t ptdif) {
+  if(cumulant<0 || cumulant>=(Int_t)fCumulants.size()) return -1;
+  AliGFWCumulant *lCumulant = &fCumulants.at(cumulant);
+  Int_t an = n<0?-n:n;
+  if(an>=lCumulant->GetNHarmonics() || p<0 || p>=lCumulant->PW(an)) return -1;
+  CorrSlot lSlot;
+  lSlot.Cumulant = cumulant;
+  lSlot.QIndex = lCumulant->QIndex(n,p);
+  lSlot.Conj = (n<0);
+  lSlot.PtDif = ptdif;
+  for(Int_t i=0;i<(Int_t)plan.Slots.size();i++) if(plan.Slots.at(i)==lSlot) return i;
+  plan.Slots.push_back(lSlot);
+  return (Int_t)plan.Slots.size()-1;
+};
+Bool_t AliGFW::CompileRecursive(CorrPlan &plan, Int_t qpoi, Int_t qref, Int_t qol, vector<Int_t> &hars, vector<Int_t> &pows, vector<CorrTerm> &terms) {
+  //Symbolic version of RecursiveCorr: same recursion, but instead of evaluating, the Q-vectors are recorded as slots of the plan
+  terms.clear();
+  if((pows.at(0)!=1) && qol>-1) qpoi=qol;
+  if(hars.size()<2) {
+    Int_t s0 = AddSlot(plan,qpoi,hars.at(0),pows.at(0),kTRUE);
+    if(s0<0) return kFALSE;
+    terms.push_back(CorrTerm{1.,{s0}});
+    return kTRUE;
+  };
+  if(hars.size()<3) { //Same as TwoRec
+    Int_t s0 = AddSlot(plan,qpoi,hars.at(0),pows.at(0),kTRUE);
+    Int_t s1 = AddSlot(plan,qref,hars.at(1),pows.at(1),kTRUE);
+    if(s0<0 || s1<0) return kFALSE;
+    terms.push_back(CorrTerm{1.,{s0,s1}});
+    if(qol>-1) {
+      Int_t s2 = AddSlot(plan,qol,hars.at(0)+hars.at(1),pows.at(0)+pows.at(1),kTRUE);
+      if(s2<0) return kFALSE;
+      terms.push_back(CorrTerm{-1.,{s2}});
+    };
+    return kTRUE;
+  };
+  Int_t harlast=hars.at(hars.size()-1);
+  Int_t powlast=pows.at(pows.size()-1);
+  hars.erase(hars.end()-1);
+  pows.erase(pows.end()-1);
+  Bool_t lOK = CompileRecursive(plan, qpoi, qref, qol, hars, pows, terms);
+  Int_t slast = AddSlot(plan,qref,harlast,powlast,kFALSE); //RecursiveCorr takes the last reference Q-vector from pt bin 0
+  if(slast<0) lOK=kFALSE;
+  for(Int_t j=0;j<(Int_t)terms.size();j++) terms.at(j).Slots.push_back(slast);
+  Int_t lDegeneracy=1;
+  Int_t harSize = (Int_t)hars.size();
+  vector<CorrTerm> subterms;
+  for(Int_t i=harSize-1;i>=0;i--) {
+    if(i>2) {
+      if(hars.at(i) == hars.at(i-1) && pows.at(i) == pows.at(i-1)) {
+        lDegeneracy++;
+        continue;
+      };
+    }
+    hars.at(i)+=harlast;
+    pows.at(i)+=powlast;
+    if(!CompileRecursive(plan, qpoi, qref, qol, hars, pows, subterms)) lOK=kFALSE;
+    for(Int_t j=0;j<(Int_t)subterms.size();j++) {
+      subterms.at(j).Coef *= -lDegeneracy;
+      terms.push_back(subterms.at(j));
+    };
+    lDegeneracy=1;
+    hars.at(i)-=harlast;
+    pows.at(i)-=powlast;
+  };
+  hars.push_back(harlast);
+  pows.push_back(powlast);
+  return lOK;
+};
+void AliGFW::MergeTerms(vector<CorrTerm> &terms) {
+  //Products commute, so terms with the same set of Q-vectors are combined
+  for(Int_t i=0;i<(Int_t)terms.size();i++) std::sort(terms.at(i).Slots.begin(),terms.at(i).Slots.end());
+  std::sort(terms.begin(),terms.end());
+  vector<CorrTerm> merged;
+  for(Int_t i=0;i<(Int_t)terms.size();i++) {
+    if(merged.size() && merged.back().Slots==terms.at(i).Slots) merged.back().Coef+=terms.at(i).Coef;
+    else merged.push_back(terms.at(i));
+  };
+  terms.clear();
+  for(Int_t i=0;i<(Int_t)merged.size();i++) if(merged.at(i).Coef!=0) terms.push_back(merged.at(i));
+};
+Int_t AliGFW::CompileCorrelator(const CorrConfig &corconf, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
+  if(!fInitialized) CreateRegions();
+  if(!fInitialized) {
+    printf("AliGFW::CompileCorrelator: no regions defined, cannot compile %s\n",corconf.Head.Data());
+    return -1;
+  };
+  CorrPlan lPlan;
+  for(Int_t i=0;i<(Int_t)corconf.Regs.size();i++) {
+    //Empty subevent: the correlator is always 0, same as in Calculate(CorrConfig,...)
+    if(corconf.Regs.at(i).size()==0 || corconf.Hars.at(i).size()==0) { lPlan.Subevents.clear(); break; };
+    CorrSubevent lSub;
+    lSub.Poi = corconf.Regs.at(i).at(0);
+    lSub.Ref = (corconf.Regs.at(i).size()>1)?corconf.Regs.at(i).at(1):corconf.Regs.at(i).at(0);
+    if(lSub.Poi<0 || lSub.Poi>=(Int_t)fCumulants.size() || lSub.Ref<0 || lSub.Ref>=(Int_t)fCumulants.size()) {
+      printf("AliGFW::CompileCorrelator: invalid region in %s\n",corconf.Head.Data());
+      return -1;
+    };
+    Int_t ovl = corconf.Overlap.at(i);
+    Int_t qovl = -1;
+    if(ovl > -1) qovl = DisableOverlap?-1:ovl;
+    else if(lSub.Ref==lSub.Poi) qovl = lSub.Ref;
+    vector<Int_t> hars = corconf.Hars.at(i);
+    if(SetHarmsToZero) for(Int_t j=0;j<(Int_t)hars.size();j++) hars.at(j) = 0;
+    vector<Int_t> pows(hars.size(),1);
+    lSub.MinRef = (Int_t)hars.size();
+    if(lSub.Poi!=lSub.Ref) lSub.MinRef--;
+    if(!CompileRecursive(lPlan, lSub.Poi, lSub.Ref, qovl, hars, pows, lSub.Terms)) {
+      printf("AliGFW::CompileCorrelator: harmonics or powers of %s exceed the ones defined for the regions\n",corconf.Head.Data());
+      return -1;
+    };
+    MergeTerms(lSub.Terms);
+    lPlan.Subevents.push_back(lSub);
+  };
+  fPlans.push_back(lPlan);
+  return (Int_t)fPlans.size()-1;
+};
+TComplex AliGFW::CalculateCompiled(Int_t handle, Int_t ptbin) {
+  if(handle<0 || handle>=(Int_t)fPlans.size()) {
+    printf("AliGFW::CalculateCompiled: correlator %i not compiled!\n",handle);
+    return TComplex(0,0);
+  };
+  CorrPlan &lPlan = fPlans[handle];
+  if(lPlan.Subevents.size()==0) return TComplex(0,0);
+  for(Int_t i=0;i<(Int_t)lPlan.Subevents.size();i++) {
+    const CorrSubevent &lSub = lPlan.Subevents[i];
+    AliGFWCumulant *qref = &fCumulants[lSub.Ref];
+    AliGFWCumulant *qpoi = &fCumulants[lSub.Poi];
+    if(!qref->IsPtBinFilled(ptbin)) return TComplex(0,0);
+    if(!qpoi->IsPtBinFilled(ptbin)) return TComplex(0,0);
+    if(qref->GetN() < lSub.MinRef) return TComplex(0,0);
+  };
+  //Fetch each Q-vector of the plan once
+  Int_t nSlots = (Int_t)lPlan.Slots.size();
+  if((Int_t)fSlotRe.size()<nSlots) {
+    fSlotRe.resize(nSlots);
+    fSlotIm.resize(nSlots);
+  };
+  for(Int_t i=0;i<nSlots;i++) {
+    const CorrSlot &lSlot = lPlan.Slots[i];
+    AliGFWCumulant *lCumulant = &fCumulants[lSlot.Cumulant];
+    Int_t lPt = lSlot.PtDif?ptbin:0;
+    if(lPt>=lCumulant->GetNPtBins() || lPt<0) lPt=0;
+    fSlotRe[i] = lCumulant->QRe(lSlot.QIndex,lPt);
+    fSlotIm[i] = lSlot.Conj?-lCumulant->QIm(lSlot.QIndex,lPt):lCumulant->QIm(lSlot.QIndex,lPt);
+  };
+  Double_t retRe=1, retIm=1; //Same starting value as in Calculate(CorrConfig,...)
+  for(Int_t i=0;i<(Int_t)lPlan.Subevents.size();i++) {
+    const vector<CorrTerm> &lTerms = lPlan.Subevents[i].Terms;
+    Double_t sumRe=0, sumIm=0;
+    for(Int_t j=0;j<(Int_t)lTerms.size();j++) {
+      Double_t tRe=lTerms[j].Coef, tIm=0;
+      const vector<Int_t> &lSlots = lTerms[j].Slots;
+      for(Int_t k=0;k<(Int_t)lSlots.size();k++) {
+        Double_t lRe = tRe*fSlotRe[lSlots[k]] - tIm*fSlotIm[lSlots[k]];
+        tIm = tRe*fSlotIm[lSlots[k]] + tIm*fSlotRe[lSlots[k]];
+        tRe = lRe;
+      };
+      sumRe+=tRe;
+      sumIm+=tIm;
+    };
+    Double_t lRe = retRe*sumRe - retIm*sumIm;
+    retIm = retRe*sumIm + retIm*sumRe;
+    retRe = lRe;
+  };
+  return TComplex(retRe,retIm);
+};
+
 TComplex AliGFW::Calculate(Int_t poi, vector<Int_t> hars) {
   AliGFWCumulant *qpoi = &fCumulants.at(poi);
   return RecursiveCorr(qpoi, qpoi, qpoi, 0, hars);
@@ -50,6 +50,31 @@ class AliGFW {
     Bool_t pTDif=kFALSE;
     TString Head="";
   };
+  //Precompiled correlator: each subevent is expanded into a sum of products of Q-vectors,
+  //with all region names, harmonics and powers resolved to indices at initialization
+  struct CorrSlot {
+    Int_t Cumulant; //index of the region
+    Int_t QIndex; //index of (harmonic, power) within a pt bin
+    Bool_t Conj; //negative harmonic
+    Bool_t PtDif; //evaluated in the requested pt bin (otherwise in pt bin 0)
+    bool operator==(const CorrSlot& a) const {
+      return Cumulant==a.Cumulant && QIndex==a.QIndex && Conj==a.Conj && PtDif==a.PtDif;
+    };
+  };
+  struct CorrTerm {
+    Double_t Coef;
+    vector<Int_t> Slots;
+    bool operator<(const CorrTerm& a) const { return Slots < a.Slots; };
+  };
+  struct CorrSubevent {
+    Int_t Poi, Ref;
+    Int_t MinRef; //minimal number of particles in the reference region
+    vector<CorrTerm> Terms;
+  };
+  struct CorrPlan {
+    vector<CorrSlot> Slots;
+    vector<CorrSubevent> Subevents;
+  };
   AliGFW();
   ~AliGFW();
   vector<Region> fRegions;
@@ -64,6 +89,10 @@ class AliGFW {
   TComplex Calculate(TString config, Bool_t SetHarmsToZero=kFALSE);
   CorrConfig GetCorrelatorConfig(TString config, TString head = "", Bool_t ptdif=kFALSE);
   TComplex Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  //Compile a correlator once (e.g. in UserCreateOutputObjects) and evaluate it by handle in the event loop
+  Int_t CompileCorrelator(const CorrConfig &corconf, Bool_t SetHarmsToZero=kFALSE, Bool_t DisableOverlap=kFALSE);
+  TComplex CalculateCompiled(Int_t handle, Int_t ptbin=0);
+  Int_t GetNCompiled() { return (Int_t)fPlans.size(); };
  private:
   Bool_t fInitialized;
   void SplitRegions();
@@ -78,6 +107,13 @@ class AliGFW {
   vector<TString> fCalculatedNames;
   vector<TComplex> fCalculatedQs;
   Int_t FindCalculated(TString identifier);
+  //Correlator compilation:
+  vector<CorrPlan> fPlans; //! compiled correlators
+  vector<Double_t> fSlotRe; //! evaluated Q-vectors of a plan, Re
+  vector<Double_t> fSlotIm; //! evaluated Q-vectors of a plan, Im
+  Int_t AddSlot(CorrPlan &plan, Int_t cumulant, Int_t n, Int_t p, Bool_t ptdif);
+  Bool_t CompileRecursive(CorrPlan &plan, Int_t qpoi, Int_t qref, Int_t qol, vector<Int_t> &hars, vector<Int_t> &pows, vector<CorrTerm> &terms);
+  void MergeTerms(vector<CorrTerm> &terms);
   //Calculateing functions:
   TComplex Calculate(Int_t poi, Int_t ref, vector<Int_t> hars, Int_t ptbin=0); //For differential, need POI and reference
   TComplex Calculate(Int_t poi, vector<Int_t> hars); //For integrated case
@@ -5,7 +5,14 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "AliGFWCumulant.h"
 
 AliGFWCumulant::AliGFWCumulant():
-  fQvector(0),
+  fQRe(0),
+  fQIm(0),
+  fPowOffset(0),
+  fNQ(0),
+  fTrigRe(0),
+  fTrigIm(0),
+  fWPow(0),
+  fMaxPow(0),
   fUsed(kBlank),
   fNEntries(-1),
   fN(1),
@@ -27,47 +34,54 @@ void AliGFWCumulant::FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t
   if(fPt==1) ptin=0; //If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
   else if(ptin<0 || ptin>=fPt) return;
   fFilledPts[ptin] = kTRUE;
+  //cos(n*phi) and sin(n*phi) from the angle addition recurrence, only one sin/cos call per track
+  Double_t lCos1 = TMath::Cos(phi);
+  Double_t lSin1 = TMath::Sin(phi);
+  fTrigRe[0] = 1.;
+  fTrigIm[0] = 0.;
+  for(Int_t lN = 1; lN<fN; lN++) {
+    fTrigRe[lN] = fTrigRe[lN-1]*lCos1 - fTrigIm[lN-1]*lSin1;
+    fTrigIm[lN] = fTrigRe[lN-1]*lSin1 + fTrigIm[lN-1]*lCos1;
+  };
+  //Weight powers. If second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
+  //this is important when POIs are a subset of REFs and have different weights than REFs
+  fWPow[0] = 1.;
+  for(Int_t lPow=1; lPow<fMaxPow; lPow++)
+    fWPow[lPow] = fWPow[lPow-1]*((SecondWeight>0 && lPow>1)?SecondWeight:weight);
+  Double_t *lQRe = fQRe + ptin*fNQ;
+  Double_t *lQIm = fQIm + ptin*fNQ;
   for(Int_t lN = 0; lN<fN; lN++) {
-    Double_t lSin = TMath::Sin(lN*phi); //No need to recalculate for each power
-    Double_t lCos = TMath::Cos(lN*phi); //No need to recalculate for each power
-    for(Int_t lPow=0; lPow<PW(lN); lPow++) {
-      Double_t lPrefactor = 0;
-      //Dont calculate it twice; multiplication is cheaper that power
-      //Also, if second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
-      //this is important when POIs are a subset of REFs and have different weights than REFs
-      if(SecondWeight>0 && lPow>1) lPrefactor = TMath::Power(SecondWeight, lPow-1)*weight;
-      else lPrefactor = TMath::Power(weight,lPow);
-      Double_t qsin = lPrefactor * lSin;
-      Double_t qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow](fQvector[ptin][lN][lPow].Re()+qcos,fQvector[ptin][lN][lPow].Im()+qsin);//+=TComplex(qcos,qsin);
+    Double_t lCos = fTrigRe[lN];
+    Double_t lSin = fTrigIm[lN];
+    Double_t *lRe = lQRe + fPowOffset[lN];
+    Double_t *lIm = lQIm + fPowOffset[lN];
+    Int_t lNPow = PW(lN);
+    for(Int_t lPow=0; lPow<lNPow; lPow++) {
+      lRe[lPow] += fWPow[lPow]*lCos;
+      lIm[lPow] += fWPow[lPow]*lSin;
     };
   };
   Inc();
 };
 void AliGFWCumulant::ResetQs() {
   if(!fNEntries) return; //If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
-  for(Int_t i=0; i<fPt; i++) {
-    fFilledPts[i] = kFALSE;
-    for(Int_t lN=0;lN<fN;lN++) {
-      for(Int_t lPow=0;lPow<PW(lN);lPow++) {
-  	       fQvector[i][lN][lPow](0.,0.);
-      };
-    };
+  for(Int_t i=0; i<fPt; i++) fFilledPts[i] = kFALSE;
+  for(Int_t i=0; i<fPt*fNQ; i++) {
+    fQRe[i] = 0.;
+    fQIm[i] = 0.;
   };
   fNEntries=0;
 };
 void AliGFWCumulant::DestroyComplexVectorArray() {
   if(!fInitialized) return;
-  for(Int_t l_n = 0; l_n<fN; l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      delete [] fQvector[i][l_n];
-    };
-  };
-  for(Int_t i=0;i<fPt;i++) {
-    delete [] fQvector[i];
-  };
-  delete [] fQvector;
+  delete [] fQRe;
+  delete [] fQIm;
+  delete [] fPowOffset;
+  delete [] fTrigRe;
+  delete [] fTrigIm;
+  delete [] fWPow;
   delete [] fFilledPts;
+  fQRe=0; fQIm=0; fPowOffset=0; fTrigRe=0; fTrigIm=0; fWPow=0; fFilledPts=0;
   fInitialized=kFALSE;
   fNEntries=-1;
 };
@@ -85,21 +99,26 @@ void AliGFWCumulant::CreateComplexVectorArrayVarPower(Int_t N, vector<Int_t> Pow
   fPt=Pt;
   fFilledPts = new Bool_t[Pt];
   fPowVec = PowVec;
-  fQvector = new TComplex**[fPt];
-  for(Int_t i=0;i<fPt;i++) {
-    fQvector[i] = new TComplex*[fN];
-  };
+  fPowOffset = new Int_t[fN];
+  fNQ=0;
+  fMaxPow=0;
   for(Int_t l_n=0;l_n<fN;l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      fQvector[i][l_n] = new TComplex[PW(l_n)];
-    };
+    fPowOffset[l_n] = fNQ;
+    fNQ+=PW(l_n);
+    if(PW(l_n)>fMaxPow) fMaxPow=PW(l_n);
   };
+  fQRe = new Double_t[fPt*fNQ];
+  fQIm = new Double_t[fPt*fNQ];
+  fTrigRe = new Double_t[fN];
+  fTrigIm = new Double_t[fN];
+  fWPow = new Double_t[fMaxPow>0?fMaxPow:1];
   ResetQs();
   fInitialized=kTRUE;
 };
 TComplex AliGFWCumulant::Vec(Int_t n, Int_t p, Int_t ptbin) {
   if(!fInitialized) return 0;
   if(ptbin>=fPt || ptbin<0) ptbin=0;
-  if(n>=0) return fQvector[ptbin][n][p];
-  return TComplex::Conjugate(fQvector[ptbin][-n][p]);
+  Int_t qind = ptbin*fNQ+QIndex(n,p);
+  if(n>=0) return TComplex(fQRe[qind],fQIm[qind]);
+  return TComplex(fQRe[qind],-fQIm[qind]);
 };
@@ -20,11 +20,25 @@ class AliGFWCumulant {
   void Inc() { fNEntries++; };
   Int_t GetN() { return fNEntries; };
   // protected:
-  TComplex ***fQvector;
+  //Q-vectors are stored in flat arrays of real and imaginary parts, [pt][harmonic][power]
+  Double_t *fQRe; //! Re(Q)
+  Double_t *fQIm; //! Im(Q)
+  Int_t *fPowOffset; //! Offset of the first power of each harmonic within one pt bin
+  Int_t fNQ; //! Number of Q-vectors per pt bin
+  Double_t *fTrigRe; //! cos(n*phi) of the current track
+  Double_t *fTrigIm; //! sin(n*phi) of the current track
+  Double_t *fWPow; //! Weight powers of the current track
+  Int_t fMaxPow; //! Max. number of powers over all harmonics
   UInt_t fUsed;
   Int_t fNEntries;
   //Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
   TComplex Vec(Int_t, Int_t, Int_t ptbin=0); //envelope class to summarize pt-dif. Q-vec getter
+  //Index of the Q-vector (n,p) within a pt bin. No checks, only to be used for precompiled correlators
+  Int_t QIndex(Int_t n, Int_t p) { return fPowOffset[n<0?-n:n]+p; };
+  Int_t GetNPtBins() { return fPt; };
+  Int_t GetNHarmonics() { return fN; };
+  Double_t QRe(Int_t qind, Int_t ptbin) { return fQRe[ptbin*fNQ+qind]; };
+  Double_t QIm(Int_t qind, Int_t ptbin) { return fQIm[ptbin*fNQ+qind]; };
   Int_t fN; //! Harmonics
   Int_t fPow; //! Power
   vector<Int_t> fPowVec; //! Powers array
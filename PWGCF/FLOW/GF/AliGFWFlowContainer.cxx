@@ -117,6 +117,19 @@ Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double
     printf("Could not find bin %s\n",hname);
     return -1;
   };
+  return FillProfileByIndex(yin,multi,corr,w,rn);
+};
+Int_t AliGFWFlowContainer::GetProfileIndex(const char *hname) {
+  if(!fProf) return -1;
+  Int_t yin = fProf->GetYaxis()->FindBin(hname);
+  if(!yin) {
+    printf("Could not find bin %s\n",hname);
+    return -1;
+  };
+  return yin;
+};
+Int_t AliGFWFlowContainer::FillProfileByIndex(Int_t yin, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  if(!fProf || yin<1) return -1;
   fProf->Fill(multi,yin,corr,w);
   if(fNRandom) {
     Double_t rnind = rn*fNRandom;
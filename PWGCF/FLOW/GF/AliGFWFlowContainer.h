@@ -35,6 +35,9 @@ class AliGFWFlowContainer:public TNamed {
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  //Profile handle (y-bin) to be resolved once at initialization and used with FillProfileByIndex
+  Int_t GetProfileIndex(const char *hname);
+  Int_t FillProfileByIndex(Int_t yin, Double_t multi, Double_t y, Double_t w, Double_t rn);
   TProfile2D *GetProfile() { return fProf; };
   void OverrideProfileErrors(TProfile2D *inpf);
   void ReadAndMerge(const char *infile);
@@ -3,26 +3,37 @@ AliProfileBS::AliProfileBS():
   TProfile(),
   fListOfEntries(0),
   fProfInitialized(kFALSE),
-  fNSubs(0)
+  fNSubs(0),
+  fSubProfiles(0),
+  fNSubProfiles(0),
+  fSubProfilesList(0)
 {
 };
 AliProfileBS::~AliProfileBS() {
+  delete [] fSubProfiles;
   delete fListOfEntries;
 };
 AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, const Double_t* xbins):
   TProfile(name,title,nbinsx,xbins),
   fListOfEntries(0),
   fProfInitialized(kTRUE),
-  fNSubs(0)
+  fNSubs(0),
+  fSubProfiles(0),
+  fNSubProfiles(0),
+  fSubProfilesList(0)
 {};
 AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, Double_t xlow, Double_t xup):
   TProfile(name,title,nbinsx,xlow,xup),
   fListOfEntries(0),
   fProfInitialized(kFALSE),
-  fNSubs(0)
+  fNSubs(0),
+  fSubProfiles(0),
+  fNSubProfiles(0),
+  fSubProfilesList(0)
 {};
 void AliProfileBS::InitializeSubsamples(Int_t nSub) {
   if(nSub<1) {printf("Number of subprofiles has to be > 0!\n"); return; };
+  InvalidateSubProfileCache();
   if(fListOfEntries) delete fListOfEntries;
   fListOfEntries = new TList();
   fListOfEntries->SetOwner(kTRUE);
@@ -32,6 +43,21 @@ void AliProfileBS::InitializeSubsamples(Int_t nSub) {
     ((TProfile*)fListOfEntries->At(i))->Reset();
   }
   fNSubs = nSub;
+  BuildSubProfileCache();
+}
+void AliProfileBS::BuildSubProfileCache() {
+  InvalidateSubProfileCache();
+  fSubProfilesList = fListOfEntries;
+  fNSubProfiles = fListOfEntries?fListOfEntries->GetEntries():0;
+  if(!fNSubProfiles) return;
+  fSubProfiles = new TProfile*[fNSubProfiles];
+  for(Int_t i=0;i<fNSubProfiles;i++) fSubProfiles[i] = (TProfile*)fListOfEntries->At(i);
+}
+void AliProfileBS::InvalidateSubProfileCache() {
+  delete [] fSubProfiles;
+  fSubProfiles=0;
+  fNSubProfiles=0;
+  fSubProfilesList=0;
 }
 void AliProfileBS::FillProfile(const Double_t &xv, const Double_t& yv, const Double_t &w, const Double_t &rn) {
   TProfile::Fill(xv,yv,w);
@@ -40,6 +66,15 @@ void AliProfileBS::FillProfile(const Double_t &xv, const Double_t& yv, const Dou
   if(targetInd>=fNSubs) targetInd = 0;
   ((TProfile*)fListOfEntries->At(targetInd))->Fill(xv,yv,w);
 }
+void AliProfileBS::FillProfileBySubIndex(const Double_t &xv, const Double_t &yv, const Double_t &w, Int_t subInd) {
+  TProfile::Fill(xv,yv,w);
+  if(subInd<0 || subInd>=fNSubs) return;
+  //Subprofiles are looked up in the list only once (also after reading from file or merging),
+  //the cache is rebuilt whenever fListOfEntries was replaced
+  if(fSubProfilesList!=fListOfEntries || fNSubProfiles!=fNSubs) BuildSubProfileCache();
+  if(subInd>=fNSubProfiles) return;
+  fSubProfiles[subInd]->Fill(xv,yv,w);
+}
 void AliProfileBS::FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w) {
   TProfile::Fill(xv,yv,w);
 }
@@ -69,6 +104,7 @@ Long64_t AliProfileBS::Merge(TCollection *collist) {
     TList *tarL = l_PBS->fListOfEntries;
     if(!tarL) continue;
     if(!fListOfEntries) {
+      InvalidateSubProfileCache();
       fListOfEntries = (TList*)tarL->Clone();
       for(Int_t i=0; i<fListOfEntries->GetEntries(); i++) ((TProfile*)fListOfEntries->At(i))->Reset();
     };
@@ -18,12 +18,20 @@ public:
   void InitializeSubsamples(Int_t nSub);
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w, const Double_t &rn);
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w);
+  //Subsample handle: resolve once per event and fill all profiles with the same index
+  Int_t GetSubIndex(const Double_t &rn) { if(!fNSubs) return -1; Int_t targetInd = rn*fNSubs; return (targetInd>=fNSubs)?0:targetInd; };
+  void FillProfileBySubIndex(const Double_t &xv, const Double_t &yv, const Double_t &w, Int_t subInd);
   Long64_t Merge(TCollection *collist);
   void RebinMulti(Int_t nbins);
   TH1 *getHist(Int_t ind=-1);
-  ClassDef(AliProfileBS,1);
+  ClassDef(AliProfileBS,2);
 protected:
   Bool_t fProfInitialized;
   Int_t fNSubs;
+  TProfile **fSubProfiles; //! direct access to subprofiles, rebuilt from fListOfEntries
+  Int_t fNSubProfiles; //! size of fSubProfiles
+  TList *fSubProfilesList; //! fListOfEntries the cache was built from
+  void BuildSubProfileCache();
+  void InvalidateSubProfileCache();
 };
 #endif
@@ -36,6 +36,7 @@
 #include "TH1F.h"
 #include "TF1.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <utility>
@@ -76,7 +77,23 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fHistControlMatches(NULL),
   fSecHistControlMatches(NULL),
   fDoLightOutput(kFALSE),
-  fMassHypothesis(0.139)
+  fMassHypothesis(0.139),
+  fClusterRows(),
+  fClusterRowStart(),
+  fClusterMatchTrack(),
+  fClusterMatchDEta(),
+  fClusterMatchDPhi(),
+  fClusterMatchCharge(),
+  fClusterMatchPt(),
+  fTrackRows(),
+  fTrackRowStart(),
+  fTrackRowCharge(),
+  fTrackRowPt(),
+  fTrackMatchCluster(),
+  fTrackMatchDEta(),
+  fTrackMatchDPhi(),
+  fTrackIDToPos(),
+  fTrackIDToPosFilled(kFALSE)
 {
     // Default constructor
     DefineInput(0, TChain::Class());
@@ -98,6 +115,7 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     fSecVectorDeltaEtaDeltaPhi.clear();
     fSecMap_TrID_ClID_ToIndex.clear();
     fSecMap_TrID_ClID_AlreadyTried.clear();
+    ClearMatchTables();
 
     if(fHistControlMatches) delete fHistControlMatches;
     if(fSecHistControlMatches) delete fSecHistControlMatches;
@@ -120,6 +138,7 @@ void AliCaloTrackMatcher::Terminate(Option_t *){
   fSecVectorDeltaEtaDeltaPhi.clear();
   fSecMap_TrID_ClID_ToIndex.clear();
   fSecMap_TrID_ClID_AlreadyTried.clear();
+  ClearMatchTables();
 }
 
 //________________________________________________________________________
@@ -193,6 +212,7 @@ void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   fSecVectorDeltaEtaDeltaPhi.clear();
   fSecMap_TrID_ClID_ToIndex.clear();
   fSecMap_TrID_ClID_AlreadyTried.clear();
+  ClearMatchTables();
 
   if(fRunNumber == -1 || fRunNumber != runNumber){
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
@@ -213,6 +233,10 @@ void AliCaloTrackMatcher::UserExec(Option_t *){
 
   //DebugV0Matching();
 
+  // track ID -> position table of the previous event is not valid anymore
+  fTrackIDToPos.clear();
+  fTrackIDToPosFilled = kFALSE;
+
   // do processing only for EMCal (1), DCal (3) or PHOS (2) clusters, otherwise do nothing
   if(fClusterType == 1 || fClusterType == 2 || fClusterType == 3 || fClusterType == 4){
     Initialize(fInputEvent->GetRunNumber());
@@ -533,6 +557,7 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     else FillfHistControlMatches(6.,inTrack->Pt());
     delete trackParam;
   }
+  FillMatchTables(event);
 
   return;
 }
@@ -775,22 +800,118 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
   return kTRUE;
 }
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t matched = 0;
+void AliCaloTrackMatcher::ClearMatchTables(){
+  fClusterRows.clear();
+  fClusterRowStart.clear();
+  fClusterMatchTrack.clear();
+  fClusterMatchDEta.clear();
+  fClusterMatchDPhi.clear();
+  fClusterMatchCharge.clear();
+  fClusterMatchPt.clear();
+  fTrackRows.clear();
+  fTrackRowStart.clear();
+  fTrackRowCharge.clear();
+  fTrackRowPt.clear();
+  fTrackMatchCluster.clear();
+  fTrackMatchDEta.clear();
+  fTrackMatchDPhi.clear();
+  fTrackIDToPos.clear();
+  fTrackIDToPosFilled = kFALSE;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::FillMatchTables(AliVEvent *event){
+  // fill the compressed tables of this event's matches from the multimaps, keeping their order:
+  // one row per cluster ID and per track position with the range of its matches in the entry
+  // arrays, residuals, charge and pt stored along with each match. Tables are empty on entry.
   multimap<Int_t,Int_t>::iterator it;
+  mapT::iterator itRes;
   for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    itRes = fMap_TrID_ClID_ToIndex.find(make_pair(tempTrack->GetID(),it->first));
+    if(itRes == fMap_TrID_ClID_ToIndex.end() || itRes->second == 0) continue;
+    if(fClusterRows.empty() || fClusterRows.back() != it->first){
+      fClusterRows.push_back(it->first);
+      fClusterRowStart.push_back(fClusterMatchTrack.size());
+    }
+    fClusterMatchTrack.push_back(it->second);
+    fClusterMatchDEta.push_back(fVectorDeltaEtaDeltaPhi.at(itRes->second-1).first);
+    fClusterMatchDPhi.push_back(fVectorDeltaEtaDeltaPhi.at(itRes->second-1).second);
+    fClusterMatchCharge.push_back(tempTrack->Charge());
+    fClusterMatchPt.push_back(tempTrack->Pt());
+  }
+  fClusterRowStart.push_back(fClusterMatchTrack.size());
+
+  it = fMapTrackToCluster.begin();
+  while (it!=fMapTrackToCluster.end()){
+    multimap<Int_t,Int_t>::iterator itEnd = fMapTrackToCluster.upper_bound(it->first);
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->first));
+    if(tempTrack){
+      fTrackRows.push_back(it->first);
+      fTrackRowStart.push_back(fTrackMatchCluster.size());
+      fTrackRowCharge.push_back(tempTrack->Charge());
+      fTrackRowPt.push_back(tempTrack->Pt());
+      for (; it!=itEnd; ++it){
+        itRes = fMap_TrID_ClID_ToIndex.find(make_pair(tempTrack->GetID(),it->second));
+        if(itRes == fMap_TrID_ClID_ToIndex.end() || itRes->second == 0) continue;
+        fTrackMatchCluster.push_back(it->second);
+        fTrackMatchDEta.push_back(fVectorDeltaEtaDeltaPhi.at(itRes->second-1).first);
+        fTrackMatchDPhi.push_back(fVectorDeltaEtaDeltaPhi.at(itRes->second-1).second);
       }
     }
+    it = itEnd;
+  }
+  fTrackRowStart.push_back(fTrackMatchCluster.size());
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::FindMatchRow(const vector<Int_t> &rows, Int_t key){
+  vector<Int_t>::const_iterator row = lower_bound(rows.begin(), rows.end(), key);
+  if(row == rows.end() || *row != key) return -1;
+  return row - rows.begin();
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetTrackPosition(AliVEvent *event, Int_t trackID){
+  if(event->IsA()!=AliAODEvent::Class()) return trackID; // for ESD just take trackID
+
+  // for AOD, we have to look for position of track in the event, table is filled once per event
+  if(!fTrackIDToPosFilled){
+    fTrackIDToPos.clear();
+    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
+      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
+      if(!currTrack) continue;
+      // even though hybrid tracks don't contain dublicates
+      // the hybrid track can share an ID with another copy if it is a copy
+      if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
+      fTrackIDToPos.push_back(make_pair(currTrack->GetID(),iTrack));
+    }
+    // sorted by ID, then position: first track with a given ID comes first
+    sort(fTrackIDToPos.begin(), fTrackIDToPos.end());
+    fTrackIDToPosFilled = kTRUE;
+  }
+
+  vector<pairInt>::const_iterator it = lower_bound(fTrackIDToPos.begin(), fTrackIDToPos.end(), make_pair(trackID,-1));
+  if(it == fTrackIDToPos.end() || it->first != trackID){
+    AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
+    return -1;
+  }
+  return it->second;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
+  Int_t matched = 0;
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return matched;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Float_t tempDEta = fClusterMatchDEta[i], tempDPhi = fClusterMatchDPhi[i];
+    if(fClusterMatchCharge[i]>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+    }else if(fClusterMatchCharge[i]<0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
+    }
   }
 
   return matched;
@@ -799,24 +920,18 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
-    }
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return matched;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(fClusterMatchDEta[i]) < fFuncPtDepEta->Eval(fClusterMatchPt[i])) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(fClusterMatchDPhi[i]) < fFuncPtDepPhi->Eval(fClusterMatchPt[i])) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )matched++;
   }
   return matched;
 }
@@ -824,52 +939,27 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return matched;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Float_t tempDEta = fClusterMatchDEta[i], tempDPhi = fClusterMatchDPhi[i];
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
   }
   return matched;
 }
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
-      }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return matched;
+  Short_t charge = fTrackRowCharge[row];
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Float_t tempDEta = fTrackMatchDEta[i], tempDPhi = fTrackMatchDPhi[i];
+    if(charge>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+    }else if(charge<0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
     }
   }
   return matched;
@@ -877,73 +967,32 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-
-      }
-    }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return matched;
+  Double_t pt = fTrackRowPt[row];
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(fTrackMatchDEta[i]) < fFuncPtDepEta->Eval(pt)) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(fTrackMatchDPhi[i]) < fFuncPtDepPhi->Eval(pt)) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )matched++;
   }
   return matched;
 }
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-       AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return matched;
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Float_t tempDEta = fTrackMatchDEta[i], tempDPhi = fTrackMatchDPhi[i];
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
   }
   return matched;
 }
@@ -951,19 +1000,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){ 
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
-      }
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return tempMatchedTracks;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Float_t tempDEta = fClusterMatchDEta[i], tempDPhi = fClusterMatchDPhi[i];
+    if(fClusterMatchCharge[i]>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
+    }else if(fClusterMatchCharge[i]<0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
     }
   }
   return tempMatchedTracks;
@@ -972,25 +1016,18 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-
-      }
-    }
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return tempMatchedTracks;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(fClusterMatchDEta[i]) < fFuncPtDepEta->Eval(fClusterMatchPt[i])) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(fClusterMatchDPhi[i]) < fFuncPtDepPhi->Eval(fClusterMatchPt[i])) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )tempMatchedTracks.push_back(fClusterMatchTrack[i]);
   }
   return tempMatchedTracks;
 }
@@ -998,51 +1035,27 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
-    }
+  Int_t row = FindMatchRow(fClusterRows, clusterID);
+  if(row < 0) return tempMatchedTracks;
+  for (Int_t i=fClusterRowStart[row]; i<fClusterRowStart[row+1]; i++){
+    Float_t tempDEta = fClusterMatchDEta[i], tempDPhi = fClusterMatchDPhi[i];
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
   }
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
-      }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return tempMatchedClusters;
+  Short_t charge = fTrackRowCharge[row];
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Float_t tempDEta = fTrackMatchDEta[i], tempDPhi = fTrackMatchDPhi[i];
+    if(charge>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
+    }else if(charge<0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
     }
   }
 
@@ -1051,71 +1064,32 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-       AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
-    }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return tempMatchedClusters;
+  Double_t pt = fTrackRowPt[row];
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(fTrackMatchDEta[i]) < fFuncPtDepEta->Eval(pt)) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(fTrackMatchDPhi[i]) < fFuncPtDepPhi->Eval(pt)) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+
+    if (match_dPhi && match_dEta )tempMatchedClusters.push_back(fTrackMatchCluster[i]);
   }
   return tempMatchedClusters;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliAODTrack* currTrack  = static_cast<AliAODTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        // even though hybrid tracks don't contain dublicates
-        // the hybrid track can share an ID with another copy if it is a copy
-        if(fRunningMode==7 &&!currTrack->IsHybridGlobalConstrainedGlobal()) continue;
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
-    }
+  Int_t row = FindMatchRow(fTrackRows, GetTrackPosition(event, trackID));
+  if(row < 0) return tempMatchedClusters;
+  for (Int_t i=fTrackRowStart[row]; i<fTrackRowStart[row+1]; i++){
+    Float_t tempDEta = fTrackMatchDEta[i], tempDPhi = fTrackMatchDPhi[i];
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
   }
   return tempMatchedClusters;
 }
@@ -1144,17 +1118,16 @@ Bool_t AliCaloTrackMatcher::IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t c
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
       }
     }
   }
@@ -1166,22 +1139,21 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
 
@@ -1192,14 +1164,13 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1224,15 +1195,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
-        }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) matched++;
       }
     }
   }
@@ -1258,21 +1228,20 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
 
@@ -1297,12 +1266,11 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1313,17 +1281,16 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedTracks.push_back(it->second);
       }
     }
   }
@@ -1335,22 +1302,21 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
     }
   }
 
@@ -1361,14 +1327,13 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapClusterToTrack.upper_bound(clusterID);
+  for (it=fSecMapClusterToTrack.lower_bound(clusterID); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
     }
   }
 
@@ -1393,15 +1358,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (-dPhiMin > tempDPhi) && (tempDPhi > -dPhiMax) ) tempMatchedClusters.push_back(it->second);
       }
     }
   }
@@ -1427,20 +1391,19 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
     }
   }
 
@@ -1465,12 +1428,11 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  multimap<Int_t,Int_t>::iterator itEnd = fSecMapTrackToCluster.upper_bound(TrackPos);
+  for (it=fSecMapTrackToCluster.lower_bound(TrackPos); it!=itEnd; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
     }
   }
 
@@ -93,6 +93,12 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
 
+    // per event match tables for the cluster <-> primary queries
+    void ClearMatchTables();
+    void FillMatchTables(AliVEvent *event);
+    Int_t GetTrackPosition(AliVEvent *event, Int_t trackID);
+    static Int_t FindMatchRow(const vector<Int_t> &rows, Int_t key);
+
     // debug methods
     void DebugMatching();
     void DebugV0Matching();
@@ -144,7 +150,27 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Bool_t                fDoLightOutput;          // switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
 
     Double_t              fMassHypothesis;          // mass used for track propagation to calorimeter surface
-    ClassDef(AliCaloTrackMatcher,10)
+
+    // compressed copies of fMapClusterToTrack and fMapTrackToCluster, filled at the end of ProcessEvent:
+    // sorted row keys, the matches of row i are the entries from RowStart[i] to RowStart[i+1] in multimap order
+    vector<Int_t>         fClusterRows;            //! cluster IDs with matched tracks
+    vector<Int_t>         fClusterRowStart;        //! first entry of each cluster, one more for the end
+    vector<Int_t>         fClusterMatchTrack;      //! matched track (position in event for AOD, ID for ESD)
+    vector<Float_t>       fClusterMatchDEta;       //! matching residual in eta
+    vector<Float_t>       fClusterMatchDPhi;       //! matching residual in phi
+    vector<Short_t>       fClusterMatchCharge;     //! charge of the matched track
+    vector<Double_t>      fClusterMatchPt;         //! pt of the matched track
+    vector<Int_t>         fTrackRows;              //! track positions with matched clusters
+    vector<Int_t>         fTrackRowStart;          //! first entry of each track, one more for the end
+    vector<Short_t>       fTrackRowCharge;         //! charge of the track
+    vector<Double_t>      fTrackRowPt;             //! pt of the track
+    vector<Int_t>         fTrackMatchCluster;      //! matched cluster ID
+    vector<Float_t>       fTrackMatchDEta;         //! matching residual in eta
+    vector<Float_t>       fTrackMatchDPhi;         //! matching residual in phi
+    vector<pairInt>       fTrackIDToPos;           //! (track ID, position in event) of AOD tracks, sorted
+    Bool_t                fTrackIDToPosFilled;     //! fTrackIDToPos is filled for the current event
+
+    ClassDef(AliCaloTrackMatcher,11)
 };
 
 #endif
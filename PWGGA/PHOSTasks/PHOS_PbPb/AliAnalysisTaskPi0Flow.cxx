@@ -35,6 +35,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskPi0Flow.h"
 #include "AliCaloPhoton.h"
+#include "AliPi0FlowPhotonStore.h"
 #include "AliPHOSGeometry.h"
 #include "TGeoManager.h"
 #include "AliPHOSEsdCluster.h"
@@ -125,7 +126,9 @@ AliAnalysisTaskPi0Flow::AliAnalysisTaskPi0Flow(const char *name, Period period)
   fRPV0C(0),
   fEMRPBin(0),
   fCaloPhotonsPHOS(0x0),
-  fCaloPhotonsPHOSLists(0x0)
+  fMixedPhotons(0x0),
+  fPairHists(),
+  fHistPHOSphi(0x0)
 {
   const int nbins = 9;
   Double_t edges[nbins+1] = {0., 5., 10., 20., 30., 40., 50., 60., 70., 80.};
@@ -137,6 +140,10 @@ AliAnalysisTaskPi0Flow::AliAnalysisTaskPi0Flow(const char *name, Period period)
   for(int mod=1; mod <= kNMod; ++mod)
     fModuleEnabled[mod-1] = kTRUE;
 
+  for(Int_t i=0; i<kNMod; i++)
+    for(Int_t j=0; j<kNMod; j++)
+      fHistPi0Mod[i][j]=0x0 ;
+
   for(Int_t i=0;i<kNCenBins;i++){
     for(Int_t j=0;j<2; j++)
       for(Int_t k=0; k<2; k++) {
@@ -172,7 +179,7 @@ AliAnalysisTaskPi0Flow::~AliAnalysisTaskPi0Flow()
   delete fNonLinCorr;
   delete fESDtrackCuts;
   delete fPHOSCalibData;
-  delete fCaloPhotonsPHOSLists;
+  delete fMixedPhotons;
   if(fTPCFlat)delete fTPCFlat;  fTPCFlat=0x0;
   if(fV0AFlat)delete fV0AFlat;  fV0AFlat=0x0;
   if(fV0CFlat)delete fV0CFlat;  fV0CFlat=0x0;
@@ -373,10 +380,15 @@ void AliAnalysisTaskPi0Flow::UserCreateOutputObjects()
     fOutputContainer->Add(new TH2F(key,"Both clusters",nM,mMin,mMax,nPtPhot,0.,ptPhotMax));
   }
   
-  // Setup photon lists
+  // Setup photon pools for mixing
   Int_t kapacity = kNVtxZBins * GetNumberOfCentralityBins() * fNEMRPBins;
-  fCaloPhotonsPHOSLists = new TObjArray(kapacity);
-  fCaloPhotonsPHOSLists->SetOwner();
+  Int_t maxNMixed = 0;
+  for(Int_t cent=0; cent<fCentNMixed.GetSize(); cent++)
+    maxNMixed = TMath::Max(maxNMixed, fCentNMixed[cent]);
+  fMixedPhotons = new AliPi0FlowPhotonStore();
+  fMixedPhotons->Init(kapacity, maxNMixed);
+
+  BuildPairHistTables();
   
   PostData(1, fOutputContainer);
 }
@@ -904,14 +916,15 @@ void AliAnalysisTaskPi0Flow::FillSelectedClusterHistograms()
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0s()
 {
-  char key[55];
+  TH1 * const * table = GetPairHistTable(kFALSE) ;
   for (Int_t i1=0; i1 < fCaloPhotonsPHOS->GetEntriesFast()-1; i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     for (Int_t i2=i1+1; i2<fCaloPhotonsPHOS->GetEntriesFast(); i2++) {
       AliCaloPhoton * ph2=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i2) ;
       TLorentzVector p12  = *ph1  + *ph2;
       TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-      FillHistogram("hPHOSphi",fCentrality,p12.Pt(),p12.Phi());
+      if(fHistPHOSphi)
+        static_cast<TH3*>(fHistPHOSphi)->Fill(fCentrality,p12.Pt(),p12.Phi());
       Double_t dphiA=p12.Phi()-fRPV0A ;
       while(dphiA<0)dphiA+=TMath::Pi() ;
       while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
@@ -935,497 +948,211 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0s()
       Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
       if( fFillWideTOF ) {
-	FillHistogram(Form("hPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	FillPairHistogram(table,kPairWideTOF,kHPi0,m,pt,1.) ;
+	FillPairHistogram(table,kPairWideTOF,kHSingle,m,pt1,1.) ;
+	FillPairHistogram(table,kPairWideTOF,kHSingle,m,pt2,1.) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	  FillPairHistogram(table,kPairWideTOF,kHMassPtTPC,m,pt,dphiT,1.) ;
       }
 
       if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
 	continue;
 
-      FillHistogram(Form("hMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
-      if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
-
-      FillHistogram(Form("hMassPtV0AAllcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAllcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-      if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAllcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-
-
-      FillHistogram(Form("hPi0All_cen%d",fCentBin),m,pt) ;
-      FillHistogram(Form("hPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
-      if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-        FillHistogram(Form("hPi0Allwou_cen%d",fCentBin),m,pt) ;
-        FillHistogram(Form("hMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-        FillHistogram(Form("hMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
-        if(fHaveTPCRP)
-          FillHistogram(Form("hMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
-      }
+      const UInt_t pidMask = GetPairPIDMask(ph1,ph2) ;
+      FillPairHistograms(table,pidMask,ph1->IsntUnfolded() && ph2->IsntUnfolded(),a<kAlphaCut,
+                         m,pt,mcore,ptcore,dphiA,dphiC,dphiT,1.) ;
 
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt1) ;
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt2) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+      FillPairHistogram(table,kPairAll,kHSingle,m,pt1,1.) ;
+      FillPairHistogram(table,kPairAll,kHSingle,m,pt2,1.) ;
+      FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore1,1.) ;
+      FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore2,1.) ;
       if(ph1->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt1) ;
+        FillPairHistogram(table,kPairAll,kHSinglewou,m,pt1,1.) ;
       if(ph2->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt2) ;
+        FillPairHistogram(table,kPairAll,kHSinglewou,m,pt2,1.) ;
       if(ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairCPV,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(table,kPairCPV,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore2,1.) ;
       }
       if(ph1->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(table,kPairCPV2,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2,1.) ;
       }
       if(ph2->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(table,kPairCPV2,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2,1.) ;
       }
       if(ph1->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt1) ;
+        FillPairHistogram(table,kPairDisp,kHSingle,m,pt1,1.) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt1) ;
+          FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt1,1.) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph2->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt2) ;
+        FillPairHistogram(table,kPairDisp,kHSingle,m,pt2,1.) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt2) ;
+          FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt2,1.) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore2,1.) ;
       }
       if(ph1->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairDisp2,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph2->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairDisp2,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph1->IsDispOK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairBoth,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph2->IsDispOK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(table,kPairBoth,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore2,1.) ;
       }
       if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(table,kPairBoth2,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore1,1.) ;
       }
       if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
-      }
-
-
-      if(a<kAlphaCut){
-        FillHistogram(Form("hPi0All_a07_cen%d",fCentBin),m,pt) ;
-      }
-
-      if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	snprintf(key,55,"hMassPtCPV_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
-
-	FillHistogram(Form("hMassPtV0ACPVcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPVcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPVcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-
-	FillHistogram(Form("hPi0CPV_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV_a07_cen%d",fCentBin),m,pt) ;
-        }
-      }
-      if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	FillHistogram(Form("hMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	FillHistogram(Form("hMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-	
-	FillHistogram(Form("hPi0CPV2_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
-        }
-      }
-      if(ph1->IsDispOK() && ph2->IsDispOK()){
-	snprintf(key,55,"hMassPtDisp_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
-	
-	FillHistogram(Form("hMassPtV0ADispcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDispcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
-	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDispcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
-
-	FillHistogram(Form("hPi0Disp_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0Dispcore_cen%d",fCentBin),mcore, ptcore) ;
-	
-	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hPi0Dispwou_cen%d",fCentBin),m,pt) ;
-
-	  FillHistogram(Form("hMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
- 	  FillHistogram(Form("hMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
-	  if(fHaveTPCRP)
-  	    FillHistogram(Form("hMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
-	}
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0Disp_a07_cen%d",fCentBin),m,pt) ;
-        }
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
-
-	  FillHistogram(Form("hMassPtV0ABothcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBothcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBothcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-
-	  FillHistogram(Form("hPi0Both_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Bothcore_cen%d",fCentBin),mcore,ptcore) ;
-
-          if(a<kAlphaCut){
-            snprintf(key,55,"hPi0Both_a07_cen%d",fCentBin) ;
-            FillHistogram(Form("hPi0Both_a07_cen%d",fCentBin),m,pt) ;
-          }
-          if(ph1->Module()==1 && ph2->Module()==1)
-	    FillHistogram("hPi0M11",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==2)
-	    FillHistogram("hPi0M22",m,pt );
-          else if(ph1->Module()==3 && ph2->Module()==3)
-	    FillHistogram("hPi0M33",m,pt );
-          else if(ph1->Module()==4 && ph2->Module()==4)
-	    FillHistogram("hPi0M44",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==2)
-	    FillHistogram("hPi0M12",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==3)
-	    FillHistogram("hPi0M13",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==4)
-	    FillHistogram("hPi0M14",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==3)
-	    FillHistogram("hPi0M23",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==4)
-	    FillHistogram("hPi0M24",m,pt );
-          else if(ph1->Module()==3 && ph2->Module()==4)
-	    FillHistogram("hPi0M34",m,pt );
-        }
-	
+        FillPairHistogram(table,kPairBoth2,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore2,1.) ;
       }
-      
-      
-      if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	FillHistogram(Form("hPi0Disp2_cen%d",fCentBin),m,pt) ;
-  	FillHistogram(Form("hPi0Disp2core_cen%d",fCentBin),mcore, ptcore) ;	
-
-	FillHistogram(Form("hMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
 
-	FillHistogram(Form("hMassPtV0ADisp2core_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2core_cen%d",fCentBin),mcore, ptcore,dphiC) ;
-	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDisp2core_cen%d",fCentBin),mcore, ptcore,dphiT) ;
-	  
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
-
-	  FillHistogram(Form("hMassPtV0ABoth2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-
-	  FillHistogram(Form("hPi0Both2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Both2core_cen%d",fCentBin),mcore,ptcore) ;
-	}
-
-      }
+      if(pidMask & (1<<kPairBoth))
+        FillPi0ModuleHistogram(ph1->Module(),ph2->Module(),m,pt,1.) ;
     } // end of loop i2
   } // end of loop i1
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0sMix()
 {
-  char key[55];
+  TH1 * const * table = GetPairHistTable(kTRUE) ;
 
-  TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t pool = GetMixingPool(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t nMixed = fMixedPhotons->GetNEvents(pool);
 
   for (Int_t i1=0; i1<fCaloPhotonsPHOS->GetEntriesFast(); i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
-    for(Int_t evi=0; evi<arrayList->GetEntries();evi++){
-      TObjArray * mixPHOS = static_cast<TObjArray*>(arrayList->At(evi));
-      for(Int_t i2=0; i2<mixPHOS->GetEntriesFast();i2++){
-	AliCaloPhoton * ph2=(AliCaloPhoton*)mixPHOS->At(i2) ;
-	TLorentzVector p12  = *ph1  + *ph2;
-	TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-
-	Double_t dphiA=p12.Phi()-fRPV0A ;
-	while(dphiA<0)dphiA+=TMath::Pi() ;
-	while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
-
-	Double_t dphiC=p12.Phi()-fRPV0C ;
-	while(dphiC<0)dphiC+=TMath::Pi() ;
-	while(dphiC>TMath::Pi())dphiC-=TMath::Pi() ;
-
-	Double_t dphiT=p12.Phi()-fRP ;
-	while(dphiT<0)dphiT+=TMath::Pi() ;
-	while(dphiT>TMath::Pi())dphiT-=TMath::Pi() ;
-
-
-        Double_t a=TMath::Abs((ph1->E()-ph2->E())/(ph1->E()+ph2->E())) ;
-        Double_t m=p12.M() ;
-        Double_t mcore=pv12.M() ;
-        Double_t pt=p12.Pt() ;
-        Double_t ptcore=pv12.Pt() ;
-        Double_t pt1=ph1->Pt() ;
-        Double_t pt2=ph2->Pt() ;
-        Double_t ptcore1=ph1->GetMomV2()->Pt() ;
-        Double_t ptcore2=ph2->GetMomV2()->Pt() ;
-
-	snprintf(key,55,"hMiMassPtAll_cen%d",fCentBin) ; // probably not needed, consider removing this line!
+    const UInt_t bits1 = AliPi0FlowPhotonStore::GetPhotonBits(ph1) ;
+    const Double_t pt1=ph1->Pt() ;
+    const Double_t ptcore1=ph1->GetMomV2()->Pt() ;
+    for(Int_t evi=0; evi<nMixed;evi++){
+      const Int_t event = fMixedPhotons->GetEvent(pool, evi) ;
+      const Int_t nPairs = fMixedPhotons->ComputePairs(event, ph1, fRPV0A, fRPV0C, fRP) ;
+      const UChar_t * bits = fMixedPhotons->GetBits(event) ;
+      const Double_t * pt2s = fMixedPhotons->GetPt(event) ;
+      const Double_t * ptcore2s = fMixedPhotons->GetPtCore(event) ;
+      const Double_t * ms = fMixedPhotons->GetPairM() ;
+      const Double_t * pts = fMixedPhotons->GetPairPt() ;
+      const Double_t * mcores = fMixedPhotons->GetPairMCore() ;
+      const Double_t * ptcores = fMixedPhotons->GetPairPtCore() ;
+      const Double_t * as = fMixedPhotons->GetPairAsym() ;
+      const Double_t * dphiAs = fMixedPhotons->GetPairDPhiV0A() ;
+      const Double_t * dphiCs = fMixedPhotons->GetPairDPhiV0C() ;
+      const Double_t * dphiTs = fMixedPhotons->GetPairDPhiTPC() ;
+      for(Int_t i2=0; i2<nPairs;i2++){
+        const UInt_t bits2 = bits[i2] ;
+        Double_t dphiA=dphiAs[i2] ;
+        Double_t dphiC=dphiCs[i2] ;
+        Double_t dphiT=dphiTs[i2] ;
+
+        Double_t a=as[i2] ;
+        Double_t m=ms[i2] ;
+        Double_t mcore=mcores[i2] ;
+        Double_t pt=pts[i2] ;
+        Double_t ptcore=ptcores[i2] ;
+        Double_t pt2=pt2s[i2] ;
+        Double_t ptcore2=ptcore2s[i2] ;
+
 	if( fFillWideTOF ) {
-	  FillHistogram(Form("hMiPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	  FillPairHistogram(table,kPairWideTOF,kHPi0,m,pt,1.) ;
+	  FillPairHistogram(table,kPairWideTOF,kHSingle,m,pt1,1.) ;
+	  FillPairHistogram(table,kPairWideTOF,kHSingle,m,pt2,1.) ;
 	  if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(table,kPairWideTOF,kHMassPtTPC,m,pt,dphiT,1.) ;
 	}
 
-	if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
+	if( fTOFCutEnabled && !(bits1 & bits2 & AliPi0FlowPhotonStore::kTOFBit) )
 	  continue;
 
-	FillHistogram(Form("hMiMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
-	if(fHaveTPCRP)
- 	  FillHistogram(Form("hMiMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
+        const Bool_t ph2ntUnfolded = bits2 & AliPi0FlowPhotonStore::kntUnfoldedBit ;
+        const Bool_t ph2CPV   = bits2 & AliPi0FlowPhotonStore::kCPVBit ;
+        const Bool_t ph2CPV2  = bits2 & AliPi0FlowPhotonStore::kCPV2Bit ;
+        const Bool_t ph2Disp  = bits2 & AliPi0FlowPhotonStore::kDispBit ;
+        const Bool_t ph2Disp2 = bits2 & AliPi0FlowPhotonStore::kDisp2Bit ;
 
-	FillHistogram(Form("hMiMassPtV0AAllcore_cen%d",fCentBin),mcore, ptcore, dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAllcore_cen%d",fCentBin),mcore, ptcore, dphiC) ;
-        if(fHaveTPCRP)
-	  FillHistogram(Form("hMiMassPtTPCAllcore_cen%d",fCentBin),mcore, ptcore, dphiT) ;
-
-	FillHistogram(Form("hMiPi0All_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hMiPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
-	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hMiPi0Allwou_cen%d",fCentBin),m,pt) ;
-          FillHistogram(Form("hMiMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-          FillHistogram(Form("hMiMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
-          if(fHaveTPCRP)
-            FillHistogram(Form("hMiMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
-	}
+	FillPairHistograms(table,GetPairPIDMask(bits1,bits2),ph1->IsntUnfolded() && ph2ntUnfolded,a<kAlphaCut,
+	                   m,pt,mcore,ptcore,dphiA,dphiC,dphiT,1.) ;
 
-	FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+	FillPairHistogram(table,kPairAll,kHSingle,m,pt1,1.) ;
+        FillPairHistogram(table,kPairAll,kHSingle,m,pt2,1.) ;
+        FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore1,1.) ;
+        FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore2,1.) ;
         if(ph1->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt1) ;
-        if(ph2->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt2) ;
+          FillPairHistogram(table,kPairAll,kHSinglewou,m,pt1,1.) ;
+        if(ph2ntUnfolded)
+          FillPairHistogram(table,kPairAll,kHSinglewou,m,pt2,1.) ;
         if(ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(table,kPairCPV,kHSingle,m,pt1,1.) ;
+          FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore1,1.) ;
         }
-        if(ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+        if(ph2CPV){
+          FillPairHistogram(table,kPairCPV,kHSingle,m,pt2,1.) ;
+          FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore2,1.) ;
         }
         if(ph1->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(table,kPairCPV2,kHSingle,m,pt1,1.) ;
+          FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore1,1.) ;
         }
-        if(ph2->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        if(ph2CPV2){
+          FillPairHistogram(table,kPairCPV2,kHSingle,m,pt2,1.) ;
+          FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2,1.) ;
         }
         if(ph1->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt1) ;
+          FillPairHistogram(table,kPairDisp,kHSingle,m,pt1,1.) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt1) ;
+            FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt1,1.) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore1,1.) ;
         }
-        if(ph2->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt2) ;
+        if(ph2Disp){
+          FillPairHistogram(table,kPairDisp,kHSingle,m,pt2,1.) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt2) ;
+            FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt2,1.) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore2,1.) ;
         }
         if(ph1->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(table,kPairDisp2,kHSingle,m,pt1,1.) ;
+          FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1,1.) ;
         }
-        if(ph2->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore2) ;
+        if(ph2Disp2){
+          FillPairHistogram(table,kPairDisp2,kHSingle,m,pt2,1.) ;
+          FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore2,1.) ;
         }
         if(ph1->IsDispOK() && ph1->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt1) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore1) ;
+          FillPairHistogram(table,kPairBoth,kHSingle,m,pt1,1.) ;
+          FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore1,1.) ;
         }
-        if(ph2->IsDispOK() && ph2->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt2) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore2) ;
+        if(ph2Disp && ph2CPV){
+          FillPairHistogram(table,kPairBoth,kHSingle,m,pt2,1.) ;
+          FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore2,1.) ;
         }
         if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
-        }
-        if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(table,kPairBoth2,kHSingle,m,pt1,1.) ;
+          FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore1,1.) ;
         }
-
-
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hMiPi0All_a07_cen%d",fCentBin),m,pt) ;
+        if(ph2Disp2 && ph2CPV){
+          FillPairHistogram(table,kPairBoth2,kHSingle,m,pt2,1.) ;
+          FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore2,1.) ;
         }
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMiMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
-
-	  FillHistogram(Form("hMiMassPtV0ACPVcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPVcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPVcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
-
-	  FillHistogram(Form("hMiPi0CPV_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV_a07_cen%d",fCentBin),m,pt) ;
-          }
-	}
-	if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	  FillHistogram(Form("hMiPi0CPV2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
-
-	  FillHistogram(Form("hMiMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	  FillHistogram(Form("hMiMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
-          }
-	}
-	if(ph1->IsDispOK() && ph2->IsDispOK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
-
-	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
-
-
-	  FillHistogram(Form("hMiPi0Disp_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
-          if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	    FillHistogram(Form("hMiPi0Dispwou_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
-            if(fHaveTPCRP)
-	      FillHistogram(Form("hMiMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
-	  }
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0Disp_a07_cen%d",fCentBin),m,pt) ;
-          }
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
-
-	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
-
-	    FillHistogram(Form("hMiPi0Both_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
-
-	    if(a<kAlphaCut){
-              FillHistogram(Form("hMiPi0Both_a07_cen%d",fCentBin),m,pt) ;
-            }
-	  }
-	}
-	
-  	if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
-
-	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
-
-
-	  FillHistogram(Form("hMiPi0Disp2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
-
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
-
-	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
-
-	    FillHistogram(Form("hMiPi0Both2_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
-
-	  }
-	}
       } // end of loop i2
     }
   } // end of loop i1
@@ -1436,20 +1163,11 @@ void AliAnalysisTaskPi0Flow::UpdateLists()
   //Now we either add current events to stack or remove
   //If no photons in current event - no need to add it to mixed
 
-  TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
   if( fDebug >= 2 )
     AliInfo( Form("fCentBin=%d, fCentNMixed[]=%d",fCentBin,fCentNMixed[fCentBin]) );
-  if(fCaloPhotonsPHOS->GetEntriesFast()>0){
-    arrayList->AddFirst(fCaloPhotonsPHOS) ;
-    fCaloPhotonsPHOS=0;
-    if(arrayList->GetEntries() > fCentNMixed[fCentBin]){ // Remove redundant events
-      TObjArray * tmp = static_cast<TObjArray*>(arrayList->Last()) ;
-      arrayList->RemoveLast() ;
-      delete tmp ; // TODO: may conflict with delete done by list being owner.
-    }
-  }
-  else
-    fCaloPhotonsPHOS->Clear(); // TODO: redundant???
+  if(fCaloPhotonsPHOS->GetEntriesFast()>0) // the oldest event is replaced once the pool holds fCentNMixed events
+    fMixedPhotons->AddEvent(GetMixingPool(fVtxBin, fCentBin, fEMRPBin), fCentNMixed[fCentBin], fCaloPhotonsPHOS) ;
+  fCaloPhotonsPHOS->Clear(); // photons are copied to the pool
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::FillHistogram(const char * key,Double_t x)const{
@@ -1504,6 +1222,143 @@ void AliAnalysisTaskPi0Flow::FillHistogram(const char * key,Double_t x,Double_t
 }
 
 
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::BuildPairHistTables()
+{
+  //Look up the histograms filled in the pair loops, once.
+  //An entry stays 0x0 if the pair loops never fill this PID combination
+  //and family, e.g. there are no "wou" spectra for CPV.
+
+  const Int_t nCent = fCentEdges.GetSize()-1 ;
+  const char * pidNames[kNPairPID] = {"All", "CPV", "CPV2", "Disp", "Disp2", "Both", "Both2", "WideTOF"};
+  const char * histNames[kNPairHist] = {"Pi0%s", "Pi0%score", "Pi0%swou", "Pi0%s_a07",
+                                        "MassPtV0A%s", "MassPtV0C%s", "MassPtTPC%s", "MassPtV0A%score", "MassPtV0C%score", "MassPtTPC%score",
+                                        "MassPtV0A%swou", "MassPtV0C%swou", "MassPtTPC%swou",
+                                        "Single%s", "Single%score", "Single%swou"};
+  const UInt_t kWouPIDs = (1<<kPairAll) | (1<<kPairDisp) ;
+  const UInt_t kA07PIDs = (1<<kPairAll) | (1<<kPairCPV) | (1<<kPairCPV2) | (1<<kPairDisp) | (1<<kPairBoth) ;
+
+  fPairHists.assign(2*nCent*kNPairPID*kNPairHist, 0x0) ;
+  for(Int_t mixed=0; mixed<2; mixed++){
+    for(Int_t cent=0; cent<nCent; cent++){
+      for(Int_t ipid=0; ipid<kNPairPID; ipid++){
+        for(Int_t ih=0; ih<kNPairHist; ih++){
+          Bool_t isWou = (ih==kHPi0wou || ih==kHMassPtV0Awou || ih==kHMassPtV0Cwou || ih==kHMassPtTPCwou || ih==kHSinglewou) ;
+          if(isWou && !(kWouPIDs & (1<<ipid)))
+            continue ;
+          if(ih==kHPi0a07 && !(kA07PIDs & (1<<ipid)))
+            continue ;
+          if(ipid==kPairWideTOF && (!fFillWideTOF || (ih!=kHPi0 && ih!=kHSingle && ih!=kHMassPtTPC)))
+            continue ;
+
+          TString name = TString::Format(histNames[ih], pidNames[ipid]) ;
+          name.Prepend(mixed ? "hMi" : "h") ;
+          name += TString::Format("_cen%d", cent) ;
+          TH1 * hist = dynamic_cast<TH1*>(fOutputContainer->FindObject(name)) ;
+          Bool_t is3D = (ih>=kHMassPtV0A && ih<=kHMassPtTPCwou) ;
+          if(!hist || !hist->InheritsFrom(is3D ? TH3::Class() : TH2::Class())){
+            AliError(Form("can not find histogram (of instance %s) <%s> ", is3D ? "TH3" : "TH2", name.Data())) ;
+            continue ;
+          }
+          fPairHists[((mixed*nCent + cent)*kNPairPID + ipid)*kNPairHist + ih] = hist ;
+        }
+      }
+    }
+  }
+
+  fHistPHOSphi = dynamic_cast<TH3*>(fOutputContainer->FindObject("hPHOSphi")) ;
+  for(Int_t i=0; i<kNMod; i++)
+    for(Int_t j=0; j<kNMod; j++)
+      fHistPi0Mod[i][j] = dynamic_cast<TH2*>(fOutputContainer->FindObject(Form("hPi0M%d%d",i+1,j+1))) ;
+}
+//_____________________________________________________________________________
+UInt_t AliAnalysisTaskPi0Flow::GetPairPIDMask(const AliCaloPhoton * ph1, const AliCaloPhoton * ph2)
+{
+  //PID combinations passed by both photons of the pair
+  return GetPairPIDMask(AliPi0FlowPhotonStore::GetPhotonBits(ph1), AliPi0FlowPhotonStore::GetPhotonBits(ph2)) ;
+}
+//_____________________________________________________________________________
+UInt_t AliAnalysisTaskPi0Flow::GetPairPIDMask(UInt_t bits1, UInt_t bits2)
+{
+  //PID combinations passed by both photons of the pair, from their AliPi0FlowPhotonStore::PhotonBit
+  const UInt_t both = bits1 & bits2 ;
+  UInt_t mask = 1<<kPairAll ;
+  const Bool_t cpv = both & AliPi0FlowPhotonStore::kCPVBit ;
+  if(cpv)
+    mask |= 1<<kPairCPV ;
+  if(both & AliPi0FlowPhotonStore::kCPV2Bit)
+    mask |= 1<<kPairCPV2 ;
+  if(both & AliPi0FlowPhotonStore::kDispBit){
+    mask |= 1<<kPairDisp ;
+    if(cpv)
+      mask |= 1<<kPairBoth ;
+  }
+  if(both & AliPi0FlowPhotonStore::kDisp2Bit){
+    mask |= 1<<kPairDisp2 ;
+    if(cpv)
+      mask |= 1<<kPairBoth2 ;
+  }
+  return mask ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPairHistograms(TH1 * const * table, UInt_t pidMask, Bool_t wou, Bool_t a07, Double_t m, Double_t pt, Double_t mcore, Double_t ptcore,
+                                                Double_t dphiA, Double_t dphiC, Double_t dphiT, Double_t w) const
+{
+  //Invariant mass spectra of a pair for all PID combinations in pidMask.
+  //"wou" and "a07" spectra exist only for some combinations, the
+  //others have no entry in the table.
+  for(Int_t ipid=0; ipid<kPairWideTOF; ipid++){
+    if(!(pidMask & (1<<ipid)))
+      continue ;
+    FillPairHistogram(table,ipid,kHMassPtV0A,m,pt,dphiA,w) ;
+    FillPairHistogram(table,ipid,kHMassPtV0C,m,pt,dphiC,w) ;
+    if(fHaveTPCRP)
+      FillPairHistogram(table,ipid,kHMassPtTPC,m,pt,dphiT,w) ;
+
+    FillPairHistogram(table,ipid,kHMassPtV0Acore,mcore,ptcore,dphiA,w) ;
+    FillPairHistogram(table,ipid,kHMassPtV0Ccore,mcore,ptcore,dphiC,w) ;
+    if(fHaveTPCRP)
+      FillPairHistogram(table,ipid,kHMassPtTPCcore,mcore,ptcore,dphiT,w) ;
+
+    FillPairHistogram(table,ipid,kHPi0,m,pt,w) ;
+    FillPairHistogram(table,ipid,kHPi0core,mcore,ptcore,w) ;
+    if(wou){
+      FillPairHistogram(table,ipid,kHPi0wou,m,pt,w) ;
+      FillPairHistogram(table,ipid,kHMassPtV0Awou,m,pt,dphiA,w) ;
+      FillPairHistogram(table,ipid,kHMassPtV0Cwou,m,pt,dphiC,w) ;
+      if(fHaveTPCRP)
+        FillPairHistogram(table,ipid,kHMassPtTPCwou,m,pt,dphiT,w) ;
+    }
+    if(a07)
+      FillPairHistogram(table,ipid,kHPi0a07,m,pt,w) ;
+  }
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPairHistogram(TH1 * const * table, Int_t pid, Int_t hist, Double_t x, Double_t y, Double_t w) const
+{
+  TH1 * h = table[pid*kNPairHist + hist] ;
+  if(h)
+    static_cast<TH2*>(h)->Fill(x, y, w) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPairHistogram(TH1 * const * table, Int_t pid, Int_t hist, Double_t x, Double_t y, Double_t z, Double_t w) const
+{
+  TH1 * h = table[pid*kNPairHist + hist] ;
+  if(h)
+    static_cast<TH3*>(h)->Fill(x, y, z, w) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPi0ModuleHistogram(Int_t mod1, Int_t mod2, Double_t m, Double_t pt, Double_t w) const
+{
+  //Pairs in modules mod1, mod2, only booked for mod1<=mod2
+  if(mod1<1 || mod1>kNMod || mod2<1 || mod2>kNMod)
+    return ;
+  TH1 * h = fHistPi0Mod[mod1-1][mod2-1] ;
+  if(h)
+    static_cast<TH2*>(h)->Fill(m, pt, w) ;
+}
+
+
 //_____________________________________________________________________________
 AliVEvent* AliAnalysisTaskPi0Flow::GetEvent()
 {
@@ -2137,26 +1992,6 @@ Bool_t AliAnalysisTaskPi0Flow::TestLambda2(Double_t pt,Double_t l1,Double_t l2){
   return (R2<1.5*1.5) ;
 
 }
-//____________________________________________________________________________
-TList* AliAnalysisTaskPi0Flow::GetCaloPhotonsPHOSList(UInt_t vtxBin, UInt_t centBin, UInt_t rpBin)
-{
-  int offset = vtxBin * GetNumberOfCentralityBins() * fNEMRPBins
-	      + centBin * fNEMRPBins
-	      + rpBin;
-  if( fCaloPhotonsPHOSLists->At(offset) ) { // list exists
-    TList* list = dynamic_cast<TList*> (fCaloPhotonsPHOSLists->At(offset));
-    if( ! list )
-      AliError("object in fCaloPhotonsPHOSLists at %i did not cast");
-    return list;
-  }
-  else {// no list for this bin has been created, yet
-    TList* list = new TList();
-    list->SetOwner();
-    fCaloPhotonsPHOSLists->AddAt(list, offset);
-    return list;
-  }
-}
-
 //____________________________________________________________________________
 Double_t AliAnalysisTaskPi0Flow::TestCPV(Double_t dx, Double_t dz, Double_t pt, Int_t charge){
   //Parameterization of LHC10h period
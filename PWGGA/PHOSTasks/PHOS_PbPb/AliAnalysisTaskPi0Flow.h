@@ -25,7 +25,11 @@ class AliESDtrack ;
 class AliESDCaloCluster ;
 class AliEPFlattener;
 class AliAnalysisUtils;
+class AliCaloPhoton;
+class AliPi0FlowPhotonStore;
+class TH1;
 
+#include <vector>
 #include "TArrayD.h"
 
 #include "AliAnalysisTaskSE.h"
@@ -35,6 +39,11 @@ public:
     enum Period { kUndefinedPeriod, kLHC10h, kLHC11h, kLHC13 };
     enum EventSelection { kTotal, kInternalTriggerMaskSelection, kHasVertex, kHasAbsVertex, kHasCentrality, kCentUnderUpperBinUpperEdge, kCentOverLowerBinLowerEdge, kHasPHOSClusters, kTotalSelected };
     enum TriggerSelection { kNoSelection, kCentralInclusive, kCentralExclusive, kSemiCentralInclusive, kSemiCentralExclusive, kMBInclusive, kMBExclusive };
+    // PID combinations and histogram families of the pair loops, see BuildPairHistTables()
+    enum PairPID { kPairAll, kPairCPV, kPairCPV2, kPairDisp, kPairDisp2, kPairBoth, kPairBoth2, kPairWideTOF, kNPairPID };
+    enum PairHist { kHPi0, kHPi0core, kHPi0wou, kHPi0a07,
+                    kHMassPtV0A, kHMassPtV0C, kHMassPtTPC, kHMassPtV0Acore, kHMassPtV0Ccore, kHMassPtTPCcore, kHMassPtV0Awou, kHMassPtV0Cwou, kHMassPtTPCwou,
+                    kHSingle, kHSinglecore, kHSinglewou, kNPairHist };
 
 public:
     AliAnalysisTaskPi0Flow(const char *name = "AliAnalysisTaskPi0Flow", Period period = kUndefinedPeriod);
@@ -129,6 +138,17 @@ protected:
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram witn name key
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram witn name key
 
+    // Pair loops: histograms are looked up once, not by name for each pair
+    void BuildPairHistTables() ; //Fill fPairHists, fHistPHOSphi and fHistPi0Mod from fOutputContainer
+    TH1 * const * GetPairHistTable(Bool_t mixed) const { return &fPairHists[((mixed ? 1 : 0)*(fCentEdges.GetSize()-1) + fCentBin)*kNPairPID*kNPairHist]; }
+    static UInt_t GetPairPIDMask(const AliCaloPhoton * ph1, const AliCaloPhoton * ph2) ; //Bit kPair* set if both photons pass
+    static UInt_t GetPairPIDMask(UInt_t bits1, UInt_t bits2) ; //Same from AliPi0FlowPhotonStore::PhotonBit of both photons
+    void FillPairHistograms(TH1 * const * table, UInt_t pidMask, Bool_t wou, Bool_t a07, Double_t m, Double_t pt, Double_t mcore, Double_t ptcore,
+                            Double_t dphiA, Double_t dphiC, Double_t dphiT, Double_t w) const ; //Pair spectra of all PID combinations in pidMask
+    void FillPairHistogram(TH1 * const * table, Int_t pid, Int_t hist, Double_t x, Double_t y, Double_t w) const ; //Fill 2D histogram of the table
+    void FillPairHistogram(TH1 * const * table, Int_t pid, Int_t hist, Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram of the table
+    void FillPi0ModuleHistogram(Int_t mod1, Int_t mod2, Double_t m, Double_t pt, Double_t w) const ; //hPi0M<mod1><mod2>
+
     TVector3 GetVertexVector(const AliVVertex* vertex);
     Int_t GetCentralityBin(Float_t centralityV0M);
     Int_t GetRPBin();
@@ -145,7 +165,7 @@ protected:
     Bool_t TestLambda2(Double_t pt,Double_t l1,Double_t l2) ;  //Evaluate Dispersion cuts for photons
     
     UInt_t GetNumberOfCentralityBins() { return fCentEdges.GetSize()-1; }
-    TList* GetCaloPhotonsPHOSList(UInt_t vtxBin, UInt_t centBin, UInt_t rpBin);
+    Int_t GetMixingPool(UInt_t vtxBin, UInt_t centBin, UInt_t rpBin) { return (vtxBin * GetNumberOfCentralityBins() + centBin) * fNEMRPBins + rpBin; } //pool of fMixedPhotons
     
     AliAnalysisUtils* GetAnalysisUtils();
 
@@ -238,10 +258,15 @@ protected:
     TObjArray * fCaloPhotonsPHOS ;      //PHOS photons in current event
 
     // Step 12: Update lists for mixing.
-    TObjArray* fCaloPhotonsPHOSLists; //! array of TList, Containers for events with PHOS photons
+    AliPi0FlowPhotonStore * fMixedPhotons; //! photons of previous events, one pool per vertex, centrality and RP bin
+
+    // Steps 9 and 10: histograms of the pair loops
+    std::vector<TH1*> fPairHists;   //! [real/mixed][centrality bin][PairPID][PairHist], 0x0 if not filled
+    TH1 * fHistPHOSphi;             //! hPHOSphi
+    TH1 * fHistPi0Mod[kNMod][kNMod]; //! hPi0M<i><j>, 0x0 if not booked
 
 
-    ClassDef(AliAnalysisTaskPi0Flow, 3); // PHOS analysis task
+    ClassDef(AliAnalysisTaskPi0Flow, 5); // PHOS analysis task
 };
 
 #endif
@@ -45,6 +45,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliPHOSHijingEfficiency.h"
 #include "AliCaloPhoton.h"
+#include "AliPi0FlowPhotonStore.h"
 #include "AliPHOSGeometry.h"
 #include "AliPHOSEsdCluster.h"
 #include "AliPHOSCalibData.h"
@@ -416,7 +417,7 @@ void AliAnalysisTaskPi0FlowMC::FillSelectedClusterHistograms()
 
 void AliAnalysisTaskPi0FlowMC::ConsiderPi0s()
 {
-  char key[55];
+  TH1 * const * table = GetPairHistTable(kFALSE) ;
   for (Int_t i1=0; i1 < fCaloPhotonsPHOS->GetEntriesFast()-1; i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     const Double_t w1 = ph1->GetWeight();
@@ -428,7 +429,8 @@ void AliAnalysisTaskPi0FlowMC::ConsiderPi0s()
       const Double_t w2 = ph2->GetWeight();
       Double_t w = TMath::Sqrt(w1*w2);
       
-      FillHistogram("hPHOSphi",fCentrality,p12.Pt(),p12.Phi(), w) ;
+      if(fHistPHOSphi)
+        static_cast<TH3*>(fHistPHOSphi)->Fill(fCentrality,p12.Pt(),p12.Phi(), w) ;
       Double_t dphiA=p12.Phi()-fRPV0A ;
       while(dphiA<0)dphiA+=TMath::Pi() ;
       while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
@@ -451,223 +453,76 @@ void AliAnalysisTaskPi0FlowMC::ConsiderPi0s()
       Double_t ptcore1=ph1->GetMomV2()->Pt() ;
       Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
-      FillHistogram(Form("hMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA, w) ;
-      FillHistogram(Form("hMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC, w) ;
-      if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-      FillHistogram(Form("hMassPtV0AAllcore_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-      FillHistogram(Form("hMassPtV0CAllcore_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-      if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAllcore_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-
+      const UInt_t pidMask = GetPairPIDMask(ph1,ph2) ;
+      FillPairHistograms(table,pidMask,ph1->IsntUnfolded() && ph2->IsntUnfolded(),a<kAlphaCut,
+                         m,pt,mcore,ptcore,dphiA,dphiC,dphiT,w) ;
 
-      FillHistogram(Form("hPi0All_cen%d",fCentBin),m,pt, w) ;
-      FillHistogram(Form("hPi0Allcore_cen%d",fCentBin),mcore,ptcore, w) ;
-      if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-        FillHistogram(Form("hPi0Allwou_cen%d",fCentBin),m,pt, w) ;
-        FillHistogram(Form("hMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA, w) ;
-        FillHistogram(Form("hMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC, w) ;
-        if(fHaveTPCRP)
-          FillHistogram(Form("hMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT, w) ;
-      }
-
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt1, w) ;
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt2, w) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore1, w) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+      FillPairHistogram(table,kPairAll,kHSingle,m,pt1, w) ;
+      FillPairHistogram(table,kPairAll,kHSingle,m,pt2, w) ;
+      FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore1, w) ;
+      FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore2, w) ;
       if(ph1->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt1, w) ;
+        FillPairHistogram(table,kPairAll,kHSinglewou,m,pt1, w) ;
       if(ph2->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt2, w) ;
+        FillPairHistogram(table,kPairAll,kHSinglewou,m,pt2, w) ;
       if(ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairCPV,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+        FillPairHistogram(table,kPairCPV,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore2, w) ;
       }
       if(ph1->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2, w) ;
+        FillPairHistogram(table,kPairCPV2,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2, w) ;
       }
       if(ph2->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2, w) ;
+        FillPairHistogram(table,kPairCPV2,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2, w) ;
       }
       if(ph1->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt1, w) ;
+        FillPairHistogram(table,kPairDisp,kHSingle,m,pt1, w) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt1, w) ;
-	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore1, w) ;
+          FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt1, w) ;
+        }
+        FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph2->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt2, w) ;
+        FillPairHistogram(table,kPairDisp,kHSingle,m,pt2, w) ;
         if(ph2->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt2, w) ;
-	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+          FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt2, w) ;
+        }
+        FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore2, w) ;
       }
       if(ph1->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairDisp2,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph2->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairDisp2,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph1->IsDispOK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairBoth,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph2->IsDispOK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+        FillPairHistogram(table,kPairBoth,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore2, w) ;
       }
       if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairBoth2,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore1, w) ;
       }
       if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore2, w) ;
-      }
-
-
-      if(a<kAlphaCut){
-        FillHistogram(Form("hPi0All_a07_cen%d",fCentBin),m,pt, w) ;
-      }
-
-      if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	snprintf(key,55,"hMassPtCPV_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	FillHistogram(Form("hMassPtV0ACPVcore_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CCPVcore_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPVcore_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-
-	FillHistogram(Form("hPi0CPV_cen%d",fCentBin),m,pt, w) ;
-	FillHistogram(Form("hPi0CPVcore_cen%d",fCentBin),mcore, ptcore, w) ;
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV_a07_cen%d",fCentBin),m,pt, w) ;
-        }
-      }
-      if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	FillHistogram(Form("hMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT, w) ;
-	FillHistogram(Form("hMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-	
-	FillHistogram(Form("hPi0CPV2_cen%d",fCentBin),m,pt, w) ;
-	FillHistogram(Form("hPi0CPV2core_cen%d",fCentBin),mcore, ptcore, w) ;
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV2_a07_cen%d",fCentBin),m,pt, w) ;
-        }
-      }
-      if(ph1->IsDispOK() && ph2->IsDispOK()){
-	snprintf(key,55,"hMassPtDisp_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT, w) ;
-	
-	FillHistogram(Form("hMassPtV0ADispcore_cen%d",fCentBin),mcore, ptcore,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CDispcore_cen%d",fCentBin),mcore, ptcore,dphiC, w) ;
-	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDispcore_cen%d",fCentBin),mcore, ptcore,dphiT, w) ;
-
-	FillHistogram(Form("hPi0Disp_cen%d",fCentBin),m,pt, w) ;
-	FillHistogram(Form("hPi0Dispcore_cen%d",fCentBin),mcore, ptcore, w) ;
-	
-	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hPi0Dispwou_cen%d",fCentBin),m,pt, w) ;
-
-	  FillHistogram(Form("hMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA, w) ;
- 	  FillHistogram(Form("hMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC, w) ;
-	  if(fHaveTPCRP)
-  	    FillHistogram(Form("hMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT, w) ;
-	}
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hPi0Disp_a07_cen%d",fCentBin),m,pt, w) ;
-        }
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	  FillHistogram(Form("hMassPtV0ABothcore_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-	  FillHistogram(Form("hMassPtV0CBothcore_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBothcore_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-
-	  FillHistogram(Form("hPi0Both_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hPi0Bothcore_cen%d",fCentBin),mcore,ptcore, w) ;
-
-          if(a<kAlphaCut){
-            snprintf(key,55,"hPi0Both_a07_cen%d",fCentBin) ;
-            FillHistogram(Form("hPi0Both_a07_cen%d",fCentBin),m,pt, w) ;
-          }
-          if(ph1->Module()==1 && ph2->Module()==1)
-	    FillHistogram("hPi0M11", m, pt, w) ;
-          else if(ph1->Module()==2 && ph2->Module()==2)
-	    FillHistogram("hPi0M22", m, pt, w) ;
-          else if(ph1->Module()==3 && ph2->Module()==3)
-	    FillHistogram("hPi0M33", m, pt, w) ;
-          else if(ph1->Module()==1 && ph2->Module()==2)
-	    FillHistogram("hPi0M12", m, pt, w) ;
-          else if(ph1->Module()==1 && ph2->Module()==3)
-	    FillHistogram("hPi0M13", m, pt, w) ;
-          else if(ph1->Module()==2 && ph2->Module()==3)
-	    FillHistogram("hPi0M23", m, pt, w) ;
-
-        }
-	
+        FillPairHistogram(table,kPairBoth2,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore2, w) ;
       }
-      
-      
-      if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	FillHistogram(Form("hPi0Disp2_cen%d",fCentBin),m,pt,w) ;
-  	FillHistogram(Form("hPi0Disp2core_cen%d",fCentBin),mcore, ptcore, w) ;	
-
-	FillHistogram(Form("hMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC, w) ;
-	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	FillHistogram(Form("hMassPtV0ADisp2core_cen%d",fCentBin),mcore, ptcore,dphiA, w) ;
-	FillHistogram(Form("hMassPtV0CDisp2core_cen%d",fCentBin),mcore, ptcore,dphiC, w) ;
-	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDisp2core_cen%d",fCentBin),mcore, ptcore,dphiT, w) ;
-	  
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	  FillHistogram(Form("hMassPtV0ABoth2core_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-	  FillHistogram(Form("hMassPtV0CBoth2core_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2core_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-
-	  FillHistogram(Form("hPi0Both2_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hPi0Both2core_cen%d",fCentBin),mcore,ptcore, w) ;
-	}
 
-      }
+      //module pair histograms are booked for all modules, filled for 1-3 only
+      if((pidMask & (1<<kPairBoth)) && ph1->Module()<4 && ph2->Module()<4)
+        FillPi0ModuleHistogram(ph1->Module(),ph2->Module(),m,pt,w) ;
     } // end of loop i2
   } // end of loop i1
 }
@@ -675,257 +530,125 @@ void AliAnalysisTaskPi0FlowMC::ConsiderPi0s()
 //________________________________________________________________________
 void AliAnalysisTaskPi0FlowMC::ConsiderPi0sMix()
 {
-  char key[55];
+  TH1 * const * table = GetPairHistTable(kTRUE) ;
 
-  TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t pool = GetMixingPool(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t nMixed = fMixedPhotons->GetNEvents(pool);
 
   for (Int_t i1=0; i1<fCaloPhotonsPHOS->GetEntriesFast(); i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     const Double_t w1 = ph1->GetWeight();
-    for(Int_t evi=0; evi<arrayList->GetEntries();evi++){
-      TObjArray * mixPHOS = static_cast<TObjArray*>(arrayList->At(evi));
-      for(Int_t i2=0; i2<mixPHOS->GetEntriesFast();i2++){
-	AliCaloPhoton * ph2=(AliCaloPhoton*)mixPHOS->At(i2) ;
-	TLorentzVector p12  = *ph1  + *ph2;
-	TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-	
-	const Double_t w2 = ph2->GetWeight();
-	Double_t w = TMath::Sqrt(w1*w2);
-
-	Double_t dphiA=p12.Phi()-fRPV0A ;
-	while(dphiA<0)dphiA+=TMath::Pi() ;
-	while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
-
-	Double_t dphiC=p12.Phi()-fRPV0C ;
-	while(dphiC<0)dphiC+=TMath::Pi() ;
-	while(dphiC>TMath::Pi())dphiC-=TMath::Pi() ;
-
-	Double_t dphiT=p12.Phi()-fRP ;
-	while(dphiT<0)dphiT+=TMath::Pi() ;
-	while(dphiT>TMath::Pi())dphiT-=TMath::Pi() ;
-
-
-        Double_t a=TMath::Abs((ph1->E()-ph2->E())/(ph1->E()+ph2->E())) ;
-        Double_t m=p12.M() ;
-        Double_t mcore=pv12.M() ;
-        Double_t pt=p12.Pt() ;
-        Double_t ptcore=pv12.Pt() ;
-        Double_t pt1=ph1->Pt() ;
-        Double_t pt2=ph2->Pt() ;
-        Double_t ptcore1=ph1->GetMomV2()->Pt() ;
-        Double_t ptcore2=ph2->GetMomV2()->Pt() ;
-
-
-	snprintf(key,55,"hMiMassPtAll_cen%d",fCentBin) ;
-	FillHistogram(Form("hMiMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA, w) ;
-	FillHistogram(Form("hMiMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC, w) ;
-	if(fHaveTPCRP)
- 	  FillHistogram(Form("hMiMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	FillHistogram(Form("hMiMassPtV0AAllcore_cen%d",fCentBin),mcore, ptcore, dphiA, w) ;
-	FillHistogram(Form("hMiMassPtV0CAllcore_cen%d",fCentBin),mcore, ptcore, dphiC, w) ;
-        if(fHaveTPCRP)
-	  FillHistogram(Form("hMiMassPtTPCAllcore_cen%d",fCentBin),mcore, ptcore, dphiT, w) ;
-
-	FillHistogram(Form("hMiPi0All_cen%d",fCentBin),m,pt, w) ;
-	FillHistogram(Form("hMiPi0Allcore_cen%d",fCentBin),mcore,ptcore, w) ;
-	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hMiPi0Allwou_cen%d",fCentBin),m,pt, w) ;
-          FillHistogram(Form("hMiMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA, w) ;
-          FillHistogram(Form("hMiMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC, w) ;
-          if(fHaveTPCRP)
-            FillHistogram(Form("hMiMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT, w) ;
-	}
-
-        FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt1, w) ;
-        FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt2, w) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore1, w) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+    const UInt_t bits1 = AliPi0FlowPhotonStore::GetPhotonBits(ph1) ;
+    const Double_t pt1=ph1->Pt() ;
+    const Double_t ptcore1=ph1->GetMomV2()->Pt() ;
+    for(Int_t evi=0; evi<nMixed;evi++){
+      const Int_t event = fMixedPhotons->GetEvent(pool, evi) ;
+      const Int_t nPairs = fMixedPhotons->ComputePairs(event, ph1, fRPV0A, fRPV0C, fRP) ;
+      const UChar_t * bits = fMixedPhotons->GetBits(event) ;
+      const Double_t * w2s = fMixedPhotons->GetWeight(event) ;
+      const Double_t * pt2s = fMixedPhotons->GetPt(event) ;
+      const Double_t * ptcore2s = fMixedPhotons->GetPtCore(event) ;
+      const Double_t * ms = fMixedPhotons->GetPairM() ;
+      const Double_t * pts = fMixedPhotons->GetPairPt() ;
+      const Double_t * mcores = fMixedPhotons->GetPairMCore() ;
+      const Double_t * ptcores = fMixedPhotons->GetPairPtCore() ;
+      const Double_t * as = fMixedPhotons->GetPairAsym() ;
+      const Double_t * dphiAs = fMixedPhotons->GetPairDPhiV0A() ;
+      const Double_t * dphiCs = fMixedPhotons->GetPairDPhiV0C() ;
+      const Double_t * dphiTs = fMixedPhotons->GetPairDPhiTPC() ;
+      for(Int_t i2=0; i2<nPairs;i2++){
+        const UInt_t bits2 = bits[i2] ;
+        const Double_t w2 = w2s[i2];
+        Double_t w = TMath::Sqrt(w1*w2);
+
+        Double_t dphiA=dphiAs[i2] ;
+        Double_t dphiC=dphiCs[i2] ;
+        Double_t dphiT=dphiTs[i2] ;
+
+        Double_t a=as[i2] ;
+        Double_t m=ms[i2] ;
+        Double_t mcore=mcores[i2] ;
+        Double_t pt=pts[i2] ;
+        Double_t ptcore=ptcores[i2] ;
+        Double_t pt2=pt2s[i2] ;
+        Double_t ptcore2=ptcore2s[i2] ;
+
+        const Bool_t ph2ntUnfolded = bits2 & AliPi0FlowPhotonStore::kntUnfoldedBit ;
+        const Bool_t ph2CPV   = bits2 & AliPi0FlowPhotonStore::kCPVBit ;
+        const Bool_t ph2CPV2  = bits2 & AliPi0FlowPhotonStore::kCPV2Bit ;
+        const Bool_t ph2Disp  = bits2 & AliPi0FlowPhotonStore::kDispBit ;
+        const Bool_t ph2Disp2 = bits2 & AliPi0FlowPhotonStore::kDisp2Bit ;
+
+        FillPairHistograms(table,GetPairPIDMask(bits1,bits2),ph1->IsntUnfolded() && ph2ntUnfolded,a<kAlphaCut,
+                           m,pt,mcore,ptcore,dphiA,dphiC,dphiT,w) ;
+
+        FillPairHistogram(table,kPairAll,kHSingle,m,pt1, w) ;
+        FillPairHistogram(table,kPairAll,kHSingle,m,pt2, w) ;
+        FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore1, w) ;
+        FillPairHistogram(table,kPairAll,kHSinglecore,mcore,ptcore2, w) ;
         if(ph1->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt1, w) ;
-        if(ph2->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt2, w) ;
+          FillPairHistogram(table,kPairAll,kHSinglewou,m,pt1, w) ;
+        if(ph2ntUnfolded)
+          FillPairHistogram(table,kPairAll,kHSinglewou,m,pt2, w) ;
         if(ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt1, w) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore1, w) ;
+          FillPairHistogram(table,kPairCPV,kHSingle,m,pt1, w) ;
+          FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore1, w) ;
         }
-        if(ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt2, w) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+        if(ph2CPV){
+          FillPairHistogram(table,kPairCPV,kHSingle,m,pt2, w) ;
+          FillPairHistogram(table,kPairCPV,kHSinglecore,mcore,ptcore2, w) ;
         }
         if(ph1->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt1, w) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore1, w) ;
+          FillPairHistogram(table,kPairCPV2,kHSingle,m,pt1, w) ;
+          FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore1, w) ;
         }
-        if(ph2->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt2, w) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore2, w) ;
+        if(ph2CPV2){
+          FillPairHistogram(table,kPairCPV2,kHSingle,m,pt2, w) ;
+          FillPairHistogram(table,kPairCPV2,kHSinglecore,mcore,ptcore2, w) ;
         }
         if(ph1->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt1, w) ;
+          FillPairHistogram(table,kPairDisp,kHSingle,m,pt1, w) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt1, w) ;
-	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore1, w) ;
+            FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt1, w) ;
+          }
+          FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore1, w) ;
         }
-        if(ph2->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt2, w) ;
-          if(ph2->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt2, w) ;
-	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore2, w) ;
+        if(ph2Disp){
+          FillPairHistogram(table,kPairDisp,kHSingle,m,pt2, w) ;
+          if(ph2ntUnfolded){
+            FillPairHistogram(table,kPairDisp,kHSinglewou,m,pt2, w) ;
+          }
+          FillPairHistogram(table,kPairDisp,kHSinglecore,mcore,ptcore2, w) ;
         }
         if(ph1->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt1, w) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore1, w) ;
+          FillPairHistogram(table,kPairDisp2,kHSingle,m,pt1, w) ;
+          FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore1, w) ;
         }
-        if(ph2->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt2, w) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore2, w) ;
+        if(ph2Disp2){
+          FillPairHistogram(table,kPairDisp2,kHSingle,m,pt2, w) ;
+          FillPairHistogram(table,kPairDisp2,kHSinglecore,mcore,ptcore2, w) ;
         }
         if(ph1->IsDispOK() && ph1->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt1, w) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin);
-          FillHistogram(key,mcore,ptcore1, w) ;
+          FillPairHistogram(table,kPairBoth,kHSingle,m,pt1, w) ;
+          FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore1, w) ;
         }
-        if(ph2->IsDispOK() && ph2->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin);
-          FillHistogram(key,m,pt2, w) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin);
-          FillHistogram(key,mcore,ptcore2, w) ;
+        if(ph2Disp && ph2CPV){
+          FillPairHistogram(table,kPairBoth,kHSingle,m,pt2, w) ;
+          FillPairHistogram(table,kPairBoth,kHSinglecore,mcore,ptcore2, w) ;
         }
         if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt1, w) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore1, w) ;
-        }
-        if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt2, w) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore2, w) ;
+          FillPairHistogram(table,kPairBoth2,kHSingle,m,pt1, w) ;
+          FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore1, w) ;
         }
-
-
-
-        if(a<kAlphaCut){
-          FillHistogram(Form("hMiPi0All_a07_cen%d",fCentBin),m,pt, w) ;
+        if(ph2Disp2 && ph2CPV){
+          FillPairHistogram(table,kPairBoth2,kHSingle,m,pt2, w) ;
+          FillPairHistogram(table,kPairBoth2,kHSinglecore,mcore,ptcore2, w) ;
         }
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMiMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC, w) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	  FillHistogram(Form("hMiMassPtV0ACPVcore_cen%d",fCentBin),mcore, ptcore,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CCPVcore_cen%d",fCentBin),mcore, ptcore,dphiC, w) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPVcore_cen%d",fCentBin),mcore, ptcore,dphiT, w) ;
-
-	  FillHistogram(Form("hMiPi0CPV_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0CPVcore_cen%d",fCentBin),mcore, ptcore, w) ;
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV_a07_cen%d",fCentBin),m,pt, w) ;
-          }
-	}
-	if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	  FillHistogram(Form("hMiPi0CPV2_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0CPV2core_cen%d",fCentBin),mcore, ptcore, w) ;
-
-	  FillHistogram(Form("hMiMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC, w) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT, w) ;
-	  FillHistogram(Form("hMiMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
-	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV2_a07_cen%d",fCentBin),m,pt, w) ;
-          }
-	}
-	if(ph1->IsDispOK() && ph2->IsDispOK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
-
-
-	  FillHistogram(Form("hMiPi0Disp_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
-          if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	    FillHistogram(Form("hMiPi0Dispwou_cen%d",fCentBin),m,pt, w) ;
-	    FillHistogram(Form("hMiMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC, w) ;
-            if(fHaveTPCRP)
-	      FillHistogram(Form("hMiMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT, w) ;
-	  }
-
-	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0Disp_a07_cen%d",fCentBin),m,pt, w) ;
-          }
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC, w) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
-
-	    FillHistogram(Form("hMiPi0Both_cen%d",fCentBin),m,pt, w) ;
-	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
-
-	    if(a<kAlphaCut){
-              FillHistogram(Form("hMiPi0Both_a07_cen%d",fCentBin),m,pt, w) ;
-            }
-	  }
-	}
-	
-  	if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
-          if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
-
-
-	  FillHistogram(Form("hMiPi0Disp2_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
-
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC, w) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT, w) ;
-
-	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
-	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
-
-	    FillHistogram(Form("hMiPi0Both2_cen%d",fCentBin),m,pt, w) ;
-	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
-
-	  }
-	}
       } // end of loop i2
     }
   } // end of loop i1
 }
 
-
 void AliAnalysisTaskPi0FlowMC::ProcessMC()
 {
   FillMCHist();
@@ -46,6 +46,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliPHOSHijingEfficiency.h"
 #include "AliCaloPhoton.h"
+#include "AliPi0FlowPhotonStore.h"
 #include "AliPHOSGeometry.h"
 #include "AliPHOSEsdCluster.h"
 #include "AliPHOSCalibData.h"
@@ -666,43 +667,51 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
 {
   char key[55];
 
-  TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t pool = GetMixingPool(fVtxBin, fCentBin, fEMRPBin);
+  const Int_t nMixed = fMixedPhotons->GetNEvents(pool);
 
   for (Int_t i1=0; i1<fCaloPhotonsPHOS->GetEntriesFast(); i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     const Double_t w1 = ph1->GetWeight();
-    for(Int_t evi=0; evi<arrayList->GetEntries();evi++){
-      TObjArray * mixPHOS = static_cast<TObjArray*>(arrayList->At(evi));
-      for(Int_t i2=0; i2<mixPHOS->GetEntriesFast();i2++){
-	AliCaloPhoton * ph2=(AliCaloPhoton*)mixPHOS->At(i2) ;
-	TLorentzVector p12  = *ph1  + *ph2;
-	TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-	
-	const Double_t w2 = ph2->GetWeight();
-	Double_t w = TMath::Sqrt(w1*w2);
-
-	Double_t dphiA=p12.Phi()-fRPV0A ;
-	while(dphiA<0)dphiA+=TMath::Pi() ;
-	while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
-
-	Double_t dphiC=p12.Phi()-fRPV0C ;
-	while(dphiC<0)dphiC+=TMath::Pi() ;
-	while(dphiC>TMath::Pi())dphiC-=TMath::Pi() ;
-
-	Double_t dphiT=p12.Phi()-fRP ;
-	while(dphiT<0)dphiT+=TMath::Pi() ;
-	while(dphiT>TMath::Pi())dphiT-=TMath::Pi() ;
-
-
-        Double_t a=TMath::Abs((ph1->E()-ph2->E())/(ph1->E()+ph2->E())) ;
-        Double_t m=p12.M() ;
-        Double_t mcore=pv12.M() ;
-        Double_t pt=p12.Pt() ;
-        Double_t ptcore=pv12.Pt() ;
-        Double_t pt1=ph1->Pt() ;
-        Double_t pt2=ph2->Pt() ;
-        Double_t ptcore1=ph1->GetMomV2()->Pt() ;
-        Double_t ptcore2=ph2->GetMomV2()->Pt() ;
+    const Double_t pt1=ph1->Pt() ;
+    const Double_t ptcore1=ph1->GetMomV2()->Pt() ;
+    for(Int_t evi=0; evi<nMixed;evi++){
+      const Int_t event = fMixedPhotons->GetEvent(pool, evi) ;
+      const Int_t nPairs = fMixedPhotons->ComputePairs(event, ph1, fRPV0A, fRPV0C, fRP) ;
+      const UChar_t * bits = fMixedPhotons->GetBits(event) ;
+      const Double_t * w2s = fMixedPhotons->GetWeight(event) ;
+      const Double_t * pt2s = fMixedPhotons->GetPt(event) ;
+      const Double_t * ptcore2s = fMixedPhotons->GetPtCore(event) ;
+      const Double_t * ms = fMixedPhotons->GetPairM() ;
+      const Double_t * pts = fMixedPhotons->GetPairPt() ;
+      const Double_t * mcores = fMixedPhotons->GetPairMCore() ;
+      const Double_t * ptcores = fMixedPhotons->GetPairPtCore() ;
+      const Double_t * as = fMixedPhotons->GetPairAsym() ;
+      const Double_t * dphiAs = fMixedPhotons->GetPairDPhiV0A() ;
+      const Double_t * dphiCs = fMixedPhotons->GetPairDPhiV0C() ;
+      const Double_t * dphiTs = fMixedPhotons->GetPairDPhiTPC() ;
+      for(Int_t i2=0; i2<nPairs;i2++){
+        const UInt_t bits2 = bits[i2] ;
+        const Double_t w2 = w2s[i2];
+        Double_t w = TMath::Sqrt(w1*w2);
+
+        Double_t dphiA=dphiAs[i2] ;
+        Double_t dphiC=dphiCs[i2] ;
+        Double_t dphiT=dphiTs[i2] ;
+
+        Double_t a=as[i2] ;
+        Double_t m=ms[i2] ;
+        Double_t mcore=mcores[i2] ;
+        Double_t pt=pts[i2] ;
+        Double_t ptcore=ptcores[i2] ;
+        Double_t pt2=pt2s[i2] ;
+        Double_t ptcore2=ptcore2s[i2] ;
+
+        const Bool_t ph2ntUnfolded = bits2 & AliPi0FlowPhotonStore::kntUnfoldedBit ;
+        const Bool_t ph2CPV   = bits2 & AliPi0FlowPhotonStore::kCPVBit ;
+        const Bool_t ph2CPV2  = bits2 & AliPi0FlowPhotonStore::kCPV2Bit ;
+        const Bool_t ph2Disp  = bits2 & AliPi0FlowPhotonStore::kDispBit ;
+        const Bool_t ph2Disp2 = bits2 & AliPi0FlowPhotonStore::kDisp2Bit ;
 
 
 	snprintf(key,55,"hMiMassPtAll_cen%d",fCentBin) ;
@@ -718,7 +727,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
 
 	FillHistogram(Form("hMiPi0All_cen%d",fCentBin),m,pt, w) ;
 	FillHistogram(Form("hMiPi0Allcore_cen%d",fCentBin),mcore,ptcore, w) ;
-	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
+	if(ph1->IsntUnfolded() && ph2ntUnfolded){
 	  FillHistogram(Form("hMiPi0Allwou_cen%d",fCentBin),m,pt, w) ;
           FillHistogram(Form("hMiMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA, w) ;
           FillHistogram(Form("hMiMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC, w) ;
@@ -732,13 +741,13 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
         FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore2, w) ;
         if(ph1->IsntUnfolded())
           FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt1, w) ;
-        if(ph2->IsntUnfolded())
+        if(ph2ntUnfolded)
           FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt2, w) ;
         if(ph1->IsCPVOK()){
           FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt1, w) ;
           FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore1, w) ;
         }
-        if(ph2->IsCPVOK()){
+        if(ph2CPV){
           FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt2, w) ;
           FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore2, w) ;
         }
@@ -746,7 +755,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
           FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt1, w) ;
           FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore1, w) ;
         }
-        if(ph2->IsCPV2OK()){
+        if(ph2CPV2){
           FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt2, w) ;
           FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore2, w) ;
         }
@@ -757,7 +766,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
 	  }
           FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore1, w) ;
         }
-        if(ph2->IsDispOK()){
+        if(ph2Disp){
           FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt2, w) ;
           if(ph1->IsntUnfolded()){
             FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt2, w) ;
@@ -768,7 +777,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
           FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt1, w) ;
           FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore1, w) ;
         }
-        if(ph2->IsDisp2OK()){
+        if(ph2Disp2){
           FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt2, w) ;
           FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore2, w) ;
         }
@@ -778,7 +787,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
           snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin);
           FillHistogram(key,mcore,ptcore1, w) ;
         }
-        if(ph2->IsDispOK() && ph2->IsCPVOK()){
+        if(ph2Disp && ph2CPV){
           snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin);
           FillHistogram(key,m,pt2, w) ;
           snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin);
@@ -788,7 +797,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
           FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt1, w) ;
           FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore1, w) ;
         }
-        if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
+        if(ph2Disp2 && ph2CPV){
           FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt2, w) ;
           FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore2, w) ;
         }
@@ -798,7 +807,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
         if(a<kAlphaCut){
           FillHistogram(Form("hMiPi0All_a07_cen%d",fCentBin),m,pt, w) ;
         }
-	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
+	if(ph1->IsCPVOK() && ph2CPV){
 	  FillHistogram(Form("hMiMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA, w) ;
 	  FillHistogram(Form("hMiMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC, w) ;
 	  if(fHaveTPCRP)
@@ -816,7 +825,7 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
             FillHistogram(Form("hMiPi0CPV_a07_cen%d",fCentBin),m,pt, w) ;
           }
 	}
-	if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
+	if(ph1->IsCPV2OK() && ph2CPV2){
 	  FillHistogram(Form("hMiPi0CPV2_cen%d",fCentBin),m,pt, w) ;
 	  FillHistogram(Form("hMiPi0CPV2core_cen%d",fCentBin),mcore, ptcore, w) ;
 
@@ -833,21 +842,21 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
             FillHistogram(Form("hMiPi0CPV2_a07_cen%d",fCentBin),m,pt, w) ;
           }
 	}
-	if(ph1->IsDispOK() && ph2->IsDispOK()){
+	if(ph1->IsDispOK() && ph2Disp){
 	  FillHistogram(Form("hMiMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA, w) ;
 	  FillHistogram(Form("hMiMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC, w) ;
           if(fHaveTPCRP)
 	    FillHistogram(Form("hMiMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT, w) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
+	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
+	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
+	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
 
 
 	  FillHistogram(Form("hMiPi0Disp_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
-          if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
+	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),mcore,ptcore, w) ;
+          if(ph1->IsntUnfolded() && ph2ntUnfolded){
 	    FillHistogram(Form("hMiPi0Dispwou_cen%d",fCentBin),m,pt, w) ;
 	    FillHistogram(Form("hMiMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA, w) ;
 	    FillHistogram(Form("hMiMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC, w) ;
@@ -858,19 +867,19 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
 	  if(a<kAlphaCut){
             FillHistogram(Form("hMiPi0Disp_a07_cen%d",fCentBin),m,pt, w) ;
           }
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
+	  if(ph1->IsCPVOK() && ph2CPV){
 	    FillHistogram(Form("hMiMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA, w) ;
 	    FillHistogram(Form("hMiMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC, w) ;
 	    if(fHaveTPCRP)
   	      FillHistogram(Form("hMiMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT, w) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
+	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
+	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
+  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
 
 	    FillHistogram(Form("hMiPi0Both_cen%d",fCentBin),m,pt, w) ;
-	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
+	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),mcore,ptcore, w) ;
 
 	    if(a<kAlphaCut){
               FillHistogram(Form("hMiPi0Both_a07_cen%d",fCentBin),m,pt, w) ;
@@ -878,34 +887,34 @@ void AliAnalysisTaskPi0FlowMCAOD::ConsiderPi0sMix()
 	  }
 	}
 	
-  	if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
+  	if(ph1->IsDisp2OK() && ph2Disp2){
 	  FillHistogram(Form("hMiMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA, w) ;
 	  FillHistogram(Form("hMiMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC, w) ;
           if(fHaveTPCRP)
 	    FillHistogram(Form("hMiMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT, w) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
+	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
+	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
+	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
 
 
 	  FillHistogram(Form("hMiPi0Disp2_cen%d",fCentBin),m,pt, w) ;
-	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
+	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),mcore,ptcore, w) ;
 
-	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
+	  if(ph1->IsCPVOK() && ph2CPV){
 	    FillHistogram(Form("hMiMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA, w) ;
 	    FillHistogram(Form("hMiMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC, w) ;
 	    if(fHaveTPCRP)
   	      FillHistogram(Form("hMiMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT, w) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA, w) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC, w) ;
+	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),mcore,ptcore,dphiA, w) ;
+	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),mcore,ptcore,dphiC, w) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT, w) ;
+  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),mcore,ptcore,dphiT, w) ;
 
 	    FillHistogram(Form("hMiPi0Both2_cen%d",fCentBin),m,pt, w) ;
-	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),pv12.M(),pv12.Pt(), w) ;
+	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),mcore,ptcore, w) ;
 
 	  }
 	}
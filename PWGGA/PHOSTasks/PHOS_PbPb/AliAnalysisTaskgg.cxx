@@ -65,7 +65,9 @@ AliAnalysisTaskgg::AliAnalysisTaskgg(const char *name)
   fRP(0.),
   fPHOSGeo(0x0),
   fEventCounter(0),
-  fIsPbPb(kTRUE)
+  fIsPbPb(kTRUE),
+  fNPairCuts(0),
+  fPairHists()
   
 {
   // Constructor
@@ -317,7 +319,7 @@ void AliAnalysisTaskgg::UserCreateOutputObjects()
   sprintf(kTbins[5],"Kt13-20") ;
 
   
-  const Int_t nCenBin=4;
+  const Int_t nCenBin=kNCenBins;
   for(Int_t cen=0; cen<2; cen++){  
 //     for(Int_t ikT=0; ikT<6; ikT++){ 
 //       fOutputContainer->Add(new TH3F(Form("hOSLCMS_%s_cen%d",kTbins[ikT],cen),"Out-Side-Long, CMS",nQ,-qMax,qMax,nQ,-qMax,qMax,nQ,-qMax,qMax));
@@ -427,6 +429,8 @@ void AliAnalysisTaskgg::UserCreateOutputObjects()
   fOutputContainer->Add(new TH2F("hMiPi0M33","Pairs in modules",nM,mMin,mMax,nPtPhot,0.,ptPhotMax));
 */    
   
+  BuildPairHistTables() ;
+
   PostData(1, fOutputContainer);
 
 }
@@ -842,6 +846,13 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
     fJetStatus[mod]=JetRejection(mod) ;
 
   const Double_t kgMass=0. ;
+
+  //Histograms of the pair loops, dXdZ and eta-phi are in coarser centrality bins
+  TH1 * const * table = GetPairHistTable(kFALSE,fCenBin) ;
+  TH1 * const * tableDXDZ = GetPairHistTable(kFALSE,fCenBin/3) ;
+  TH1 * const * tableMi = GetPairHistTable(kTRUE,fCenBin) ;
+  TH1 * const * tableMiDXDZ = GetPairHistTable(kTRUE,fCenBin/3) ;
+  Bool_t pairCuts[120] ; //PairCut for each cut, see fCuts
 	
 
   //Real
@@ -954,18 +965,20 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
          qinvHit=(pHitHadron1 + pHitHadron2).M();
       }
       
-      
+      //Evaluate all pair cuts once
+      for(Int_t iCut=0; iCut<fNPairCuts; iCut++)
+        pairCuts[iCut]=PairCut(ph1,ph2,iCut) ;
       
 	
       for(Int_t iCut=0; iCut<12; iCut++){
-	if(!PairCut(ph1,ph2,iCut))
+	if(!pairCuts[iCut])
 	    continue ;
-	FillHistogram(Form("hdXdZ_%s_cen%d",fCuts[iCut],fCenBin/3),dX,dZ,kT) ;
-        FillHistogram(Form("hetaphi_%s_cen%d",fCuts[iCut],fCenBin/3),dEta,dPhi,kT) ;
+	FillPairHistogram(tableDXDZ,iCut,kHdXdZ,dX,dZ,kT) ;
+        FillPairHistogram(tableDXDZ,iCut,kHetaphi,dEta,dPhi,kT) ;
       }      
       
       for(Int_t iCut=0; iCut<fNCuts; iCut++){
-	if(!PairCut(ph1,ph2,iCut))
+	if(!pairCuts[iCut])
 	    continue ;
 	
 //         FillHistogram(Form("hetaphi2D_%s_%s",fCuts[iCut],kTbin.Data()),dEta,dPhi) ;
@@ -975,8 +988,8 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
 	
         
         if(iCut>=38 && iCut<59){//hadron combinations
- 	  FillHistogram(Form("hQinvPrimH_%s_cen%d",fCuts[iCut],fCenBin),qinvPrim,kTPrim) ;
- 	  FillHistogram(Form("hQinvHitH_%s_cen%d",fCuts[iCut],fCenBin),qinvHit,kT) ;
+ 	  FillPairHistogram(table,iCut,kHQinvPrimH,qinvPrim,kTPrim) ;
+ 	  FillPairHistogram(table,iCut,kHQinvHitH,qinvHit,kT) ;
         }
         
         
@@ -996,14 +1009,14 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
           FillHistogram(Form("hSLr_%s",kTbin.Data()),qspf,qlpf,r) ;	  
 	}*/
 	  
-	FillHistogram(Form("hQinv_%s_cen%d",fCuts[iCut],fCenBin),qinv,kT) ;
+	FillPairHistogram(table,iCut,kHQinv,qinv,kT) ;
 	if(TMath::Abs(qo) < 0.05)
-	  FillHistogram(Form("hQinvCut_%s_cen%d",fCuts[iCut],fCenBin),qinv,kT) ;
+	  FillPairHistogram(table,iCut,kHQinvCut,qinv,kT) ;
         
         //Opening angle
         Double_t dPsi = ph1->Vect().Angle(ph2->Vect()) ;
-	FillHistogram(Form("hPhi_%s_cen%d",fCuts[iCut],fCenBin),dPsi,kT) ;
-	FillHistogram(Form("hR_%s_cen%d",fCuts[iCut],fCenBin),dR,kT) ;
+	FillPairHistogram(table,iCut,kHPhi,dPsi,kT) ;
+	FillPairHistogram(table,iCut,kHR,dR,kT) ;
         
         
 
@@ -1139,16 +1152,20 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
          qinvHit=(pHitHadron1 + pHitHadron2).M();
       }
      
+      //Evaluate all pair cuts once
+      for(Int_t iCut=0; iCut<fNPairCuts; iCut++)
+        pairCuts[iCut]=PairCut(ph1,ph2,iCut) ;
+
       for(Int_t iCut=0; iCut<12; iCut++){
-	if(!PairCut(ph1,ph2,iCut))
+	if(!pairCuts[iCut])
 	    continue ;
-	FillHistogram(Form("hMidXdZ_%s_cen%d",fCuts[iCut],fCenBin/3),dX,dZ,kT) ;
-        FillHistogram(Form("hMietaphi_%s_cen%d",fCuts[iCut],fCenBin/3),dEta,dPhi,kT) ;
+	FillPairHistogram(tableMiDXDZ,iCut,kHdXdZ,dX,dZ,kT) ;
+        FillPairHistogram(tableMiDXDZ,iCut,kHetaphi,dEta,dPhi,kT) ;
       }      
       
       
 	for(Int_t iCut=0; iCut<fNCuts; iCut++){
-   	  if(!PairCut(ph1,ph2,iCut))
+   	  if(!pairCuts[iCut])
 	    continue ;
 	  
 //           FillHistogram(Form("hMietaphi2D_%s_%s",fCuts[iCut],kTbin.Data()),dEta,dPhi) ;
@@ -1165,20 +1182,20 @@ void AliAnalysisTaskgg::UserExec(Option_t *)
             FillHistogram(Form("hMiSLr_%s",kTbin.Data()),qspf,qlpf,r) ;	  
 	  }  */
 	  
-	  FillHistogram(Form("hMiQinv_%s_cen%d",fCuts[iCut],fCenBin),qinv,kT) ;
+	  FillPairHistogram(tableMi,iCut,kHQinv,qinv,kT) ;
 // 	  FillHistogram(Form("hMi2Qinv_%s",fCuts[iCut]),qinv,kT,wMix) ;
 	   if(TMath::Abs(qo) < 0.05){
-	     FillHistogram(Form("hMiQinvCut_%s_cen%d",fCuts[iCut],fCenBin),qinv,kT) ;
+	     FillPairHistogram(tableMi,iCut,kHQinvCut,qinv,kT) ;
 // 	     FillHistogram(Form("hMi2QinvCut_%s",fCuts[iCut]),qinv,kT,wMix) ;
 	   }
           //Opening angle
           Double_t dPsi = ph1->Vect().Angle(ph2->Vect()) ;
-   	  FillHistogram(Form("hMiPhi_%s_cen%d",fCuts[iCut],fCenBin),dPsi,kT) ;
-   	  FillHistogram(Form("hMiR_%s_cen%d",fCuts[iCut],fCenBin),dR,kT) ;
+   	  FillPairHistogram(tableMi,iCut,kHPhi,dPsi,kT) ;
+   	  FillPairHistogram(tableMi,iCut,kHR,dR,kT) ;
 	   
           if(iCut>=38 && iCut<59){//hadron combinations
- 	    FillHistogram(Form("hMiQinvPrimH_%s_cen%d",fCuts[iCut],fCenBin),qinvPrim,kTPrim) ;
- 	    FillHistogram(Form("hMiQinvHitH_%s_cen%d",fCuts[iCut],fCenBin),qinvHit,kT) ;
+ 	    FillPairHistogram(tableMi,iCut,kHQinvPrimH,qinvPrim,kTPrim) ;
+ 	    FillPairHistogram(tableMi,iCut,kHQinvHitH,qinvHit,kT) ;
           }
 	   
 	   
@@ -1314,6 +1331,50 @@ void AliAnalysisTaskgg::FillHistogram(const char * key,Double_t x,Double_t y, Do
   }
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskgg::BuildPairHistTables(){
+  //Look up the histograms filled in the pair loops, once.
+  //Entries of histograms which are not booked stay 0x0.
+  fNPairCuts = TMath::Max(fNCuts,12) ;
+  const char * histNames[kNPairHist] = {"dXdZ", "etaphi", "Qinv", "QinvCut", "Phi", "R", "QinvPrimH", "QinvHitH"} ;
+  fPairHists.assign(2*kNCenBins*fNPairCuts*kNPairHist, 0x0) ;
+  for(Int_t mixed=0; mixed<2; mixed++){
+    for(Int_t cen=0; cen<kNCenBins; cen++){
+      for(Int_t iCut=0; iCut<fNPairCuts; iCut++){
+        for(Int_t ih=0; ih<kNPairHist; ih++){
+          if(ih==kHdXdZ || ih==kHetaphi){
+            if(iCut>=12 || cen>=2)
+              continue ;
+          }
+          else if(iCut>=fNCuts)
+            continue ;
+          if((ih==kHQinvPrimH || ih==kHQinvHitH) && (iCut<38 || iCut>=59))
+            continue ;
+          TString name = Form("h%s%s_%s_cen%d", mixed ? "Mi" : "", histNames[ih], fCuts[iCut], cen) ;
+          TH1 * hist = dynamic_cast<TH1*>(fOutputContainer->FindObject(name)) ;
+          if(!hist){
+            AliInfo(Form("can not find histogram <%s> ",name.Data())) ;
+            continue ;
+          }
+          fPairHists[((mixed*kNCenBins + cen)*fNPairCuts + iCut)*kNPairHist + ih] = hist ;
+        }
+      }
+    }
+  }
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskgg::FillPairHistogram(TH1 * const * table, Int_t cut, Int_t hist, Double_t x, Double_t y) const{
+  TH1 * h = table[cut*kNPairHist + hist] ;
+  if(h)
+    static_cast<TH2F*>(h)->Fill(x,y) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskgg::FillPairHistogram(TH1 * const * table, Int_t cut, Int_t hist, Double_t x, Double_t y, Double_t z) const{
+  TH1 * h = table[cut*kNPairHist + hist] ;
+  if(h)
+    static_cast<TH3F*>(h)->Fill(x,y,z) ;
+}
+
 //___________________________________________________________________________
 Int_t AliAnalysisTaskgg::ConvertRunNumber(Int_t run){
 
@@ -11,10 +11,14 @@ class AliAODTrack ;
 class AliAODEvent ;
 class AliEPFlattener ;
 class AliPIDResponse ;
+class TH1 ;
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 class AliAnalysisTaskgg : public AliAnalysisTaskSE {
 public:
+  //Histogram families of the pair loops, see BuildPairHistTables()
+  enum PairHist { kHdXdZ, kHetaphi, kHQinv, kHQinvCut, kHPhi, kHR, kHQinvPrimH, kHQinvHitH, kNPairHist };
     
   
   AliAnalysisTaskgg(const char *name = "AliAnalysisTaskgg");
@@ -32,6 +36,12 @@ protected:
   void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram witn name key
   void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram witn name key
 
+  //Pair loops: histograms are looked up once, not by name for each pair
+  void BuildPairHistTables() ; //Fill fPairHists from fOutputContainer
+  TH1 * const * GetPairHistTable(Bool_t mixed, Int_t cen) const { return &fPairHists[((mixed ? 1 : 0)*kNCenBins + cen)*fNPairCuts*kNPairHist]; }
+  void FillPairHistogram(TH1 * const * table, Int_t cut, Int_t hist, Double_t x, Double_t y) const ; //Fill 2D histogram of the table
+  void FillPairHistogram(TH1 * const * table, Int_t cut, Int_t hist, Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram of the table
+
   
   Int_t  ConvertRunNumber(Int_t run) ; 
   Int_t  FindTrackMatching(Int_t mod,TVector3 *locpos); 
@@ -52,6 +62,8 @@ private:
 
 protected:
 
+  static const Int_t kNCenBins = 4 ; //Centrality bins of the pair histograms
+
   THashList *   fOutputContainer;        //final histogram container
   AliAODEvent * fEvent ;                 //!
   AliPIDResponse *fPIDResponse;     //! PID response object
@@ -76,7 +88,10 @@ protected:
   char fCuts[120][20] ;  //Cut names
   Int_t fJetStatus[5] ; //Presence of jets around PHOS
 
-  ClassDef(AliAnalysisTaskgg, 1); // PHOS analysis task
+  Int_t fNPairCuts ;              //! cuts in the pair histogram table
+  std::vector<TH1*> fPairHists ;  //! [real/mixed][centrality bin][cut][PairHist], 0x0 if not booked
+
+  ClassDef(AliAnalysisTaskgg, 2); // PHOS analysis task
 };
 
 #endif
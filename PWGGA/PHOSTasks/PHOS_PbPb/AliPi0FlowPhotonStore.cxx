@@ -0,0 +1,194 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "TObjArray.h"
+#include "TMath.h"
+
+#include "AliCaloPhoton.h"
+#include "AliPi0FlowPhotonStore.h"
+
+// Mixed event photon pools of AliAnalysisTaskPi0Flow, see header
+
+ClassImp(AliPi0FlowPhotonStore);
+
+//_____________________________________________________________________________
+AliPi0FlowPhotonStore::AliPi0FlowPhotonStore()
+  : TObject(),
+    fMaxDepth(0),
+    fNEvents(),
+    fNewest(),
+    fNPhotons(),
+    fData(),
+    fBits(),
+    fPairM(),
+    fPairPt(),
+    fPairMCore(),
+    fPairPtCore(),
+    fPairAsym(),
+    fPairDPhiA(),
+    fPairDPhiC(),
+    fPairDPhiT(),
+    fPairPhi()
+{
+}
+//_____________________________________________________________________________
+void AliPi0FlowPhotonStore::Init(Int_t nPools, Int_t maxDepth)
+{
+  //Empty pools, each keeping up to maxDepth events
+  fMaxDepth = maxDepth>0 ? maxDepth : 0 ;
+  fNEvents.assign(nPools, 0) ;
+  fNewest.assign(nPools, 0) ;
+  fNPhotons.assign(nPools*fMaxDepth, 0) ;
+  fData.assign(nPools*fMaxDepth, std::vector<Double_t>()) ;
+  fBits.assign(nPools*fMaxDepth, std::vector<UChar_t>()) ;
+}
+//_____________________________________________________________________________
+void AliPi0FlowPhotonStore::AddEvent(Int_t pool, Int_t depth, const TObjArray * photons)
+{
+  //Store the photons as most recent event of the pool, replacing the
+  //oldest one when the pool holds depth events
+  if(fMaxDepth==0)
+    return ;
+  if(depth>fMaxDepth)
+    depth = fMaxDepth ;
+
+  if(fNEvents[pool]>0)
+    fNewest[pool] = (fNewest[pool]+1) % fMaxDepth ;
+  fNEvents[pool] = TMath::Max(0, TMath::Min(fNEvents[pool]+1, depth)) ;
+
+  const Int_t event = pool*fMaxDepth + fNewest[pool] ;
+  const Int_t n = photons->GetEntriesFast() ;
+  fNPhotons[event] = n ;
+  std::vector<Double_t> & data = fData[event] ;
+  data.resize(kNColumns*n) ; // capacity is kept from the previous events
+  fBits[event].resize(n) ;
+
+  for(Int_t i=0; i<n; i++){
+    const AliCaloPhoton * ph = static_cast<const AliCaloPhoton*>(photons->At(i)) ;
+    const TLorentzVector * core = ph->GetMomV2() ;
+    data[kPx*n+i]     = ph->Px() ;
+    data[kPy*n+i]     = ph->Py() ;
+    data[kPz*n+i]     = ph->Pz() ;
+    data[kE*n+i]      = ph->E() ;
+    data[kPxCore*n+i] = core->Px() ;
+    data[kPyCore*n+i] = core->Py() ;
+    data[kPzCore*n+i] = core->Pz() ;
+    data[kECore*n+i]  = core->E() ;
+    data[kPt*n+i]     = ph->Pt() ;
+    data[kPtCore*n+i] = core->Pt() ;
+    data[kWeight*n+i] = ph->GetWeight() ;
+    fBits[event][i]   = GetPhotonBits(ph) ;
+  }
+}
+//_____________________________________________________________________________
+Int_t AliPi0FlowPhotonStore::GetEvent(Int_t pool, Int_t i) const
+{
+  //Index of the i-th most recent event of the pool, i < GetNEvents(pool)
+  return pool*fMaxDepth + (fNewest[pool] - i + fMaxDepth) % fMaxDepth ;
+}
+//_____________________________________________________________________________
+UInt_t AliPi0FlowPhotonStore::GetPhotonBits(const AliCaloPhoton * ph)
+{
+  UInt_t bits = 0 ;
+  if(ph->IsCPVOK())
+    bits |= kCPVBit ;
+  if(ph->IsCPV2OK())
+    bits |= kCPV2Bit ;
+  if(ph->IsDispOK())
+    bits |= kDispBit ;
+  if(ph->IsDisp2OK())
+    bits |= kDisp2Bit ;
+  if(ph->IsTOFOK())
+    bits |= kTOFBit ;
+  if(ph->IsntUnfolded())
+    bits |= kntUnfoldedBit ;
+  return bits ;
+}
+//_____________________________________________________________________________
+Double_t AliPi0FlowPhotonStore::ReactionPlaneAngle(Double_t phi, Double_t rp)
+{
+  //Pair angle with respect to the reaction plane, in [0,pi]
+  Double_t dphi=phi-rp ;
+  while(dphi<0)dphi+=TMath::Pi() ;
+  while(dphi>TMath::Pi())dphi-=TMath::Pi() ;
+  return dphi ;
+}
+//_____________________________________________________________________________
+Int_t AliPi0FlowPhotonStore::ComputePairs(Int_t event, const AliCaloPhoton * ph, Double_t rpV0A, Double_t rpV0C, Double_t rp)
+{
+  //Invariant mass, pt, core mass and pt, energy asymmetry and angles to the
+  //V0A, V0C and TPC reaction planes of the pairs of ph with all photons of
+  //the stored event. Same operations as the sum of the two TLorentzVectors
+  //followed by M(), Pt() and Phi(). Returns the number of pairs.
+  const Int_t n = fNPhotons[event] ;
+  if(n==0)
+    return 0 ;
+  if((Int_t)fPairM.size()<n){
+    fPairM.resize(n) ;
+    fPairPt.resize(n) ;
+    fPairMCore.resize(n) ;
+    fPairPtCore.resize(n) ;
+    fPairAsym.resize(n) ;
+    fPairDPhiA.resize(n) ;
+    fPairDPhiC.resize(n) ;
+    fPairDPhiT.resize(n) ;
+    fPairPhi.resize(n) ;
+  }
+
+  const Double_t px1 = ph->Px(), py1 = ph->Py(), pz1 = ph->Pz(), e1 = ph->E() ;
+  const TLorentzVector * core1 = ph->GetMomV2() ;
+  const Double_t pxc1 = core1->Px(), pyc1 = core1->Py(), pzc1 = core1->Pz(), ec1 = core1->E() ;
+
+  const Double_t * px2  = GetColumn(event, kPx) ;
+  const Double_t * py2  = GetColumn(event, kPy) ;
+  const Double_t * pz2  = GetColumn(event, kPz) ;
+  const Double_t * e2   = GetColumn(event, kE) ;
+  const Double_t * pxc2 = GetColumn(event, kPxCore) ;
+  const Double_t * pyc2 = GetColumn(event, kPyCore) ;
+  const Double_t * pzc2 = GetColumn(event, kPzCore) ;
+  const Double_t * ec2  = GetColumn(event, kECore) ;
+
+  Double_t * m      = &fPairM[0] ;
+  Double_t * pt     = &fPairPt[0] ;
+  Double_t * mcore  = &fPairMCore[0] ;
+  Double_t * ptcore = &fPairPtCore[0] ;
+  Double_t * asym   = &fPairAsym[0] ;
+  Double_t * phi    = &fPairPhi[0] ;
+
+  //kinematics, no branches in the loop body except the sign of m^2
+  for(Int_t i=0; i<n; i++){
+    const Double_t x = px1+px2[i], y = py1+py2[i], z = pz1+pz2[i], e = e1+e2[i] ;
+    const Double_t mm = e*e - (x*x+y*y+z*z) ;
+    m[i]  = mm < 0.0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm) ;
+    pt[i] = TMath::Sqrt(x*x+y*y) ;
+    phi[i] = x == 0.0 && y == 0.0 ? 0.0 : TMath::ATan2(y,x) ;
+
+    const Double_t xc = pxc1+pxc2[i], yc = pyc1+pyc2[i], zc = pzc1+pzc2[i], ec = ec1+ec2[i] ;
+    const Double_t mmc = ec*ec - (xc*xc+yc*yc+zc*zc) ;
+    mcore[i]  = mmc < 0.0 ? -TMath::Sqrt(-mmc) : TMath::Sqrt(mmc) ;
+    ptcore[i] = TMath::Sqrt(xc*xc+yc*yc) ;
+
+    asym[i] = TMath::Abs((e1-e2[i])/(e1+e2[i])) ;
+  }
+
+  //reaction plane angles
+  for(Int_t i=0; i<n; i++){
+    fPairDPhiA[i] = ReactionPlaneAngle(phi[i], rpV0A) ;
+    fPairDPhiC[i] = ReactionPlaneAngle(phi[i], rpV0C) ;
+    fPairDPhiT[i] = ReactionPlaneAngle(phi[i], rp) ;
+  }
+
+  return n ;
+}
@@ -0,0 +1,86 @@
+#ifndef AliPi0FlowPhotonStore_h
+#define AliPi0FlowPhotonStore_h
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// Photons of previous events for the event mixing of AliAnalysisTaskPi0Flow.
+// One pool per (vertex, centrality, reaction plane) bin holds the last
+// events in a ring of fixed depth. The photons of an event are kept in one
+// contiguous block, one array per quantity (4-momentum, core 4-momentum,
+// pt, weight, PID bits), which is reused when the event is replaced.
+// ComputePairs() evaluates one photon of the current event against all
+// photons of a stored event, with the same arithmetic as TLorentzVector.
+
+#include "TObject.h"
+#include <vector>
+
+class TObjArray;
+class AliCaloPhoton;
+
+class AliPi0FlowPhotonStore : public TObject {
+public:
+    enum PhotonBit { kCPVBit = 1<<0, kCPV2Bit = 1<<1, kDispBit = 1<<2, kDisp2Bit = 1<<3, kTOFBit = 1<<4, kntUnfoldedBit = 1<<5 };
+
+    AliPi0FlowPhotonStore();
+    virtual ~AliPi0FlowPhotonStore() {}
+
+    void Init(Int_t nPools, Int_t maxDepth);
+    void AddEvent(Int_t pool, Int_t depth, const TObjArray * photons); //keeps the last depth events of the pool
+
+    Int_t GetNEvents(Int_t pool) const { return fNEvents[pool]; }
+    Int_t GetEvent(Int_t pool, Int_t i) const; //i-th most recent event of the pool
+
+    //Photons of a stored event
+    Int_t GetNPhotons(Int_t event) const { return fNPhotons[event]; }
+    const Double_t * GetPt(Int_t event) const     { return GetColumn(event, kPt); }
+    const Double_t * GetPtCore(Int_t event) const { return GetColumn(event, kPtCore); }
+    const Double_t * GetWeight(Int_t event) const { return GetColumn(event, kWeight); }
+    const UChar_t * GetBits(Int_t event) const    { return fNPhotons[event] ? &fBits[event][0] : 0x0; }
+
+    //Pairs of photon ph with all photons of a stored event, results in the arrays below
+    Int_t ComputePairs(Int_t event, const AliCaloPhoton * ph, Double_t rpV0A, Double_t rpV0C, Double_t rp);
+    const Double_t * GetPairM() const      { return &fPairM[0]; }
+    const Double_t * GetPairPt() const     { return &fPairPt[0]; }
+    const Double_t * GetPairMCore() const  { return &fPairMCore[0]; }
+    const Double_t * GetPairPtCore() const { return &fPairPtCore[0]; }
+    const Double_t * GetPairAsym() const   { return &fPairAsym[0]; }
+    const Double_t * GetPairDPhiV0A() const { return &fPairDPhiA[0]; }
+    const Double_t * GetPairDPhiV0C() const { return &fPairDPhiC[0]; }
+    const Double_t * GetPairDPhiTPC() const { return &fPairDPhiT[0]; }
+
+    static UInt_t GetPhotonBits(const AliCaloPhoton * ph);
+
+private:
+    enum Column { kPx, kPy, kPz, kE, kPxCore, kPyCore, kPzCore, kECore, kPt, kPtCore, kWeight, kNColumns };
+
+    const Double_t * GetColumn(Int_t event, Int_t column) const { return fNPhotons[event] ? &fData[event][column*fNPhotons[event]] : 0x0; }
+    static Double_t ReactionPlaneAngle(Double_t phi, Double_t rp);
+
+    Int_t fMaxDepth;               //! events per pool
+    std::vector<Int_t> fNEvents;   //! stored events per pool
+    std::vector<Int_t> fNewest;    //! ring position of the most recent event per pool
+
+    //Per event (pool*fMaxDepth + ring position)
+    std::vector<Int_t> fNPhotons;                //!
+    std::vector< std::vector<Double_t> > fData;  //! kNColumns arrays of fNPhotons
+    std::vector< std::vector<UChar_t> > fBits;   //! PhotonBit
+
+    //Output of ComputePairs
+    std::vector<Double_t> fPairM;      //!
+    std::vector<Double_t> fPairPt;     //!
+    std::vector<Double_t> fPairMCore;  //!
+    std::vector<Double_t> fPairPtCore; //!
+    std::vector<Double_t> fPairAsym;   //!
+    std::vector<Double_t> fPairDPhiA;  //!
+    std::vector<Double_t> fPairDPhiC;  //!
+    std::vector<Double_t> fPairDPhiT;  //!
+    std::vector<Double_t> fPairPhi;    //!
+
+    AliPi0FlowPhotonStore(const AliPi0FlowPhotonStore&); // not implemented
+    AliPi0FlowPhotonStore& operator=(const AliPi0FlowPhotonStore&); // not implemented
+
+    ClassDef(AliPi0FlowPhotonStore, 1); // Mixed event photon pools of AliAnalysisTaskPi0Flow
+};
+
+#endif
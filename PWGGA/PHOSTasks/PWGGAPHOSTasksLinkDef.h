@@ -37,6 +37,7 @@
 
 //PHOS_PbPb
 #pragma link C++ class AliAnalysisTaskPi0Flow+;
+#pragma link C++ class AliPi0FlowPhotonStore+;
 #pragma link C++ class AliAnalysisTaskGammaFlow+;
 #pragma link C++ class AliAnalysisTaskgg+;
 #pragma link C++ class AliAnalysisTaskggMC+;
@@ -65,6 +65,7 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fUseFixSigFixMean(kTRUE),
   fSaveBkgVal(kFALSE),
   fDrawIndividualFits(kFALSE),
+  fUseWarmStart(kFALSE),
   fHistoRawYieldDistAll(0x0),
   fHistoRawYieldTrialAll(0x0),
   fHistoSigmaTrialAll(0x0),
@@ -202,18 +203,31 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   fMaxYieldGlob=0.;
   Float_t xnt[15];
 
+  // The trials are fitted one after the other: AliHFMassFitterVAR fits via TH1::Fit with the
+  // global TVirtualFitter (TMinuit), which is not thread-safe, so the trials cannot run in parallel.
+
+  // mean and sigma of the successful fits of each case and fit range on the current rebinned
+  // histogram, used as starting values for the adjacent fit ranges if fUseWarmStart is set
+  const Int_t nCases=kNBkgFuncCases*kNFitConfCases;
+  const Int_t nRanges=fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
+  std::vector<Bool_t> warmOK;
+  std::vector<Double_t> warmMean(nCases*nRanges);
+  std::vector<Double_t> warmSigma(nCases*nRanges);
+
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
       TH1F* hRebinned=0x0;
       if(fNumOfFirstBinSteps==1) hRebinned=RebinHisto(hInvMassHisto,rebin,-1);
       else hRebinned=RebinHisto(hInvMassHisto,rebin,iFirstBin);
+      warmOK.assign(nCases*nRanges,kFALSE);
       for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
         Double_t minMassForFit=fLowLimFitSteps[iMinMass];
         Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
         for(Int_t iMaxMass=0; iMaxMass<fNumOfUpLimFitSteps; iMaxMass++){
           Double_t maxMassForFit=fUpLimFitSteps[iMaxMass];
           Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
+          Int_t iRange=iMinMass*fNumOfUpLimFitSteps+iMaxMass;
           ++itrial;
           for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
             if(typeb==kExpoBkg && !fUseExpoBkg) continue;
@@ -270,8 +284,22 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
                 fitter->SetUseLikelihoodWithWeightsFit();
                 Printf("Using likelihood fit with weights");
               }
-              fitter->SetInitialGaussianMean(fMassD);
-              fitter->SetInitialGaussianSigma(fSigmaGausMC);
+              // start from the adjacent fit range already done: previous upper limit with the
+              // same lower limit, otherwise previous lower limit with the same upper limit
+              Int_t iWarm=-1;
+              if(fUseWarmStart){
+                Int_t iWarmUp=theCase*nRanges+iRange-1;
+                Int_t iWarmLow=theCase*nRanges+iRange-fNumOfUpLimFitSteps;
+                if(iMaxMass>0 && warmOK[iWarmUp]) iWarm=iWarmUp;
+                else if(iMinMass>0 && warmOK[iWarmLow]) iWarm=iWarmLow;
+              }
+              if(iWarm>=0){
+                fitter->SetInitialGaussianMean(warmMean[iWarm]);
+                fitter->SetInitialGaussianSigma(warmSigma[iWarm]);
+              }else{
+                fitter->SetInitialGaussianMean(fMassD);
+                fitter->SetInitialGaussianSigma(fSigmaGausMC);
+              }
               xnt[0]=rebin;
               xnt[1]=iFirstBin;
               xnt[2]=minMassForFit;
@@ -393,6 +421,10 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
                   fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
                 }
 
+                warmOK[theCase*nRanges+iRange]=kTRUE;
+                warmMean[theCase*nRanges+iRange]=pos;
+                warmSigma[theCase*nRanges+iRange]=sigma;
+
                 if(ry<fMinYieldGlob) fMinYieldGlob=ry;
                 if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
                 fHistoRawYieldDist[theCase]->Fill(ry);
@@ -2,9 +2,11 @@
 
 #include <TClonesArray.h>
 #include <TMath.h>
+#include <TObjArray.h>
 
 #include "AliAnalysisManager.h"
 #include "AliEmcalJet.h"
+#include "AliEmcalJetBkgTable.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
 #include "AliJetContainer.h"
@@ -18,7 +20,13 @@ ClassImp(AliAnalysisTaskRho)
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho() : 
   AliAnalysisTaskRhoBase("AliAnalysisTaskRho"),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fOutRhoMassName(),
+  fNEtaBins(0),
+  fEtaMin(-0.9),
+  fEtaMax(0.9),
+  fOutRhoMass(0),
+  fOutRhoEta(0)
 {
   // Constructor.
 }
@@ -26,83 +34,89 @@ AliAnalysisTaskRho::AliAnalysisTaskRho() :
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho(const char *name, Bool_t histo) :
   AliAnalysisTaskRhoBase(name, histo),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fOutRhoMassName(),
+  fNEtaBins(0),
+  fEtaMin(-0.9),
+  fEtaMax(0.9),
+  fOutRhoMass(0),
+  fOutRhoEta(0)
 {
   // Constructor.
 }
 
-
 //________________________________________________________________________
-Bool_t AliAnalysisTaskRho::Run() 
+AliAnalysisTaskRho::~AliAnalysisTaskRho()
 {
-  // Run the analysis.
+  // Destructor. Rho objects attached to the event are owned by the event.
 
-  fOutRho->SetVal(0);
-  if (fOutRhoScaled)
-    fOutRhoScaled->SetVal(0);
+  if (!fAttachToEvent) {
+    delete fOutRhoMass;
+    if (fOutRhoEta)
+      fOutRhoEta->Delete();
+  }
+  delete fOutRhoEta;
+}
 
-  if (!fJets)
-    return kFALSE;
+//________________________________________________________________________
+void AliAnalysisTaskRho::ExecOnce()
+{
+  // Init the analysis.
 
-  const Int_t Njets   = fJets->GetEntries();
-
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
+  if (!fOutRhoMassName.IsNull() && !fOutRhoMass) {
+    fOutRhoMass = new AliRhoParameter(fOutRhoMassName, 0);
+
+    if (fAttachToEvent) {
+      if (!(InputEvent()->FindListObject(fOutRhoMassName))) {
+        InputEvent()->AddObject(fOutRhoMass);
+      } else {
+        AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), fOutRhoMassName.Data()));
+        return;
       }
     }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
-
-  // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
-
-    // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
-      continue;
+  if (fNEtaBins > 0 && !fOutRhoEta) {
+    fOutRhoEta = new TObjArray(fNEtaBins);
+    for (Int_t i = 0; i < fNEtaBins; i++) {
+      TString name(Form("%s_Eta%d", fOutRhoName.Data(), i));
+      AliRhoParameter *rhoEta = new AliRhoParameter(name, 0);
+      fOutRhoEta->AddAt(rhoEta, i);
+
+      if (fAttachToEvent) {
+        if (!(InputEvent()->FindListObject(name))) {
+          InputEvent()->AddObject(rhoEta);
+        } else {
+          AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), name.Data()));
+          return;
+        }
+      }
+    }
+  }
 
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
+  AliAnalysisTaskRhoBase::ExecOnce();
+}
 
-    if (!AcceptJet(jet))
-      continue;
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRho::Run() 
+{
+  // Run the analysis.
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
-  }
+  fOutRho->SetVal(0);
+  if (fOutRhoScaled)
+    fOutRhoScaled->SetVal(0);
+  if (fOutRhoMass)
+    fOutRhoMass->SetVal(0);
+  for (Int_t i = 0; i < fNEtaBins && fOutRhoEta; i++)
+    static_cast<AliRhoParameter*>(fOutRhoEta->At(i))->SetVal(0);
 
+  AliEmcalJetBkgTable *table = GetBkgTable();
+  if (!table)
+    return kFALSE;
 
-  if (NjetAcc > 0) {
+  if (table->GetNAccepted(fBkgJetFlags, fNExclLeadJets, kFALSE, kFALSE) > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = table->GetRho(fBkgJetFlags, fNExclLeadJets, kFALSE, kFALSE);
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
@@ -111,9 +125,50 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
+  if (fOutRhoMass) {
+    if (!table->HasMd(fTracks))
+      FillBkgTableMd(table);
+    fOutRhoMass->SetVal(table->GetRhoMass(fBkgJetFlags, fNExclLeadJets, kFALSE, kFALSE));
+  }
+
+  if (fOutRhoEta) {
+    Double_t etaWidth = (fEtaMax - fEtaMin) / fNEtaBins;
+    for (Int_t i = 0; i < fNEtaBins; i++) {
+      Double_t etaMin = fEtaMin + i * etaWidth;
+      Double_t rhoEta = table->GetRho(fBkgJetFlags, fNExclLeadJets, kFALSE, kFALSE, etaMin, etaMin + etaWidth);
+      static_cast<AliRhoParameter*>(fOutRhoEta->At(i))->SetVal(rhoEta);
+    }
+  }
+
   return kTRUE;
 } 
 
+//________________________________________________________________________
+void AliAnalysisTaskRho::FillBkgTableMd(AliEmcalJetBkgTable *table)
+{
+  // Fill md of all jets as defined in http://arxiv.org/pdf/1211.2811.pdf
+  // (AliAnalysisTaskRhoMass::kMd). Clusters are massless and do not contribute.
+  // The table may be shared with tasks with a different jet selection,
+  // the column is tagged with the track array it was filled from.
+
+  for (Int_t i = 0; i < table->GetNEntries(); i++) {
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(table->GetJetIndex(i)));
+
+    Double_t md = 0.;
+    if (fTracks) {
+      for (Int_t icc = 0; icc < jet->GetNumberOfTracks(); icc++) {
+        AliVParticle *vp = static_cast<AliVParticle*>(jet->TrackAt(icc, fTracks));
+        if (!vp)
+          continue;
+        md += TMath::Sqrt(vp->M()*vp->M() + vp->Pt()*vp->Pt()) - vp->Pt();
+      }
+    }
+    table->SetMd(i, md);
+  }
+
+  table->MarkMdFilled(fTracks);
+}
+
 //________________________________________________________________________
 AliAnalysisTaskRho* AliAnalysisTaskRho::AddTaskRhoNew (
     const char* nTracks, const char* nClusters, const char* nRho,
@@ -29,6 +29,8 @@
 
 #include "AliAnalysisTaskRhoBase.h"
 
+class TObjArray;
+
 /**
  * @class
  * @brief Calculation of rho from a collection of jets.
@@ -39,15 +41,21 @@
  * 
  * If scale function is given the scaled rho will be exported
  * with the name as "fOutRhoName".Apppend("_Scaled").
+ *
+ * From the same pass over the kt jets the task can in addition export
+ * rho_m (md/area, see AliAnalysisTaskRhoMass) and an eta-dependent rho
+ * with the name "fOutRhoName".Append("_Eta<i>") for each eta bin.
  */
 class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
 
  public:
   AliAnalysisTaskRho();
   AliAnalysisTaskRho(const char *name, Bool_t histo=kFALSE);
-  virtual ~AliAnalysisTaskRho() {}
+  virtual ~AliAnalysisTaskRho();
 
   void             SetExcludeLeadJets(UInt_t n)    { fNExclLeadJets = n    ; }
+  void             SetOutRhoMassName(const char *n){ fOutRhoMassName = n  ; }
+  void             SetEtaBins(Int_t n, Double_t min, Double_t max) { fNEtaBins = n; fEtaMin = min; fEtaMax = max; }
 
   static AliAnalysisTaskRho* AddTaskRhoNew (
     const char    *nTracks                        = "usedefault",
@@ -62,13 +70,22 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
 );
 
  protected:
+  void             ExecOnce();
   Bool_t           Run();
+  void             FillBkgTableMd(AliEmcalJetBkgTable *table);
 
   UInt_t           fNExclLeadJets;                 ///< number of leading jets to be excluded from the median calculation
+  TString          fOutRhoMassName;                ///< name of output rho_m object (not exported if empty)
+  Int_t            fNEtaBins;                      ///< number of eta bins for the eta-dependent rho (not exported if 0)
+  Double_t         fEtaMin;                        ///< lower edge of the eta-dependent rho binning
+  Double_t         fEtaMax;                        ///< upper edge of the eta-dependent rho binning
+
+  AliRhoParameter *fOutRhoMass;                    //!<! output rho_m object
+  TObjArray       *fOutRhoEta;                     //!<! output eta-dependent rho objects
 
   AliAnalysisTaskRho(const AliAnalysisTaskRho&);             // not implemented
   AliAnalysisTaskRho& operator=(const AliAnalysisTaskRho&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRho, 10); // Rho task
+  ClassDef(AliAnalysisTaskRho, 11); // Rho task
 };
 #endif
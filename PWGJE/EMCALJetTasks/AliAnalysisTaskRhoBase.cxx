@@ -32,6 +32,8 @@
 #include <TClonesArray.h>
 #include <TGrid.h>
 
+#include "AliAnalysisManager.h"
+#include "AliEmcalJetBkgTable.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
 #include "AliEmcalJet.h"
@@ -54,10 +56,13 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase() :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fBkgTableName(),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fBkgTable(0),
+  fBkgJetFlags(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -96,10 +101,13 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fBkgTableName(),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fBkgTable(0),
+  fBkgJetFlags(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -128,6 +136,12 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   SetMakeGeneralHistograms(histo);
 }
 
+AliAnalysisTaskRhoBase::~AliAnalysisTaskRhoBase()
+{
+  // A shared table is owned by the event
+  if (fBkgTableName.IsNull()) delete fBkgTable;
+}
+
 void AliAnalysisTaskRhoBase::UserCreateOutputObjects()
 {
   if (!fCreateHisto)
@@ -446,6 +460,53 @@ void AliAnalysisTaskRhoBase::ExecOnce()
   AliAnalysisTaskEmcalJet::ExecOnce();
 }
 
+AliEmcalJetBkgTable* AliAnalysisTaskRhoBase::GetBkgTable()
+{
+  if (!fJets)
+    return 0;
+
+  if (!fBkgTable) {
+    if (fBkgTableName.IsNull()) {
+      fBkgTable = new AliEmcalJetBkgTable(Form("%s_BkgTable", GetName()));
+    }
+    else {
+      fBkgTable = dynamic_cast<AliEmcalJetBkgTable*>(InputEvent()->FindListObject(fBkgTableName));
+      if (!fBkgTable) {
+        fBkgTable = new AliEmcalJetBkgTable(fBkgTableName);
+        InputEvent()->AddObject(fBkgTable);
+      }
+    }
+  }
+
+  Long64_t stamp = AliAnalysisManager::GetAnalysisManager()->GetCurrentEntry();
+  if (!fBkgTable->IsValid(fJets, stamp)) {
+    fBkgTable->Reset(fJets, stamp);
+
+    const Int_t Njets = fJets->GetEntries();
+    for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
+      if (!jet) {
+        AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
+        continue;
+      }
+      fBkgTable->AddJet(jet, iJets);
+    }
+
+    fBkgTable->Finalize();
+  }
+
+  // The jet selection is specific to this task, also for a shared table
+  fBkgJetFlags.assign(fBkgTable->GetNEntries(), 0);
+  for (Int_t i = 0; i < fBkgTable->GetNEntries(); i++) {
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(fBkgTable->GetJetIndex(i)));
+    if (AcceptJet(jet))
+      fBkgJetFlags[i] |= AliEmcalJetBkgTable::kAccepted;
+  }
+  fBkgTable->FlagLeadingJets(fBkgJetFlags);
+
+  return fBkgTable;
+}
+
 Double_t AliAnalysisTaskRhoBase::GetRhoFactor(Double_t cent)
 {
   Double_t rho = 0;
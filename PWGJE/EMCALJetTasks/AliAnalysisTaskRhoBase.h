@@ -33,6 +33,9 @@ class TH1F;
 class TH2F;
 class TH3F;
 class AliRhoParameter;
+class AliEmcalJetBkgTable;
+
+#include <vector>
 
 #include "AliAnalysisTaskEmcalJet.h"
 
@@ -62,7 +65,7 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   /**
    * @brief Destructor
    */
-  virtual ~AliAnalysisTaskRhoBase() {}
+  virtual ~AliAnalysisTaskRhoBase();
 
   /**
    * @brief User create output objects, called at the beginning of the analysis.
@@ -85,6 +88,16 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   void                   SetInEventSigmaRho(Double_t s)                        { fInEventSigmaRho      = s       ;                   }
   void                   SetAttachToEvent(Bool_t a)                            { fAttachToEvent        = a       ;                   }
   void                   SetSmallSystem(Bool_t setter = kTRUE)                 { fIsPbPb               = !setter ;                   }
+  /**
+   * @brief Share the per-event kt-jet background table with other rho tasks.
+   *
+   * Rho tasks with the same table name reuse the jet kinematics filled by
+   * the first task in the event instead of reading the jets again. They must
+   * run on the same kt jet collection, while the jet selection and the signal
+   * jets are applied by each task separately.
+   * @param name Name of the table in the event object list
+   */
+  void                   SetBkgTableName(const char *name)                     { fBkgTableName         = name    ;                   }
 
   const char*            GetOutRhoName() const                                 { return fOutRhoName.Data()       ;                   }
   const char*            GetOutRhoScaledName() const                           { return fOutRhoScaledName.Data() ;                   }
@@ -120,6 +133,16 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
    */
   virtual Double_t       GetScaleFactor(Double_t cent);
 
+  /**
+   * @brief Get the kt-jet background table for the current event.
+   *
+   * The table is filled from the first jet container if it was not
+   * yet filled for this event (by this or another rho task). The jet
+   * selection flags of this task (fBkgJetFlags) are updated at each call.
+   * @return Background table, 0 if no jets are available
+   */
+  AliEmcalJetBkgTable   *GetBkgTable();
+
   TString                fOutRhoName;                    ///< name of output rho object
   TString                fOutRhoScaledName;              ///< name of output scaled rho object
   TString                fCompareRhoName;                ///< name of rho object to compare
@@ -129,11 +152,14 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   Double_t               fInEventSigmaRho;               ///< in-event sigma rho
   Bool_t                 fAttachToEvent;                 ///< whether or not attach rho to the event objects list
   Bool_t                 fIsPbPb;                        ///< different histogram ranges for pp/pPb and PbPb
+  TString                fBkgTableName;                  ///< name of the background table shared in the event (private table if empty)
   
   AliRhoParameter       *fOutRho;                        //!<! output rho object
   AliRhoParameter       *fOutRhoScaled;                  //!<! output scaled rho object
   AliRhoParameter       *fCompareRho;                    //!<! rho object to compare
   AliRhoParameter       *fCompareRhoScaled;              //!<! scaled rho object to compare
+  AliEmcalJetBkgTable   *fBkgTable;                      //!<! per-event kt-jet background table
+  std::vector<UInt_t>    fBkgJetFlags;                   //!<! jet selection flags of this task for each entry of the background table
 
   TH2F                  *fHistJetPtvsCent;               //!<! jet pt vs. centrality
   TH2F                  *fHistJetAreavsCent;             //!<! jet area vs. centrality
@@ -161,6 +187,6 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRhoBase(const AliAnalysisTaskRhoBase&);             // not implemented
   AliAnalysisTaskRhoBase& operator=(const AliAnalysisTaskRhoBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoBase, 11); // Rho base task
+  ClassDef(AliAnalysisTaskRhoBase, 12); // Rho base task
 };
 #endif
@@ -8,12 +8,15 @@
 
 #include "AliAnalysisTaskRhoSparse.h"
 
+#include <vector>
+
 #include <TClonesArray.h>
 #include <TMath.h>
 
 #include "AliAnalysisManager.h"
 #include <AliVEventHandler.h>
 #include "AliEmcalJet.h"
+#include "AliEmcalJetBkgTable.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
 #include "AliJetContainer.h"
@@ -83,147 +86,32 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
 
-  if (!fJets)
+  AliEmcalJetBkgTable *table = GetBkgTable();
+  if (!table)
     return kFALSE;
-  const Int_t Njets = fJets->GetEntries();
 
   AliJetContainer *sigjets = static_cast<AliJetContainer*>(fJetCollArray.At(1));
-  Int_t NjetsSig = 0;
-  if (sigjets) NjetsSig = sigjets->GetNJets();
-
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-        AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-        continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      //Search the two leading KT jets
-      if (jet->Pt() > maxJetPts[0]) {
-        maxJetPts[1] = maxJetPts[0];
-        maxJetIds[1] = maxJetIds[0];
-        maxJetPts[0] = jet->Pt();
-        maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-        maxJetPts[1] = jet->Pt();
-        maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
-  }
-
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
-  Double_t TotaljetAreaPhys=0;
-  Double_t TotalAreaCovered=0;
-  Double_t TotalTPCArea=2*TMath::Pi()*0.9;
-
-  // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
-
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
-
-    // Take into account the area of real jets (no pure ghost jets)
-    // and also the area of later excluded jets.
-    // Some of these jets do not contribute to the rho calculation
-    // but to the factor with which this rho is scaled down
-    if (fExcludeAreaExcludedJets==0)
-    {
-      // Total area of physical jets that are used for the rho calculation
-      if(jet->GetNumberOfTracks()>0)
-      {
-       TotaljetAreaPhys+=jet->Area();
-      }
-      // Total area of all found jets ghost+phyical jets. This is a proxy
-      // for the available detector area in which the rho could have been calculated
-      TotalAreaCovered+=jet->Area();
-    }
-    // Exclude leading background jets (could be signal)
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
-      continue;
-    // Exclude background jets that do not fullfill basic cuts defined in AliJetContainer
-    if (!AcceptJet(jet))
-      continue;
-
-    // Search for overlap with signal jets
-    Bool_t isOverlapping = kFALSE;
-    if (sigjets) {
-      for(Int_t j=0;j<NjetsSig;j++)
-      {
-        AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
-        if(!signalJet)
-          continue;
-        if(!IsJetSignal(signalJet))
-          continue;
-
-        if(IsJetOverlapping(signalJet, jet))
-        {
-          isOverlapping = kTRUE;
-          break;
-        }
-      }
-    }
-    // Exclude background jets that overlap with anti-kT signal jets
-    if(fExcludeOverlaps && isOverlapping)
-      continue;
-
-    // Take into account only real jets (no pure ghost jets) that also
-    // contribute to the rho calculation
-    if (fExcludeAreaExcludedJets==1)
-    {
-      // Total area of physical jets that are used for the rho calculation
-      if(jet->GetNumberOfTracks()>0)
-      {
-       TotaljetAreaPhys+=jet->Area();
-      }
-      // Total area of all found jets ghost+phyical jets. This is a proxy
-      // for the available detector area in which the rho could have been calculated
-      TotalAreaCovered+=jet->Area();
-    }
 
-    // Exclude pure ghost jets from the rho calculation.
-    // Use only jets that fulfill your background jet selection
-    // for the rho calculation.
-    // Eg. real signal jets should not bias the background rho
-    if(jet->GetNumberOfTracks()>0)
-    {
-      rhovec[NjetAcc] = jet->Pt() / jet->Area();
-      ++NjetAcc;
-    }
-  }
+  // Search for overlap with signal jets
+  if (sigjets)
+    FlagBkgJetOverlaps(table, sigjets);
+  Bool_t excludeOverlaps = fExcludeOverlaps && sigjets;
 
-  Double_t OccCorr=1;
-  //Use the total TPC area in which rho is calculated as denominater
-  if(fUseTPCArea)
-  {
-    OccCorr = TotaljetAreaPhys/TotalTPCArea;
-  }
-  //Use the total area covered by all ghost+physical jets that pass the selection in the detector as denominator
-  else if (TotalAreaCovered>0)
-  {
-    OccCorr = TotaljetAreaPhys/TotalAreaCovered;
-  }
+  // Take into account the area of real jets (no pure ghost jets) and the area
+  // covered by all jets, either for all jets or only for the jets used for rho
+  Double_t TotalTPCArea=2*TMath::Pi()*0.9;
+  Double_t OccCorr = table->GetOccupancy(fBkgJetFlags, fNExclLeadJets, excludeOverlaps, fUseTPCArea, fExcludeAreaExcludedJets, TotalTPCArea);
 
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
-  if (NjetAcc > 0) {
+  // Exclude pure ghost jets from the rho calculation.
+  // Use only jets that fulfill your background jet selection
+  // for the rho calculation.
+  // Eg. real signal jets should not bias the background rho
+  if (table->GetNAccepted(fBkgJetFlags, fNExclLeadJets, kTRUE, excludeOverlaps) > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = table->GetRho(fBkgJetFlags, fNExclLeadJets, kTRUE, excludeOverlaps);
 
     if(fRhoCMS){
       rho = rho * OccCorr;
@@ -240,6 +128,36 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   return kTRUE;
 } 
 
+void AliAnalysisTaskRhoSparse::FlagBkgJetOverlaps(AliEmcalJetBkgTable *table, AliJetContainer *sigjets)
+{
+  std::vector<AliEmcalJet*> signalJets;
+  Int_t NjetsSig = sigjets->GetNJets();
+  for (Int_t j = 0; j < NjetsSig; j++) {
+    AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
+    if (!signalJet)
+      continue;
+    if (!IsJetSignal(signalJet))
+      continue;
+    signalJets.push_back(signalJet);
+  }
+
+  for (Int_t i = 0; i < table->GetNEntries(); i++) {
+    if (!(fBkgJetFlags[i] & AliEmcalJetBkgTable::kAccepted))
+      continue;
+
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(table->GetJetIndex(i)));
+    Bool_t isOverlapping = kFALSE;
+    for (std::vector<AliEmcalJet*>::iterator it = signalJets.begin(); it != signalJets.end(); ++it) {
+      if (IsJetOverlapping(*it, jet)) {
+        isOverlapping = kTRUE;
+        break;
+      }
+    }
+    if (isOverlapping)
+      fBkgJetFlags[i] |= AliEmcalJetBkgTable::kOverlap;
+  }
+}
+
 AliAnalysisTaskRhoSparse* AliAnalysisTaskRhoSparse::AddTaskRhoSparse(
     const char    *nTracks,
     const char    *nClusters,
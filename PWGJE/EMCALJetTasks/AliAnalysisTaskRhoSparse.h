@@ -113,6 +113,13 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
    */
   Bool_t           Run();
 
+  /**
+   * @brief Flag the accepted background jets overlapping with signal jets (in fBkgJetFlags)
+   * @param table Background table of the current event
+   * @param sigjets Signal jet container
+   */
+  void             FlagBkgJetOverlaps(AliEmcalJetBkgTable *table, AliJetContainer *sigjets);
+
   UInt_t           fNExclLeadJets;                                    ///< number of leading jets to be excluded from the median calculation
   Bool_t           fExcludeOverlaps;                                  ///< exclude background jets that overlap (share at least one track) with anti-KT signal jets
   Bool_t           fRhoCMS;                                           ///< flag to run CMS method
@@ -0,0 +1,289 @@
+/**********************************************************************************
+ * Copyright (C) 2016, Copyright Holders of the ALICE Collaboration                *
+ * All rights reserved.                                                            *
+ *                                                                                 *
+ * Redistribution and use in source and binary forms, with or without              *
+ * modification, are permitted provided that the following conditions are met:     *
+ *   * Redistributions of source code must retain the above copyright              *
+ *     notice, this list of conditions and the following disclaimer.               *
+ *   * Redistributions in binary form must reproduce the above copyright           *
+ *     notice, this list of conditions and the following disclaimer in the         *
+ *     documentation and/or other materials provided with the distribution.        *
+ *   * Neither the name of the <organization> nor the                              *
+ *     names of its contributors may be used to endorse or promote products        *
+ *     derived from this software without specific prior written permission.       *
+ *                                                                                 *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED   *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY             *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES      *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;    *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND     *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT      *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS   *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                    *
+ * *********************************************************************************/
+#include <algorithm>
+
+#include <TClonesArray.h>
+
+#include "AliEmcalJet.h"
+#include "AliEmcalJetBkgTable.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalJetBkgTable)
+/// \endcond
+
+AliEmcalJetBkgTable::AliEmcalJetBkgTable() :
+  TNamed(),
+  fJetArray(0),
+  fStamp(-1),
+  fFilled(kFALSE),
+  fHasMd(kFALSE),
+  fMdTracks(0),
+  fIndex(),
+  fGhost(),
+  fPt(),
+  fArea(),
+  fEta(),
+  fRhoPt(),
+  fRhoM(),
+  fWork()
+{
+}
+
+AliEmcalJetBkgTable::AliEmcalJetBkgTable(const char* name) :
+  TNamed(name, name),
+  fJetArray(0),
+  fStamp(-1),
+  fFilled(kFALSE),
+  fHasMd(kFALSE),
+  fMdTracks(0),
+  fIndex(),
+  fGhost(),
+  fPt(),
+  fArea(),
+  fEta(),
+  fRhoPt(),
+  fRhoM(),
+  fWork()
+{
+}
+
+/**
+ * Clear the table and bind it to a jet array and event stamp.
+ * Memory of the columns is kept across events.
+ * @param jets Jet array the table is going to be filled from
+ * @param stamp Event stamp (current entry of the analysis manager)
+ */
+void AliEmcalJetBkgTable::Reset(const TClonesArray* jets, Long64_t stamp)
+{
+  fJetArray = jets;
+  fStamp = stamp;
+  fFilled = kFALSE;
+  fHasMd = kFALSE;
+  fMdTracks = 0;
+
+  fIndex.clear();
+  fGhost.clear();
+  fPt.clear();
+  fArea.clear();
+  fEta.clear();
+  fRhoPt.clear();
+  fRhoM.clear();
+
+  Int_t n = jets ? jets->GetEntriesFast() : 0;
+  fIndex.reserve(n);
+  fGhost.reserve(n);
+  fPt.reserve(n);
+  fArea.reserve(n);
+  fEta.reserve(n);
+  fRhoPt.reserve(n);
+  fRhoM.reserve(n);
+}
+
+/**
+ * Add a jet to the table. Jets must be added in the order of the jet array.
+ * pt/area is stored as is, i.e. it is infinite for a jet with vanishing
+ * area, as in the median calculation of the rho tasks.
+ * @param jet Jet to be added
+ * @param index Index of the jet in the jet array
+ */
+void AliEmcalJetBkgTable::AddJet(const AliEmcalJet* jet, Int_t index)
+{
+  fIndex.push_back(index);
+  fGhost.push_back(jet->GetNumberOfTracks() == 0);
+  fPt.push_back(jet->Pt());
+  fArea.push_back(jet->Area());
+  fEta.push_back(jet->Eta());
+  fRhoPt.push_back(jet->Pt() / jet->Area());
+  fRhoM.push_back(0.);
+}
+
+/**
+ * Store md for a table entry (only used for the rho_m flavour).
+ * @param entry Table entry
+ * @param md md of the jet as defined in http://arxiv.org/pdf/1211.2811.pdf
+ */
+void AliEmcalJetBkgTable::SetMd(Int_t entry, Double_t md)
+{
+  fRhoM[entry] = fArea[entry] > 0 ? md / fArea[entry] : 0.;
+}
+
+/**
+ * Search the two leading accepted jets and flag them.
+ * @param flags Jet selection flags of a rho task, kAccepted must be set
+ */
+void AliEmcalJetBkgTable::FlagLeadingJets(std::vector<UInt_t>& flags) const
+{
+  Double_t maxJetPts[] = { 0, 0 };
+  Int_t leadEntries[] = { -1, -1 };
+
+  for (UInt_t i = 0; i < fIndex.size(); i++) {
+    flags[i] &= ~(kLeading | kSubLeading);
+    if (!(flags[i] & kAccepted)) continue;
+
+    if (fPt[i] > maxJetPts[0]) {
+      maxJetPts[1] = maxJetPts[0];
+      leadEntries[1] = leadEntries[0];
+      maxJetPts[0] = fPt[i];
+      leadEntries[0] = i;
+    }
+    else if (fPt[i] > maxJetPts[1]) {
+      maxJetPts[1] = fPt[i];
+      leadEntries[1] = i;
+    }
+  }
+
+  if (leadEntries[0] >= 0) flags[leadEntries[0]] |= kLeading;
+  if (leadEntries[1] >= 0) flags[leadEntries[1]] |= kSubLeading;
+}
+
+/**
+ * Check whether an entry is excluded from the background estimation.
+ * @param flags Jet selection flags of the rho task
+ * @param entry Table entry
+ * @param nExclLead Number of leading jets to be excluded (0, 1 or 2)
+ * @param excludeGhosts Exclude pure ghost jets
+ * @param excludeOverlaps Exclude jets overlapping with signal jets
+ * @return True if the entry does not contribute to the background estimation
+ */
+Bool_t AliEmcalJetBkgTable::IsExcluded(const std::vector<UInt_t>& flags, Int_t entry, UInt_t nExclLead,
+                                       Bool_t excludeGhosts, Bool_t excludeOverlaps) const
+{
+  UInt_t f = flags[entry];
+  if (!(f & kAccepted)) return kTRUE;
+  if (nExclLead > 0 && (f & kLeading)) return kTRUE;
+  if (nExclLead > 1 && (f & kSubLeading)) return kTRUE;
+  if (excludeGhosts && fGhost[entry]) return kTRUE;
+  if (excludeOverlaps && (f & kOverlap)) return kTRUE;
+  return kFALSE;
+}
+
+/**
+ * Number of jets contributing to the background estimation.
+ */
+Int_t AliEmcalJetBkgTable::GetNAccepted(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                                        Bool_t excludeOverlaps, Double_t etaMin, Double_t etaMax) const
+{
+  Int_t n = 0;
+  for (UInt_t i = 0; i < fIndex.size(); i++) {
+    if (IsExcluded(flags, i, nExclLead, excludeGhosts, excludeOverlaps)) continue;
+    if (fEta[i] < etaMin || fEta[i] >= etaMax) continue;
+    n++;
+  }
+  return n;
+}
+
+/**
+ * Median of pt/area of the jets contributing to the background estimation.
+ * @return rho, or 0 if no jet contributes
+ */
+Double_t AliEmcalJetBkgTable::GetRho(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                                     Bool_t excludeOverlaps, Double_t etaMin, Double_t etaMax) const
+{
+  return MedianOf(fRhoPt, flags, nExclLead, excludeGhosts, excludeOverlaps, etaMin, etaMax, kFALSE);
+}
+
+/**
+ * Median of md/area of the jets contributing to the background estimation.
+ * Jets with vanishing area are ignored, consistent with AliAnalysisTaskRhoMass.
+ * @return rho_m, or 0 if no jet contributes or md was not filled
+ */
+Double_t AliEmcalJetBkgTable::GetRhoMass(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                                         Bool_t excludeOverlaps, Double_t etaMin, Double_t etaMax) const
+{
+  if (!fHasMd) return 0.;
+  return MedianOf(fRhoM, flags, nExclLead, excludeGhosts, excludeOverlaps, etaMin, etaMax, kTRUE);
+}
+
+/**
+ * Occupancy correction for sparse systems (CMS method).
+ * @param flags Jet selection flags of the rho task
+ * @param nExclLead Number of leading jets to be excluded
+ * @param excludeOverlaps Exclude jets overlapping with signal jets
+ * @param useTPCArea Use the full TPC area as denominator
+ * @param excludeAreaExcludedJets Only jets contributing to rho enter the area sums
+ * @param tpcArea Full TPC area
+ * @return Ratio of the area of physical jets over the covered area
+ */
+Double_t AliEmcalJetBkgTable::GetOccupancy(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeOverlaps,
+                                           Bool_t useTPCArea, Bool_t excludeAreaExcludedJets, Double_t tpcArea) const
+{
+  Double_t totalJetAreaPhys = 0;
+  Double_t totalAreaCovered = 0;
+
+  for (UInt_t i = 0; i < fIndex.size(); i++) {
+    if (excludeAreaExcludedJets && IsExcluded(flags, i, nExclLead, kFALSE, excludeOverlaps)) continue;
+    if (!fGhost[i]) totalJetAreaPhys += fArea[i];
+    totalAreaCovered += fArea[i];
+  }
+
+  Double_t occCorr = 1;
+  if (useTPCArea) {
+    occCorr = totalJetAreaPhys / tpcArea;
+  }
+  else if (totalAreaCovered > 0) {
+    occCorr = totalJetAreaPhys / totalAreaCovered;
+  }
+  return occCorr;
+}
+
+/**
+ * Median with the same convention as TMath::Median (mean of the two central
+ * values for an even number of entries), using a partial selection instead
+ * of a full sort. The content of the vector is reordered.
+ * @param v Input values
+ * @return Median of the values, 0 if empty
+ */
+Double_t AliEmcalJetBkgTable::Median(std::vector<Double_t>& v)
+{
+  if (v.empty()) return 0.;
+
+  std::vector<Double_t>::size_type half = v.size() / 2;
+  std::nth_element(v.begin(), v.begin() + half, v.end());
+  Double_t upper = v[half];
+  if (v.size() % 2) return upper;
+
+  Double_t lower = *std::max_element(v.begin(), v.begin() + half);
+  return 0.5 * (lower + upper);
+}
+
+/**
+ * Median of a column over the entries contributing to the background estimation.
+ * @param excludeZeroArea Ignore jets with vanishing area
+ */
+Double_t AliEmcalJetBkgTable::MedianOf(const std::vector<Double_t>& values, const std::vector<UInt_t>& flags, UInt_t nExclLead,
+                                       Bool_t excludeGhosts, Bool_t excludeOverlaps, Double_t etaMin, Double_t etaMax,
+                                       Bool_t excludeZeroArea) const
+{
+  fWork.clear();
+  for (UInt_t i = 0; i < fIndex.size(); i++) {
+    if (IsExcluded(flags, i, nExclLead, excludeGhosts, excludeOverlaps)) continue;
+    if (fEta[i] < etaMin || fEta[i] >= etaMax) continue;
+    if (excludeZeroArea && !(fArea[i] > 0)) continue;
+    fWork.push_back(values[i]);
+  }
+  return Median(fWork);
+}
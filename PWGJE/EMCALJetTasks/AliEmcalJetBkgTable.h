@@ -0,0 +1,129 @@
+/**********************************************************************************
+ * Copyright (C) 2016, Copyright Holders of the ALICE Collaboration                *
+ * All rights reserved.                                                            *
+ *                                                                                 *
+ * Redistribution and use in source and binary forms, with or without              *
+ * modification, are permitted provided that the following conditions are met:     *
+ *   * Redistributions of source code must retain the above copyright              *
+ *     notice, this list of conditions and the following disclaimer.               *
+ *   * Redistributions in binary form must reproduce the above copyright           *
+ *     notice, this list of conditions and the following disclaimer in the         *
+ *     documentation and/or other materials provided with the distribution.        *
+ *   * Neither the name of the <organization> nor the                              *
+ *     names of its contributors may be used to endorse or promote products        *
+ *     derived from this software without specific prior written permission.       *
+ *                                                                                 *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED   *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY             *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES      *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;    *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND     *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT      *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS   *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                    *
+ * *********************************************************************************/
+#ifndef ALIEMCALJETBKGTABLE_H
+#define ALIEMCALJETBKGTABLE_H
+
+#include <vector>
+#include <TNamed.h>
+
+class TClonesArray;
+class AliEmcalJet;
+
+/**
+ * @class AliEmcalJetBkgTable
+ * @brief Per-event table of kt-jet quantities used for the background density estimation.
+ * @ingroup PWGJEBASE
+ *
+ * The table stores, for every jet of a kt jet collection, pt/area, md/area,
+ * eta, area and whether it is a pure ghost jet. It is filled once per event
+ * and then queried by the rho tasks for the different background flavours
+ * (rho, rho_m, eta-dependent rho and the occupancy correction for sparse
+ * systems). Medians are obtained with a selection algorithm instead of a
+ * full sort.
+ *
+ * The jet selection is not part of the table: each rho task keeps its own
+ * flags (accepted, leading, overlapping with a signal jet) with one entry
+ * per table entry and passes them to the queries. If the table is attached
+ * to the event (see AliAnalysisTaskRhoBase::SetBkgTableName) several rho
+ * tasks running on the same kt jet collection share the jet kinematics,
+ * even if their jet cuts or signal jets differ. The md/area column depends
+ * on the track array and is refilled when a task with different tracks
+ * queries it.
+ */
+class AliEmcalJetBkgTable : public TNamed {
+ public:
+  /**
+   * @enum EJetFlag_t
+   * @brief Flags of the jet selection of a rho task, one entry per table entry
+   */
+  enum EJetFlag_t {
+    kAccepted   = 1<<0,             ///< jet passes the jet container selection
+    kOverlap    = 1<<1,             ///< jet overlaps with a signal jet
+    kLeading    = 1<<2,             ///< leading accepted jet
+    kSubLeading = 1<<3              ///< sub-leading accepted jet
+  };
+
+  AliEmcalJetBkgTable();
+  AliEmcalJetBkgTable(const char* name);
+  virtual ~AliEmcalJetBkgTable() {}
+
+  void            Reset(const TClonesArray* jets, Long64_t stamp);
+  void            AddJet(const AliEmcalJet* jet, Int_t index);
+  void            SetMd(Int_t entry, Double_t md);
+  void            Finalize()                                          { fFilled     = kTRUE                                    ; }
+
+  Bool_t          IsValid(const TClonesArray* jets, Long64_t stamp) const { return fFilled && fJetArray == jets && fStamp == stamp; }
+  Bool_t          HasMd(const TClonesArray* tracks) const             { return fHasMd && fMdTracks == tracks                   ; }
+  Int_t           GetNEntries() const                                 { return fIndex.size()                                   ; }
+  Int_t           GetJetIndex(Int_t entry) const                      { return fIndex[entry]                                   ; }
+  Double_t        GetRhoPt(Int_t entry) const                         { return fRhoPt[entry]                                   ; }
+
+  void            MarkMdFilled(const TClonesArray* tracks)            { fHasMd      = kTRUE; fMdTracks = tracks                ; }
+
+  void            FlagLeadingJets(std::vector<UInt_t>& flags) const;
+
+  Bool_t          IsExcluded(const std::vector<UInt_t>& flags, Int_t entry, UInt_t nExclLead,
+                             Bool_t excludeGhosts, Bool_t excludeOverlaps) const;
+  Int_t           GetNAccepted(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                               Bool_t excludeOverlaps, Double_t etaMin=-999, Double_t etaMax=999) const;
+  Double_t        GetRho(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                         Bool_t excludeOverlaps, Double_t etaMin=-999, Double_t etaMax=999) const;
+  Double_t        GetRhoMass(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeGhosts,
+                             Bool_t excludeOverlaps, Double_t etaMin=-999, Double_t etaMax=999) const;
+  Double_t        GetOccupancy(const std::vector<UInt_t>& flags, UInt_t nExclLead, Bool_t excludeOverlaps,
+                               Bool_t useTPCArea, Bool_t excludeAreaExcludedJets, Double_t tpcArea) const;
+
+  static Double_t Median(std::vector<Double_t>& v);
+
+ protected:
+  Double_t        MedianOf(const std::vector<Double_t>& values, const std::vector<UInt_t>& flags, UInt_t nExclLead,
+                           Bool_t excludeGhosts, Bool_t excludeOverlaps, Double_t etaMin, Double_t etaMax,
+                           Bool_t excludeZeroArea) const;
+
+  const TClonesArray   *fJetArray;        //!<! jet array the table was filled from
+  Long64_t              fStamp;           //!<! event stamp (current entry) the table was filled for
+  Bool_t                fFilled;          //!<! table is complete for the current event
+  Bool_t                fHasMd;           //!<! md/area column is filled
+  const TClonesArray   *fMdTracks;        //!<! track array the md/area column was filled from
+  std::vector<Int_t>    fIndex;           //!<! index of the jet in the jet array
+  std::vector<Bool_t>   fGhost;           //!<! pure ghost jet
+  std::vector<Double_t> fPt;              //!<! jet pt
+  std::vector<Double_t> fArea;            //!<! jet area
+  std::vector<Double_t> fEta;             //!<! jet eta
+  std::vector<Double_t> fRhoPt;           //!<! jet pt/area
+  std::vector<Double_t> fRhoM;            //!<! jet md/area
+  mutable std::vector<Double_t> fWork;    //!<! work buffer for the median selection
+
+ private:
+  AliEmcalJetBkgTable(const AliEmcalJetBkgTable&);            // not implemented
+  AliEmcalJetBkgTable& operator=(const AliEmcalJetBkgTable&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetBkgTable, 1); // Per-event kt-jet background table
+  /// \endcond
+};
+#endif
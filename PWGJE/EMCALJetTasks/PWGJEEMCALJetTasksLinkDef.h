@@ -20,6 +20,7 @@
 #pragma link C++ class AliAnalysisTaskRhoTransDev+;
 #pragma link C++ class AliAnalysisTaskDeltaPt+;
 #pragma link C++ class AliAnalysisTaskScale+;
+#pragma link C++ class AliEmcalJetBkgTable+;
 #pragma link C++ class AliEmcalJetByJetCorrection+;
 #pragma link C++ class AliEmcalPicoTrackInGridMaker+;
 #pragma link C++ class AliJetEmbeddingTask+;
@@ -60,7 +60,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fWeightTableStep(0),
+    fRingFits(),
+    fStripBuffer()
 {
   // 
   // Constructor 
@@ -98,7 +101,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fWeightTableStep(0),
+    fRingFits(),
+    fStripBuffer()
 {
   // 
   // Constructor 
@@ -167,7 +173,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fWeightTableStep(o.fWeightTableStep),
+  fRingFits(),
+  fStripBuffer()
 {
   // 
   // Copy constructor 
@@ -232,6 +241,7 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fWeightTableStep    = o.fWeightTableStep;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -343,6 +353,12 @@ AliFMDDensityCalculator::GetMultCut(UShort_t d, Char_t r, Double_t eta,
   // return fCuts.GetMultCut(d,r,eta,errors);
 }
 
+namespace {
+  // Upper edge of the tables of weighted energy loss functions, 
+  // larger signals are evaluated directly 
+  const Double_t kWeightTableMax = 20;
+}
+
 #ifndef NO_TIMING
 # define START_TIMER(T) if (fDoTiming) T.Start(true)
 # define GET_TIMER(T,V) if (fDoTiming) V = T.CpuTime()
@@ -430,6 +446,24 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // --- Ring buffers for the bulk histogram fills ---------------
+      // Strips with a valid signal are stored contiguously, and the 
+      // histograms are filled once per ring 
+      const Int_t nStrips = 20*512;
+      if (Int_t(fStripBuffer.size()) < 5*nStrips) 
+	fStripBuffer.resize(5*nStrips);
+      Double_t* vEta  = &(fStripBuffer[0]);
+      Double_t* vPhi  = vEta  + nStrips;
+      Double_t* vMult = vPhi  + nStrips;
+      Double_t* vN    = vMult + nStrips;
+      Double_t* vC    = vN    + nStrips;
+      Int_t     nValid   = 0;
+      Int_t     nInvalid = 0;
+
+      // --- Energy loss fits of this ring, resolved once per eta bin -
+      RingFitCache& fits = fRingFits[RingIndex(d,r)];
+      ResetRingFitCache(fits);
+      
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
@@ -460,28 +494,14 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  phiCache[s*nt+t] = phi;
 
 	  // --- Check this strip ------------------------------------
-	  rh->fTotal->Fill(eta);
 	  if (mult == AliESDFMD::kInvalidMult) { //  || mult > 20) {
 	    // Do not count invalid stuff 
-	    rh->fELoss->Fill(-1);
-	    // rh->fEvsN->Fill(mult,-1);
-	    // rh->fEvsM->Fill(mult,-1);
+	    nInvalid++;
 	    continue;
 	  }
 	  if (mult > 20) 
 	    AliWarningF("Raw multiplicity of FMD%d%c[%02d,%03d] = %f > 20",
 			d, r, s, t, mult);
-	  // --- Automatic calculation of acceptance -----------------
-	  rh->fGood->Fill(eta);
-
-	  // --- If we asked to re-calculate phi for (x,y) IP --------
-	  // START_TIMER(timer);
-	  // if (fRecalculatePhi) {
-	  // oldPhi = phi;
-	  //  phi = AliForwardUtil::GetPhiFromStrip(r, t, phi, ip.X(), ip.Y());
-	  // }
-	  // phiCache[s*nt+t] = phi;
-	  // ADD_TIMER(timer,rePhiTime);
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
@@ -496,10 +516,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
-	  rh->fELoss->Fill(mult);
-	  // rh->fEvsN->Fill(mult,n);
-	  // rh->fEtaVsN->Fill(eta, n);
+	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux,fits);
 	  ADD_TIMER(timer,nPartTime);
 	  
 	  // --- Calculate correction if needed ----------------------
@@ -510,11 +527,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    c = AcceptanceCorrection(r,t);
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
-	  fCorrections->Fill(c);
 	  if (c > 0) n /= c;
-	  // rh->fEvsM->Fill(mult,n);
-	  // rh->fEtaVsM->Fill(eta, n);
-	  rh->fCorr  ->Fill(eta, c);
 	  
 	  // --- Accumulate Poisson statistics -----------------------
 	  Bool_t hit = (n > fHitThreshold && c > 0);
@@ -529,13 +542,28 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    rh->fSignal->Fill(eta, mult);
 	  }
 	  rh->fPoisson.Fill(t,s,hit,1./c);
-	  h->Fill(eta,phi,n);
 
-	  // --- If we use ELoss fits, apply now ---------------------
-	  if (!fUsePoisson) rh->fDensity->Fill(eta,phi,n);
+	  vEta [nValid] = eta;
+	  vPhi [nValid] = phi;
+	  vMult[nValid] = mult;
+	  vN   [nValid] = n;
+	  vC   [nValid] = c;
+	  nValid++;
 	} // for t
       } // for s 
 
+      // --- Bulk fill of the strip histograms -----------------------
+      // Same content as filling strip by strip
+      rh->fTotal->FillN(ns*nt, etaCache, 0);
+      rh->fGood ->FillN(nValid, vEta, 0);
+      for (Int_t i = 0; i < nInvalid; i++) rh->fELoss->Fill(-1);
+      rh->fELoss->FillN(nValid, vMult, 0);
+      fCorrections->FillN(nValid, vC, 0);
+      rh->fCorr->FillN(nValid, vEta, vC, static_cast<const Double_t*>(0));
+      h->FillN(nValid, vEta, vPhi, vN);
+      // --- If we use ELoss fits, apply now ---------------------
+      if (!fUsePoisson) rh->fDensity->FillN(nValid, vEta, vPhi, vN);
+
       // --- Automatic acceptance - Calculate as an efficiency -------
       // This is very fast, so we do not bother to time it 
       rh->fGood->Divide(rh->fGood, rh->fTotal, 1, 1, "B");
@@ -890,6 +918,151 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   return ret;
 }
 
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::ResetRingFitCache(RingFitCache& cache) const
+{
+  // 
+  // Mark all eta bins of the ring cache as not resolved.  The fits
+  // are looked up again in each event since the energy loss
+  // corrections object may change between runs.
+  // 
+  // Parameters:
+  //    cache   Ring cache
+  //
+  AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  const AliFMDCorrELossFit*     cor = fcm.GetELossFit();
+  Int_t nBins = (cor ? cor->GetEtaAxis().GetNbins() + 2 : 0);
+  
+  cache.fFits.assign(nBins, 0);
+  cache.fMaxN.assign(nBins, -2);
+  if (Int_t(cache.fTables.size()) != nBins) {
+    cache.fTables.clear();
+    cache.fTables.resize(nBins);
+    cache.fTableKeys.clear();
+    cache.fTableKeys.resize(nBins);
+  }
+}
+
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::MakeTableKey(const TObject*         o,
+				      UShort_t               n,
+				      std::vector<Double_t>& key)
+{
+  // 
+  // Parameters of the weighted energy loss function tabulated for an
+  // eta bin.
+  // 
+  // Parameters:
+  //    o     Energy loss fit 
+  //    n     Maximum number of particles 
+  //    key   On return, the parameters 
+  //
+  const AliFMDCorrELossFit::ELossFit* fit = 
+    static_cast<const AliFMDCorrELossFit::ELossFit*>(o);
+  key.clear();
+  key.push_back(n);
+  key.push_back(fit->GetN());
+  key.push_back(fit->GetC());
+  key.push_back(fit->GetDelta());
+  key.push_back(fit->GetXi());
+  key.push_back(fit->GetSigma());
+  key.push_back(fit->GetSigmaN());
+  const Double_t* a = fit->GetAs();
+  for (Int_t i = 0; a && i < fit->GetN(); i++) key.push_back(a[i]);
+}
+
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::NParticles(Float_t       mult, 
+				    UShort_t      d, 
+				    Char_t        r, 
+				    Float_t       eta,
+				    Bool_t        lowFlux,
+				    RingFitCache& cache) const
+{
+  // 
+  // Get the number of particles corresponding to the signal mult,
+  // with the fit and maximum weight of the eta bin looked up once per
+  // event, and, if SetWeightTableStep was used, the weighted energy
+  // loss function interpolated in a table filled on demand.
+  // 
+  // Parameters:
+  //    mult     Signal
+  //    d        Detector
+  //    r        Ring 
+  //    eta      Pseudo-rapidity 
+  //    lowFlux  Low-flux flag 
+  //    cache    Ring cache 
+  // 
+  // Return:
+  //    The number of particles 
+  //
+  DGUARD(fDebug, 3, "Calculate Nch in FMD density calculator");
+  if (lowFlux) return 1;
+  
+  AliForwardCorrectionManager&  fcm  = AliForwardCorrectionManager::Instance();
+  Int_t                         iEta = fcm.GetELossFit()->FindEtaBin(eta);
+  if (iEta < 0 || iEta >= Int_t(cache.fMaxN.size())) 
+    return NParticles(mult, d, r, eta, lowFlux);
+
+  Bool_t resolved = (cache.fMaxN[iEta] != -2);
+  if (!resolved) { 
+    cache.fFits[iEta] = fcm.GetELossFit()->FindFit(d,r,iEta, -1);
+    cache.fMaxN[iEta] = GetMaxWeight(d,r,iEta-1);
+  }
+  
+  const AliFMDCorrELossFit::ELossFit* fit = 
+    static_cast<const AliFMDCorrELossFit::ELossFit*>(cache.fFits[iEta]);
+  if (!fit) { 
+    AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
+		    d, r, eta, fMinQuality));
+    return 0;
+  }
+  
+  Int_t    m   = cache.fMaxN[iEta];
+  if (m < 1) { 
+    AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
+    return 0;
+  }
+  
+  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
+  Double_t ret = 0;
+  if (fWeightTableStep > 0 && !resolved) {
+    // Once per eta bin and event, drop the table if the function it
+    // tabulates changed, e.g., after the corrections were re-read.
+    // The parameters are compared rather than the fit object, which
+    // may be a new object at the address of a deleted one.
+    MakeTableKey(fit, n, cache.fKey);
+    if (cache.fKey != cache.fTableKeys[iEta]) {
+      cache.fTables[iEta].clear();
+      cache.fTableKeys[iEta] = cache.fKey;
+    }
+  }
+  if (fWeightTableStep > 0 && mult < kWeightTableMax) { 
+    std::vector<Float_t>& table = cache.fTables[iEta];
+    if (table.empty()) 
+      table.assign(Int_t(kWeightTableMax / fWeightTableStep) + 2, -1);
+    Double_t u  = mult / fWeightTableStep;
+    Int_t    k  = Int_t(u);
+    if (table[k]   < 0) table[k]   = fit->EvaluateWeighted(k*fWeightTableStep, n);
+    if (table[k+1] < 0) table[k+1] = fit->EvaluateWeighted((k+1)*fWeightTableStep, n);
+    ret = table[k] + (u - k) * (table[k+1] - table[k]);
+  }
+  else 
+    ret = fit->EvaluateWeighted(mult, n);
+  
+  if (fDebug > 10) {
+    AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
+  }
+    
+  fWeightedSum->Fill(ret);
+  fSumOfWeights->Fill(ret);
+  
+  return ret;
+}
+
 //_____________________________________________________________________
 Float_t 
 AliFMDDensityCalculator::Correction(UShort_t d, 
@@ -1120,6 +1293,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("weightTable",  fWeightTableStep));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1375,7 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFV("Weight table step",      fWeightTableStep);
   PFV("Lower cut", "");
   fCuts.Print();
 
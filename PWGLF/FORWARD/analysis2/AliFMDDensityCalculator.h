@@ -17,6 +17,7 @@
 #include <TList.h>
 #include <TArrayI.h>
 #include <TVector3.h>
+#include <vector>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
 #include "AliPoissonCalculator.h"
@@ -211,6 +212,17 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Set the step, in units of @f$\Delta/\Delta_{mip}@f$, of the
+   * tables of the weighted energy loss functions used to get the
+   * number of particles in a strip.  The tables are kept per ring and
+   * @f$\eta@f$ bin, filled on demand, and linearly interpolated.  If
+   * 0 (default), the functions are evaluated for each strip.
+   * 
+   * @param step Table step, for example 0.005
+   */
+  void SetWeightTableStep(Double_t step=0.005) { 
+    fWeightTableStep = (step < 0 ? 0 : step); }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -336,6 +348,68 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Energy loss fits and maximum weights of one ring, resolved once
+   * per @f$\eta@f$ bin and event, and the tabulated weighted energy
+   * loss functions of the ring (see SetWeightTableStep). 
+   */
+  struct RingFitCache { 
+    RingFitCache() : fFits(), fMaxN(), fTables(), fTableKeys(), fKey() {}
+    std::vector<const TObject*>          fFits;      // Fit per eta bin 
+    std::vector<Int_t>                   fMaxN;      // Max weight, -2 if not resolved
+    std::vector< std::vector<Float_t> >  fTables;    // Table per eta bin 
+    std::vector< std::vector<Double_t> > fTableKeys; // Function parameters of each table 
+    std::vector<Double_t>                fKey;       // Work space 
+  };
+  /** 
+   * Index (0-4) of a ring
+   * 
+   * @param d Detector
+   * @param r Ring 
+   * 
+   * @return Ring index 
+   */
+  static Int_t RingIndex(UShort_t d, Char_t r) { 
+    return (d == 1 ? 0 : (d - 2) * 2 + 1 + (r == 'I' || r == 'i' ? 0 : 1)); }
+  /** 
+   * Mark the fits of a ring as not resolved, at the start of the
+   * ring in each event
+   * 
+   * @param cache Ring cache 
+   */
+  void ResetRingFitCache(RingFitCache& cache) const;
+  /** 
+   * Parameters of the weighted energy loss function of a fit, used
+   * to check that a table still corresponds to the current fit
+   * 
+   * @param fit Energy loss fit 
+   * @param n   Maximum number of particles 
+   * @param key On return, the parameters 
+   */
+  static void MakeTableKey(const TObject*         fit,
+			   UShort_t               n,
+			   std::vector<Double_t>& key);
+  /** 
+   * Get the number of particles corresponding to the signal mult,
+   * using the ring cache of fits and, if enabled, the tables of the
+   * weighted energy loss functions.  Same as the other overload
+   * otherwise.
+   * 
+   * @param mult     Signal
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param lowFlux  Low-flux flag 
+   * @param cache    Ring cache 
+   * 
+   * @return The number of particles 
+   */
+  Float_t NParticles(Float_t       mult, 
+		     UShort_t      d, 
+		     Char_t        r, 
+		     Float_t       eta, 
+		     Bool_t        lowFlux,
+		     RingFitCache& cache) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -504,8 +578,11 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Double_t               fWeightTableStep; // Step of weighted function tables
+  RingFitCache           fRingFits[5];     //! Per ring fits and tables
+  std::vector<Double_t>  fStripBuffer;     //! Per ring strip buffers
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
@@ -18,6 +18,7 @@
 #include <TROOT.h>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 ClassImp(AliFMDEnergyFitter)
 #if 0
@@ -49,7 +50,8 @@ AliFMDEnergyFitter::AliFMDEnergyFitter()
     fDebug(0),
     fResidualMethod(kNoResiduals),
     fSkips(0),
-    fRegularizationCut(3e6)
+    fRegularizationCut(3e6),
+    fUseLandauGausTable(false)
 {
   // 
   // Default Constructor - do not use 
@@ -79,7 +81,8 @@ AliFMDEnergyFitter::AliFMDEnergyFitter(const char* title)
     fDebug(0),
     fResidualMethod(kNoResiduals),
     fSkips(0),
-    fRegularizationCut(3e6)
+    fRegularizationCut(3e6),
+    fUseLandauGausTable(false)
 {
   // 
   // Constructor 
@@ -200,6 +203,7 @@ AliFMDEnergyFitter::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxChi2PerNDF", fMaxChi2PerNDF));
   d->Add(AliForwardUtil::MakeParameter("minWeight",     fMinWeight));
   d->Add(AliForwardUtil::MakeParameter("regCut",        fRegularizationCut));
+  d->Add(AliForwardUtil::MakeParameter("lgTable",       fUseLandauGausTable));
   d->Add(AliForwardUtil::MakeParameter("deltaShift", 
 				       AliLandauGaus::EnableSigmaShift()));
 
@@ -407,6 +411,10 @@ AliFMDEnergyFitter::Fit(const TList* dir)
   if (fRingHistos.GetEntries() <= 0) Init();
 
   AliInfoF("Will do fits for %d rings", fRingHistos.GetEntries());
+  // Select the Landau-Gaus evaluation for the fits, and restore the
+  // global setting when done
+  Bool_t oldTable = AliLandauGaus::EnableTable();
+  AliLandauGaus::EnableTable(fUseLandauGausTable);
   TIter    next(&fRingHistos);
   RingHistos* o = 0;
   while ((o = static_cast<RingHistos*>(next()))) {
@@ -426,6 +434,7 @@ AliFMDEnergyFitter::Fit(const TList* dir)
       stack[i % nStack]->Add(static_cast<TH1*>(l->At(i))); 
     }
   }
+  AliLandauGaus::EnableTable(oldTable);
 
   if (!fDoMakeObject) return;
 
@@ -530,6 +539,7 @@ AliFMDEnergyFitter::ReadParameters(const TCollection* col)
   GetParam(ret,col,"minWeight",     fMinWeight);
   Bool_t dummy;
   GetParam(dummy,col,"regCut",      fRegularizationCut);
+  GetParam(dummy,col,"lgTable",     fUseLandauGausTable);
 
   return ret;
 }
@@ -583,6 +593,7 @@ AliFMDEnergyFitter::Print(Option_t*) const
   PFV("max(chi^2/nu)",	        fMaxChi2PerNDF);
   PFV("min(a_i)",	        fMinWeight);
   PFV("Regularization cut",     fRegularizationCut);
+  PFB("Tabulated Landau-Gaus",  fUseLandauGausTable);
   TString r = "";
   switch (fResidualMethod) { 
   case kNoResiduals:              r = "None";       break;
@@ -1451,19 +1462,49 @@ AliFMDEnergyFitter::RingHistos::CalculateResiduals(EResidualMethod mode,
   resi->GetListOfFunctions()->Clear();
   resi->SetUniqueID(mode);
 
-    // Reset histogram
+  // Bins in the fit range 
   Int_t nX = resi->GetNbinsX();
+  std::vector<Int_t>    bins;
+  std::vector<Double_t> xs;
   for (Int_t i  = 1; i <= nX; i++) { 
     Double_t x  = dist->GetBinCenter(i);
     if (x < lowCut)  continue;
     if (x > highCut) break;
+    bins.push_back(i);
+    xs.push_back(x);
+  }
+  if (xs.empty()) return;
+
+  // Evaluate the fit at all bin centres.  The parameters of each
+  // i-particle response are common to all bins, so the response is
+  // evaluated for all bins in one call to AliLandauGaus::FN.  Same
+  // as ELossFit::Evaluate for each bin.
+  Int_t                 nB = xs.size();
+  std::vector<Double_t> fs(nB, 0);
+  std::vector<Double_t> fi(nB, 0);
+  for (Int_t j = 1; j <= fit->GetN(); j++) { 
+    Double_t deltaJ = fit->GetDelta();
+    Double_t xiJ    = fit->GetXi();
+    Double_t sigmaJ = fit->GetSigma();
+    AliLandauGaus::IPars(j, deltaJ, xiJ, sigmaJ);
+    if (sigmaJ < 1e-10) 
+      for (Int_t k = 0; k < nB; k++) 
+	fi[k] = AliLandauGaus::Fl(xs[k], deltaJ, xiJ);
+    else 
+      AliLandauGaus::FN(nB, &(xs[0]), &(fi[0]), 
+			deltaJ, xiJ, sigmaJ, fit->GetSigmaN());
+    Double_t aJ = (j == 1 ? 1 : fit->GetAs()[j-2]);
+    for (Int_t k = 0; k < nB; k++) fs[k] += aJ * fi[k];
+  }
 
+  for (Int_t k = 0; k < nB; k++) { 
+    Int_t    i  = bins[k];
     Double_t h  = dist->GetBinContent(i);
     Double_t e  = dist->GetBinError(i);
     Double_t r  = 0;
     Double_t er = 0;
     if (h > 0 && e > 0) { 
-      Double_t f = fit->GetC() * fit->Evaluate(x);
+      Double_t f = fit->GetC() * fs[k];
       if (f > 0) { 
 	r  = h-f;
 	switch (mode) { 
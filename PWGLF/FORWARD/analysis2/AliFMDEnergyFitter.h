@@ -286,6 +286,16 @@ public:
   {
     fRegularizationCut = cut;
   }
+  /** 
+   * Whether to evaluate the Landau-Gaus convolutions from a table
+   * during the fits (see AliLandauGaus::EnableTable) rather than by
+   * numerical integration.  This makes the fits considerably faster
+   * at the expense of a small (@f$\lesssim10^{-4}@f$ of the peak)
+   * interpolation error.
+   * 
+   * @param use If true, use the tabulated evaluation 
+   */
+  void SetUseLandauGausTable(Bool_t use=true) { fUseLandauGausTable = use; }
   void SetSkips(UShort_t skip) { fSkips = skip; }
   /** 
    * Set the debug level.  The higher the value the more output 
@@ -750,8 +760,9 @@ protected:
   EResidualMethod fResidualMethod;    // Whether to store residuals (debugging)
   UShort_t        fSkips;             // Rings to skip when fitting 
   Double_t        fRegularizationCut; // When to regularize the chi^2
+  Bool_t          fUseLandauGausTable;// Use tabulated Landau-Gaus in fits
 
-  ClassDef(AliFMDEnergyFitter,8); //
+  ClassDef(AliFMDEnergyFitter,9); //
 };
 
 #endif
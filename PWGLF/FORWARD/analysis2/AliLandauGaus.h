@@ -13,6 +13,7 @@
 #include <TObject.h>
 #include <TF1.h>
 #include <TMath.h>
+#include <vector>
 
 /** 
  * This class contains static member functions to calculate the energy
@@ -326,6 +327,115 @@ public:
   static Double_t SigmaShift(Int_t i, Double_t xi, Double_t sigma);
   /* @} */
 
+  //__________________________________________________________________
+  /** 
+   * @{ 
+   * @name Tabulated evaluation 
+   *
+   * Since TMath::Landau is a function of @f$(x-\Delta_p)/\xi@f$ only,
+   * the convolution F obeys the scaling 
+   *
+   * @f[ 
+   *   f(x;\Delta_p,\xi,\sigma') = \frac{1}{\xi} 
+   *     h\left(\frac{x-\Delta_p}{\xi},\frac{\sigma'}{\xi}\right)
+   * @f]
+   *
+   * with @f$ h(u,s) = f(u;0,1,s)@f$, also for the discretised
+   * integral.  If enabled (see EnableTable), F is interpolated
+   * (bi-cubic Catmull-Rom) in a table of @f$ h@f$ on a uniform grid
+   * in @f$ u@f$ and @f$\log s@f$ instead of integrated.  The rows of
+   * the table (fixed @f$ s@f$) are filled on first use.  Outside the
+   * table range F is integrated as usual.  The difference to the
+   * integration is typically below @f$10^{-4}@f$ of the peak value.
+   * The table is static and filled on demand, so like the fitters
+   * using it, it must not be used from several threads at once.
+   */
+  //------------------------------------------------------------------
+  /** 
+   * Set and check if the tabulated evaluation is enabled 
+   * 
+   * @param val if <0, then only check.  Otherwise set enabled (>0) or not (=0)
+   * 
+   * @return whether the tabulated evaluation is enabled or not 
+   */
+  static Bool_t EnableTable(Short_t val=-1);
+  /** 
+   * Lower edge of the table in @f$ u=(x-\Delta_p)/\xi@f$
+   */
+  static Double_t TableUMin() { return -10; }
+  /** 
+   * Step of the table in @f$ u=(x-\Delta_p)/\xi@f$
+   */
+  static Double_t TableUStep() { return 0.02; }
+  /** 
+   * Number of table nodes in @f$ u @f$ 
+   */
+  static Int_t TableNU() { return 5001; }
+  /** 
+   * Lower edge of the table in @f$ s=\sigma'/\xi@f$ 
+   */
+  static Double_t TableSMin() { return 0.02; }
+  /** 
+   * Upper edge of the table in @f$ s=\sigma'/\xi@f$ 
+   */
+  static Double_t TableSMax() { return 50; }
+  /** 
+   * Number of table nodes in @f$ \log s @f$ 
+   */
+  static Int_t TableNS() { return 97; }
+  /** 
+   * Numerical integration of the Landau, Gaussian convolution, see F. 
+   * 
+   * @param x         where to evaluate @f$ f@f$
+   * @param delta     @f$ \Delta_p@f$ of @f$ f(x;\Delta_p,\xi,\sigma')@f$
+   * @param xi        @f$ \xi@f$ of @f$ f(x;\Delta_p,\xi,\sigma')@f$
+   * @param sigma     @f$ \sigma@f$ of @f$\sigma'^2=\sigma^2-\sigma_n^2 @f$
+   * @param sigma_n   @f$ \sigma_n@f$ of @f$\sigma'^2=\sigma^2-\sigma_n^2 @f$
+   * 
+   * @return @f$ f@f$ evaluated at @f$ x@f$.  
+   */
+  static Double_t FIntegral(Double_t x, Double_t delta, Double_t xi, 
+			    Double_t sigma, Double_t sigma_n);
+  /** 
+   * Evaluate @f$ f@f$ from the table.  
+   * 
+   * @param x         where to evaluate @f$ f@f$
+   * @param delta     @f$ \Delta_p@f$ 
+   * @param xi        @f$ \xi@f$ 
+   * @param sigma1    @f$ \sigma'@f$ 
+   * @param f         On return, @f$ f@f$ evaluated at @f$ x@f$
+   * 
+   * @return false if outside the table range, @a f is then not set
+   */
+  static Bool_t FTable(Double_t x, Double_t delta, Double_t xi, 
+		       Double_t sigma1, Double_t& f);
+  /** 
+   * Evaluate @f$ f@f$ for @a n values of @f$ x@f$ with the same
+   * parameters.  The table look-up is done in a plain loop over the
+   * points, without calls, so that the compiler can vectorize the
+   * index and weight calculations.  Same as calling F for each point.
+   * 
+   * @param n         Number of points 
+   * @param x         Points, array of size @a n
+   * @param f         On return, @f$ f@f$ at the points, array of size @a n
+   * @param delta     @f$ \Delta_p@f$ 
+   * @param xi        @f$ \xi@f$ 
+   * @param sigma     @f$ \sigma@f$ 
+   * @param sigma_n   @f$ \sigma_n@f$ 
+   */
+  static void FN(Int_t n, const Double_t* x, Double_t* f, 
+		 Double_t delta, Double_t xi, 
+		 Double_t sigma, Double_t sigma_n);
+  /** 
+   * Get a row of the table, filling it if needed
+   * 
+   * @param is Index in @f$\log s@f$ 
+   * 
+   * @return Pointer to the TableNU() values of the row 
+   */
+  static const Double_t* TableRow(Int_t is);
+  /* @} */
+
   
   //__________________________________________________________________
   /** 
@@ -528,6 +638,20 @@ AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
 		 Double_t sigma, Double_t sigmaN)
 {
   if (xi <= 0) return 0;
+  if (EnableTable()) { 
+    const Double_t sigma1 = sigmaN == 0 ? sigma : 
+      TMath::Sqrt(sigmaN*sigmaN + sigma*sigma);
+    Double_t f = 0;
+    if (FTable(x, delta, xi, sigma1, f)) return f;
+  }
+  return FIntegral(x, delta, xi, sigma, sigmaN);
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::FIntegral(Double_t x, Double_t delta, Double_t xi,
+			 Double_t sigma, Double_t sigmaN)
+{
+  if (xi <= 0) return 0;
 
   const Int_t    nSteps = NSteps();
   const Double_t nSigma = NSigma();
@@ -548,6 +672,127 @@ AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
   return step * sum * InvSq2Pi() / sigma1;
 }
 
+//____________________________________________________________________
+inline Bool_t
+AliLandauGaus::EnableTable(Short_t val)
+{
+  static Bool_t enabled = false;
+  if (val >= 0) enabled = val == 1;
+  return enabled;
+}
+//____________________________________________________________________
+inline const Double_t*
+AliLandauGaus::TableRow(Int_t is)
+{
+  static std::vector<Double_t> table;
+  static std::vector<Bool_t>   filled;
+  const Int_t nU = TableNU();
+  if (filled.empty()) { 
+    table.resize(nU * TableNS());
+    filled.assign(TableNS(), false);
+  }
+  Double_t* row = &(table[is * nU]);
+  if (filled[is]) return row;
+  
+  const Double_t ds = TMath::Log(TableSMax() / TableSMin()) / (TableNS()-1);
+  const Double_t s  = TableSMin() * TMath::Exp(is * ds);
+  for (Int_t iu = 0; iu < nU; iu++) 
+    row[iu] = FIntegral(TableUMin() + iu * TableUStep(), 0, 1, s, 0);
+  filled[is] = true;
+  return row;
+}
+//____________________________________________________________________
+inline Bool_t
+AliLandauGaus::FTable(Double_t x, Double_t delta, Double_t xi, 
+		      Double_t sigma1, Double_t& f)
+{
+  // Position in the table, one node margin on each side for the 
+  // cubic interpolation
+  const Double_t ds = TMath::Log(TableSMax() / TableSMin()) / (TableNS()-1);
+  const Double_t pu = (((x - delta) / xi) - TableUMin()) / TableUStep();
+  const Double_t ps = TMath::Log(sigma1 / xi / TableSMin()) / ds;
+  if (pu < 1 || pu >= TableNU() - 2) return false;
+  if (ps < 1 || ps >= TableNS() - 2) return false;
+  
+  const Int_t    iu = Int_t(pu);
+  const Int_t    is = Int_t(ps);
+  const Double_t tu = pu - iu;
+  const Double_t ts = ps - is;
+  
+  // Catmull-Rom weights 
+  Double_t wu[4], ws[4];
+  wu[0] = ((-tu + 2) * tu - 1) * tu / 2;
+  wu[1] = ((3 * tu - 5) * tu * tu + 2) / 2;
+  wu[2] = ((-3 * tu + 4) * tu + 1) * tu / 2;
+  wu[3] = (tu - 1) * tu * tu / 2;
+  ws[0] = ((-ts + 2) * ts - 1) * ts / 2;
+  ws[1] = ((3 * ts - 5) * ts * ts + 2) / 2;
+  ws[2] = ((-3 * ts + 4) * ts + 1) * ts / 2;
+  ws[3] = (ts - 1) * ts * ts / 2;
+  
+  Double_t h = 0;
+  for (Int_t j = 0; j < 4; j++) { 
+    const Double_t* row = TableRow(is - 1 + j) + iu - 1;
+    h += ws[j] * (wu[0] * row[0] + wu[1] * row[1] + 
+		  wu[2] * row[2] + wu[3] * row[3]);
+  }
+  f = h / xi;
+  return true;
+}
+//____________________________________________________________________
+inline void
+AliLandauGaus::FN(Int_t n, const Double_t* x, Double_t* f, 
+		  Double_t delta, Double_t xi, 
+		  Double_t sigma, Double_t sigmaN)
+{
+  if (!EnableTable() || xi <= 0) { 
+    for (Int_t i = 0; i < n; i++) f[i] = F(x[i], delta, xi, sigma, sigmaN);
+    return;
+  }
+  
+  // The s position is common to all points, resolve the rows once 
+  const Double_t sigma1 = sigmaN == 0 ? sigma : 
+    TMath::Sqrt(sigmaN*sigmaN + sigma*sigma);
+  const Double_t ds = TMath::Log(TableSMax() / TableSMin()) / (TableNS()-1);
+  const Double_t ps = TMath::Log(sigma1 / xi / TableSMin()) / ds;
+  if (ps < 1 || ps >= TableNS() - 2) { 
+    for (Int_t i = 0; i < n; i++) f[i] = F(x[i], delta, xi, sigma, sigmaN);
+    return;
+  }
+  const Int_t    is = Int_t(ps);
+  const Double_t ts = ps - is;
+  const Double_t ws0 = ((-ts + 2) * ts - 1) * ts / 2;
+  const Double_t ws1 = ((3 * ts - 5) * ts * ts + 2) / 2;
+  const Double_t ws2 = ((-3 * ts + 4) * ts + 1) * ts / 2;
+  const Double_t ws3 = (ts - 1) * ts * ts / 2;
+  const Double_t* r0 = TableRow(is - 1);
+  const Double_t* r1 = TableRow(is);
+  const Double_t* r2 = TableRow(is + 1);
+  const Double_t* r3 = TableRow(is + 2);
+  const Double_t  iXi   = 1. / xi;
+  const Double_t  iStep = 1. / TableUStep();
+  const Int_t     nU    = TableNU();
+  
+  for (Int_t i = 0; i < n; i++) { 
+    const Double_t pu = ((x[i] - delta) * iXi - TableUMin()) * iStep;
+    if (pu < 1 || pu >= nU - 2) { 
+      f[i] = FIntegral(x[i], delta, xi, sigma, sigmaN);
+      continue;
+    }
+    const Int_t    iu = Int_t(pu);
+    const Double_t tu = pu - iu;
+    const Double_t w0 = ((-tu + 2) * tu - 1) * tu / 2;
+    const Double_t w1 = ((3 * tu - 5) * tu * tu + 2) / 2;
+    const Double_t w2 = ((-3 * tu + 4) * tu + 1) * tu / 2;
+    const Double_t w3 = (tu - 1) * tu * tu / 2;
+    const Int_t    k  = iu - 1;
+    const Double_t h0 = w0*r0[k] + w1*r0[k+1] + w2*r0[k+2] + w3*r0[k+3];
+    const Double_t h1 = w0*r1[k] + w1*r1[k+1] + w2*r1[k+2] + w3*r1[k+3];
+    const Double_t h2 = w0*r2[k] + w1*r2[k+1] + w2*r2[k+2] + w3*r2[k+3];
+    const Double_t h3 = w0*r3[k] + w1*r3[k+1] + w2*r3[k+2] + w3*r3[k+3];
+    f[i] = (ws0 * h0 + ws1 * h1 + ws2 * h2 + ws3 * h3) * iXi;
+  }
+}
 //____________________________________________________________________
 inline Double_t 
 AliLandauGaus::Fi(Double_t x, Double_t delta, Double_t xi, 
@@ -18,6 +18,7 @@
 #include <TList.h>
 #include <TRandom3.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <vector>
@@ -131,6 +132,66 @@ namespace
     return hasTOFout && hasTOFtime;
   }
 
+  constexpr float kMassMargin{0.01}; /// margin on the mass window for the pair pre-filter, covers the float rounding of lVector
+
+  /// Lower bound on the distance of two points of the helices of two tracks, from their circles in the transverse plane
+  float MinDistanceXY(const o2::utils::CircleXY &c1, const o2::utils::CircleXY &c2)
+  {
+    if (c1.rC == 0.f || c2.rC == 0.f) // straight tracks
+      return 0.f;
+    const float d = std::hypot(c1.xC - c2.xC, c1.yC - c2.yC);
+    const float gap = std::max(d - c1.rC - c2.rC, std::abs(c1.rC - c2.rC) - d);
+    return gap - 1.e-3f - 1.e-5f * (d + c1.rC + c2.rC);
+  }
+
+  /// Pair compatibility for the triplets of the O2 vertexer path, computed once per event and charge configuration.
+  /// The bounds used are not changed by the propagation of the tracks to the decay vertex (same helix, same momentum
+  /// modulus), so only triplets that would fail the track-to-track DCA or the mass window cuts later are rejected:
+  /// the distance of the tracks at the vertex is larger than the gap between their circles, the pair invariant mass
+  /// is larger than the one for parallel momenta.
+  struct PairTable
+  {
+    void Fill(const std::vector<HelperParticle> &first, float m1, const std::vector<HelperParticle> &second, float m2,
+              float bz, float maxDCA, float maxMass, float thirdMass)
+    {
+      n2 = second.size();
+      pass.assign(first.size() * n2, false);
+      minMass2.assign(first.size() * n2, 0.f);
+      float sna, csa;
+      std::vector<o2::utils::CircleXY> circles2(n2);
+      std::vector<double> p2(n2), e2(n2);
+      for (int j{0}; j < n2; ++j)
+      {
+        second[j].track->getCircleParams(bz, circles2[j], sna, csa);
+        p2[j] = second[j].track->P();
+        e2[j] = std::sqrt(Sq(p2[j]) + Sq(m2));
+      }
+      for (size_t i{0}; i < first.size(); ++i)
+      {
+        o2::utils::CircleXY c1;
+        first[i].track->getCircleParams(bz, c1, sna, csa);
+        const double p1 = first[i].track->P();
+        const double e1 = std::sqrt(Sq(p1) + Sq(m1));
+        for (int j{0}; j < n2; ++j)
+        {
+          const int ij = i * n2 + j;
+          minMass2[ij] = Sq(m1) + Sq(m2) + 2. * (e1 * e2[j] - p1 * p2[j]);
+          if (std::sqrt(minMass2[ij]) + thirdMass > maxMass + kMassMargin)
+            continue;
+          if (MinDistanceXY(c1, circles2[j]) > maxDCA)
+            continue;
+          pass[ij] = true;
+        }
+      }
+    }
+    bool Passes(int i, int j) const { return pass[i * n2 + j]; }
+    float MinMass2(int i, int j) const { return minMass2[i * n2 + j]; }
+
+    int n2 = 0;
+    std::vector<bool> pass;
+    std::vector<float> minMass2;
+  };
+
 } // namespace
 
 AliAnalysisTaskHypertriton3::AliAnalysisTaskHypertriton3(bool mc, std::string name)
@@ -729,20 +790,40 @@ void AliAnalysisTaskHypertriton3::UserExec(Option_t *)
     RHyperTriton3KF &kfRecHyp = *(RHyperTriton3KF *)fRecHyp;
     RHyperTriton3O2 &o2RecHyp = *(RHyperTriton3O2 *)fRecHyp;
 
+    PairTable deuProTable, deuPiTable, proPiTable;
+    const float minMass2Offset = Sq(kDeuMass) + Sq(kPMass) + Sq(kPiMass);
+    const float maxMass2 = Sq(fMassWindow[1] + kMassMargin);
+
     for (int idx{0}; idx < 2; ++idx)
     {
-      for (const auto &deu : helpers[kDeuteron][indices[idx][0]])
+      const auto &deuterons = helpers[kDeuteron][indices[idx][0]];
+      const auto &protons = helpers[kProton][indices[idx][1]];
+      const auto &pions = helpers[kPion][indices[idx][2]];
+      if (!fKF)
+      {
+        const float bz = esdEvent->GetMagneticField();
+        deuProTable.Fill(deuterons, kDeuMass, protons, kPMass, bz, fMaxTrack2TrackDCA[0], fMassWindow[1], kPiMass);
+        deuPiTable.Fill(deuterons, kDeuMass, pions, kPiMass, bz, fMaxTrack2TrackDCA[1], fMassWindow[1], kPMass);
+        proPiTable.Fill(protons, kPMass, pions, kPiMass, bz, fMaxTrack2TrackDCA[2], fMassWindow[1], kDeuMass);
+      }
+      int iDeu{-1};
+      for (const auto &deu : deuterons)
       {
+        ++iDeu;
         KFParticle oneCandidate;
         if (fKF)
         {
           oneCandidate.Q() = deu.particle.GetQ();
           oneCandidate.AddDaughter(deu.particle);
         }
-        for (const auto &p : helpers[kProton][indices[idx][1]])
+        int iPro{-1};
+        for (const auto &p : protons)
         {
+          ++iPro;
           if (deu.track == p.track)
             continue;
+          if (!fKF && !deuProTable.Passes(iDeu, iPro))
+            continue;
 
           KFParticle twoCandidate{oneCandidate};
           if (fKF)
@@ -752,10 +833,20 @@ void AliAnalysisTaskHypertriton3::UserExec(Option_t *)
             if (kfRecHyp.chi2_deuprot > fMaxKFchi2[0] || kfRecHyp.chi2_deuprot < 0.)
               continue;
           }
-          for (const auto &pi : helpers[kPion][indices[idx][2]])
+          int iPi{-1};
+          for (const auto &pi : pions)
           {
+            ++iPi;
             if (p.track == pi.track || deu.track == pi.track || deu.track == p.track)
               continue;
+            if (!fKF)
+            {
+              if (!deuPiTable.Passes(iDeu, iPi) || !proPiTable.Passes(iPro, iPi))
+                continue;
+              /// m^2 = m_dp^2 + m_dpi^2 + m_ppi^2 - m_d^2 - m_p^2 - m_pi^2
+              if (deuProTable.MinMass2(iDeu, iPro) + deuPiTable.MinMass2(iDeu, iPi) + proPiTable.MinMass2(iPro, iPi) - minMass2Offset > maxMass2)
+                continue;
+            }
 
             ROOT::Math::SVector<double, 3U> vert;
             lVector ldeu, lpro, lpi;
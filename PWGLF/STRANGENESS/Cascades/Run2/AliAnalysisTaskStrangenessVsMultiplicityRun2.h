@@ -43,6 +43,8 @@ class AliPhysicsSelection;
 class AliPIDResponse;
 class AliCFContainer;
 class AliV0Result;
+class AliV0ResultIndex;
+class AliCascadeResultIndex;
 class AliCascadeResult;
 class AliExternalTrackParam;
 
@@ -251,6 +253,8 @@ private:
     TList  *fListXiPlus;   // List of XiPlus outputs
     TList  *fListOmegaMinus;   // List of XiMinus outputs
     TList  *fListOmegaPlus;   // List of XiPlus outputs
+    AliV0ResultIndex *fV0ResultIndex; //! Packed V0 configurations for the superlight mode
+    AliCascadeResultIndex *fCascadeResultIndex; //! Packed cascade configurations for the superlight mode
     TTree  *fTreeEvent;              //! Output Tree, Events
     TTree  *fTreeV0;              //! Output Tree, V0s
     TTree  *fTreeCascade;              //! Output Tree, Cascades
@@ -678,7 +682,7 @@ private:
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
     //1: first implementation
 };
 
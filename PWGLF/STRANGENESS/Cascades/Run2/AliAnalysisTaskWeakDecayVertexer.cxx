@@ -41,6 +41,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <Riostream.h>
+#include <algorithm>
 #include "TList.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -103,6 +104,7 @@ class AliAODv0;
 #include "AliLog.h"
 #include "AliTrackerBase.h"
 #include "AliV0HypSel.h"
+#include "AliV0HelixIndex.h"
 
 using std::cout;
 using std::endl;
@@ -154,6 +156,8 @@ fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
 fkPreselectX(kTRUE),
 fkSkipLargeXYDCA(kTRUE),
+fkUseHelixPreselection(kTRUE),
+fkUseCascadeXYPreselection(kTRUE),
 fkMonteCarlo(kFALSE),
 fkUseOptimalTrackParams(kFALSE),
 fkUseOptimalTrackParamsBachelor(kFALSE),
@@ -165,6 +169,7 @@ fV0HypSelArray(NULL),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
 fOnlyCount(kFALSE), 
+fV0HelixIndex(0x0),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -226,6 +231,8 @@ fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
 fkPreselectX(kTRUE),
 fkSkipLargeXYDCA(kTRUE),
+fkUseHelixPreselection(kTRUE),
+fkUseCascadeXYPreselection(kTRUE),
 fkMonteCarlo(kFALSE), 
 fkUseOptimalTrackParams(kFALSE),
 fkUseOptimalTrackParamsBachelor(kFALSE),
@@ -237,6 +244,7 @@ fV0HypSelArray(NULL),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
 fOnlyCount(kFALSE),
+fV0HelixIndex(0x0),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -285,6 +293,10 @@ AliAnalysisTaskWeakDecayVertexer::~AliAnalysisTaskWeakDecayVertexer()
         delete fListHist;
         fListHist = 0x0;
     }
+    if (fV0HelixIndex) {
+        delete fV0HelixIndex;
+        fV0HelixIndex = 0x0;
+    }
 }
 
 //________________________________________________________________________
@@ -334,7 +346,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
     }
     if(! fHistV0ToBachelorPropagationStatus ) {
         //Bookkeep bach/v0 combination attempts, please
-        fHistV0ToBachelorPropagationStatus = new TH1D( "fHistV0ToBachelorPropagationStatus", "V0/Bach pair counts",10,0,10);
+        fHistV0ToBachelorPropagationStatus = new TH1D( "fHistV0ToBachelorPropagationStatus", "V0/Bach pair counts",11,0,11);
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(1, "Linear propag start");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(2, "Linear propag failure");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(3, "Linear propag OK");
@@ -345,6 +357,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(8, "Too many iter");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(9, "Propag failure");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(10,"Propag OK");
+        fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(11,"Skipped by XY pre-sel");
         fListHist->Add(fHistV0ToBachelorPropagationStatus);
     }
     if(! fHistV0OptimalTrackParamUse ) {
@@ -365,7 +378,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
     }
     if(! fHistV0Statistics ) {
         //Histogram Output: Event-by-Event
-        fHistV0Statistics = new TH1D( "fHistV0Statistics", "Candidate count;stage;Count",9,0,9);
+        fHistV0Statistics = new TH1D( "fHistV0Statistics", "Candidate count;stage;Count",10,0,10);
         fHistV0Statistics->GetXaxis()->SetBinLabel(1, "Pairs considered");
         fHistV0Statistics->GetXaxis()->SetBinLabel(2, "Pass neg/pos DCA to PV ");
         fHistV0Statistics->GetXaxis()->SetBinLabel(3, "Pass V0 dau dca");
@@ -375,6 +388,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
         fHistV0Statistics->GetXaxis()->SetBinLabel(7, "Pass CosPA cut");
         fHistV0Statistics->GetXaxis()->SetBinLabel(8, "Within pT range");
         fHistV0Statistics->GetXaxis()->SetBinLabel(9, "Passes all, OTF track used");
+        fHistV0Statistics->GetXaxis()->SetBinLabel(10,"Skipped by helix pre-sel");
         fListHist->Add(fHistV0Statistics);
     }
   
@@ -721,13 +735,57 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     fHistNegTrackCounter -> Fill(nneg);
   
     if( fOnlyCount ) return 0 ; 
+    
+    //Helix pre-selection: pairs failing the large DCAXY skip of GetDCAV0Dau
+    //are known before any propagation, from the helix circles of the tracks.
+    //Index the positive tracks once and only loop over the surviving ones.
+    Bool_t lUseHelixIndex = fkUseHelixPreselection && fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA;
+    std::vector<Int_t> lCandidates;
+    TArrayI lPosSlot;
+    if( lUseHelixIndex ){
+        if( !fV0HelixIndex ) fV0HelixIndex = new AliV0HelixIndex();
+        fV0HelixIndex->Clear();
+        lPosSlot.Set(nentr);
+        lPosSlot.Reset(-1);
+        Double_t lCircle[3];
+        for (Int_t k=0; k<npos; k++) {
+            GetHelixCircle(event->GetTrack(pos[k]), vtxT3D, b, lCircle);
+            fV0HelixIndex->AddTrack(k, lCircle[0], lCircle[1], lCircle[2]);
+            lPosSlot[pos[k]] = k;
+        }
+        fV0HelixIndex->Build();
+    }
   
     for (i=0; i<nneg; i++) {
         Long_t nidx=neg[i];
         AliESDtrack *ntrk=event->GetTrack(nidx);
         if(!ntrk) continue;
         
-        for (Int_t k=0; k<npos; k++) {
+        Long_t lNPairs = npos;
+        if( lUseHelixIndex ){
+            Double_t lCircle[3];
+            GetHelixCircle(ntrk, vtxT3D, b, lCircle);
+            const std::vector<Int_t> &lHits = fV0HelixIndex->GetCandidates(lCircle[0], lCircle[1], lCircle[2], 2*fV0VertexerSels[3]);
+            lCandidates.assign(lHits.begin(), lHits.end());
+            if( fkUseOptimalTrackParams ){
+                //pairs with on-the-fly params have other helices: always try them
+                map<pair<int,int>, int>::iterator iter = fOTFMap.lower_bound(make_pair((int)nidx, kMinInt));
+                for(; iter != fOTFMap.end() && (*iter).first.first == nidx; ++iter){
+                    Int_t lOTFPos = (*iter).first.second;
+                    if( lOTFPos >= 0 && lOTFPos < nentr && lPosSlot[lOTFPos] >= 0 ) lCandidates.push_back(lPosSlot[lOTFPos]);
+                }
+                std::sort(lCandidates.begin(), lCandidates.end());
+                lCandidates.erase(std::unique(lCandidates.begin(), lCandidates.end()), lCandidates.end());
+            }
+            lNPairs = lCandidates.size();
+            
+            //Pairs that were not tried are counted apart
+            Long_t lNSkipped = npos - lNPairs;
+            if( lNSkipped > 0 ) fHistV0Statistics->Fill(9.5, lNSkipped); //skipped by helix pre-selection
+        }
+        
+        for (Int_t ik=0; ik<lNPairs; ik++) {
+            Int_t k = lUseHelixIndex ? lCandidates[ik] : ik;
             Int_t pidx=pos[k];
             AliESDtrack *ptrk=event->GetTrack(pidx);
             if(!ptrk) continue;
@@ -1280,6 +1338,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     // stores relevant tracks in another array
     Long_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Long_t ntr=0;
+    //Bachelor helix circles for the XY pre-selection, see IsCascadeXYFar
+    Bool_t lUseXYPreselection = fkUseCascadeXYPreselection && fkDoImprovedDCACascDauPropagation && !fkDoMaterialCorrection;
+    TArrayD lBachCircle(3*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         ULong_t status=esdtr->GetStatus();
@@ -1301,6 +1362,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         if ( esdtr->GetTPCClusterInfo(2,1) < fNCrossedRowsCutValue && fkNCrossedRowsCut ) continue;
                 
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
+        if( lUseXYPreselection ){
+            Double_t lHelix[6];
+            esdtr->GetHelixParameters(lHelix,b);
+            GetHelixCenter( esdtr, &lBachCircle[3*ntr], b);
+            lBachCircle[3*ntr+2] = TMath::Abs(1./lHelix[4]);
+        }
         trk[ntr++]=i;
     }
     
@@ -1323,6 +1390,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()>0) continue;  // bachelor's charge
             
+            //XY pre-selection: the V0-bachelor DCA is known to fail the cut
+            if( lUseXYPreselection && !(fkUseOptimalTrackParamsBachelor && fOTFMap.find(make_pair(bidx,v->GetPindex())) != fOTFMap.end()) &&
+               IsCascadeXYFar(&v0, &lBachCircle[3*j]) ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
             if(fkUseOptimalTrackParamsBachelor) {
@@ -1418,6 +1492,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()<0) continue;  // bachelor's charge
             
+            //XY pre-selection: the V0-bachelor DCA is known to fail the cut
+            if( lUseXYPreselection && !(fkUseOptimalTrackParamsBachelor && fOTFMap.find(make_pair(v->GetNindex(),bidx)) != fOTFMap.end()) &&
+               IsCascadeXYFar(&v0, &lBachCircle[3*j]) ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
             if(fkUseOptimalTrackParamsBachelor) {
@@ -1668,6 +1749,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesMC(AliESDEvent
     // stores relevant tracks in another array
     Long_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Long_t ntr=0;
+    //Bachelor helix circles for the XY pre-selection, see IsCascadeXYFar
+    Bool_t lUseXYPreselection = fkUseCascadeXYPreselection && fkDoImprovedDCACascDauPropagation && !fkDoMaterialCorrection;
+    TArrayD lBachCircle(3*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         ULong_t status=esdtr->GetStatus();
@@ -1701,6 +1785,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesMC(AliESDEvent
         if ( esdtr->GetTPCClusterInfo(2,1) < fNCrossedRowsCutValue && fkNCrossedRowsCut ) continue;
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
+        if( lUseXYPreselection ){
+            Double_t lHelix[6];
+            esdtr->GetHelixParameters(lHelix,b);
+            GetHelixCenter( esdtr, &lBachCircle[3*ntr], b);
+            lBachCircle[3*ntr+2] = TMath::Abs(1./lHelix[4]);
+        }
         trk[ntr++]=i;
     }
     
@@ -1723,6 +1813,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesMC(AliESDEvent
             
             if (btrk->GetSign()>0) continue;  // bachelor's charge
             
+            //XY pre-selection: the V0-bachelor DCA is known to fail the cut
+            if( lUseXYPreselection && !(fkUseOptimalTrackParamsBachelor && fOTFMap.find(make_pair(bidx,v->GetPindex())) != fOTFMap.end()) &&
+               IsCascadeXYFar(&v0, &lBachCircle[3*j]) ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
             if(fkUseOptimalTrackParamsBachelor) {
@@ -1818,6 +1915,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesMC(AliESDEvent
             
             if (btrk->GetSign()<0) continue;  // bachelor's charge
             
+            //XY pre-selection: the V0-bachelor DCA is known to fail the cut
+            if( lUseXYPreselection && !(fkUseOptimalTrackParamsBachelor && fOTFMap.find(make_pair(v->GetNindex(),bidx)) != fOTFMap.end()) &&
+               IsCascadeXYFar(&v0, &lBachCircle[3*j]) ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
             if(fkUseOptimalTrackParamsBachelor) {
@@ -2022,6 +2126,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
     // stores candidate bachelor tracks in another array
     Int_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Int_t ntr=0;
+    //Bachelor helix circles for the XY pre-selection, see IsCascadeXYFar
+    Bool_t lUseXYPreselection = fkUseCascadeXYPreselection && fkDoImprovedDCACascDauPropagation && !fkDoMaterialCorrection;
+    TArrayD lBachCircle(3*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         
@@ -2037,6 +2144,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
         
+        if( lUseXYPreselection ){
+            Double_t lHelix[6];
+            esdtr->GetHelixParameters(lHelix,b);
+            GetHelixCenter( esdtr, &lBachCircle[3*ntr], b);
+            lBachCircle[3*ntr+2] = TMath::Abs(1./lHelix[4]);
+        }
         trk[ntr++]=i;
     }
     
@@ -2074,6 +2187,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
             //Do not check charges!
+            //XY pre-selection: the V0-bachelor DCA is known to fail the cut
+            if( lUseXYPreselection && IsCascadeXYFar(&v0, &lBachCircle[3*j]) ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -2945,6 +3063,43 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(AliESDtrack *lTrack, const AliESDVertex *vtxT3D, Double_t b, Double_t lCircle[3]){
+    // Helix circle (center x, center y, radius) of a V0 daughter, computed
+    // exactly as in GetDCAV0Dau for the same track (and initial position).
+    // A missing track gets an undefined circle: it is never pre-selected away.
+    if( !lTrack ){
+        lCircle[0] = lCircle[1] = lCircle[2] = TMath::QuietNaN();
+        return;
+    }
+    AliExternalTrackParam lParam(*lTrack);
+    if (fkResetInitialPositions){
+        Double_t dztemp[2], covartemp[3];
+        lParam.PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+    }
+    Double_t lHelix[6];
+    lParam.GetHelixParameters(lHelix,b);
+    GetHelixCenter( &lParam, lCircle, b);
+    lCircle[2] = TMath::Abs(1./lHelix[4]);
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsCascadeXYFar(AliESDv0 *v, const Double_t lBachCircle[3]){
+    // True if the V0-bachelor DCA of the improved PropagateToDCA cannot pass
+    // the cut. That DCA is the distance of a point of the bachelor to the V0
+    // line. Without material correction the bachelor stays on its helix circle,
+    // so the distance is at least the xy distance between the line and the circle.
+    Double_t x,y,z,px,py,pz;
+    v->GetXYZ(x,y,z);
+    v->GetPxPyPz(px,py,pz);
+    Double_t lPt = TMath::Sqrt(px*px+py*py);
+    if( !(lPt > 0) || !TMath::Finite(lBachCircle[0]) || !TMath::Finite(lBachCircle[1]) || !TMath::Finite(lBachCircle[2]) ) return kFALSE;
+    Double_t lDist = TMath::Abs( (x-lBachCircle[0])*py - (y-lBachCircle[1])*px ) / lPt;
+    //conservative: allow for rounding and for the propagation precision
+    Double_t lSlack = 1e-4 + 1e-6*(lDist + lBachCircle[2]);
+    return lDist - lBachCircle[2] - lSlack > fCascadeVertexerSels[4];
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
@@ -3031,6 +3186,8 @@ void AliAnalysisTaskWeakDecayVertexer::Print()
     cout<<" Casc. mass window (GeV/c2).: "<<fMassWindowAroundCascade<<endl;
     cout<<" Master Niterations value...: "<<fMaxIterationsWhenMinimizing<<endl;
     cout<<" Skip large DCAXY in opt....: "<<fkSkipLargeXYDCA<<endl;
+    cout<<" Helix pre-selection........: "<<fkUseHelixPreselection<<endl;
+    cout<<" Cascade XY pre-selection...: "<<fkUseCascadeXYPreselection<<endl;
     cout<<" MC associated only (MCflag): "<<fkMonteCarlo<<endl;
     cout<<" --> Experimental flags: "<<endl;
     cout<<" Run casc. find. with OTFV0.: "<<fkUseOnTheFlyV0Cascading<<endl;
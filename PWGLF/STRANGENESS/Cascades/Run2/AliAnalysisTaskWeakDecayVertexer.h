@@ -32,8 +32,11 @@ class TList;
 class TH1F;
 
 class AliV0HypSel;
+class AliV0HelixIndex;
 class AliESDpid;
 class AliESDEvent;
+class AliESDVertex;
+class AliESDtrack;
 class AliPhysicsSelection;
 
 #include "AliEventCuts.h"
@@ -250,6 +253,14 @@ public:
     void SetSkipLargeXYDCA( Bool_t lOpt = kTRUE) {
         fkSkipLargeXYDCA=lOpt;
     }
+    void SetUseHelixPreselection( Bool_t lOpt = kTRUE) {
+        //Only pair tracks whose helices pass the large DCAXY skip (same V0s, faster)
+        fkUseHelixPreselection=lOpt;
+    }
+    void SetUseCascadeXYPreselection( Bool_t lOpt = kTRUE) {
+        //Skip V0-bachelor pairs whose xy distance already fails the DCA cut (same cascades, faster)
+        fkUseCascadeXYPreselection=lOpt;
+    }
     void SetOnlyCountTracks ( Bool_t lOpt = kTRUE) {
         fOnlyCount = lOpt;
     }
@@ -318,6 +329,8 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    void GetHelixCircle(AliESDtrack *lTrack, const AliESDVertex *vtxT3D, Double_t b, Double_t lCircle[3]);
+    Bool_t IsCascadeXYFar(AliESDv0 *v, const Double_t lBachCircle[3]);
     //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
@@ -388,6 +401,8 @@ private:
     Long_t fMaxIterationsWhenMinimizing;
     Bool_t fkPreselectX;
     Bool_t fkSkipLargeXYDCA;
+    Bool_t fkUseHelixPreselection; //if true, pre-select V0 daughter pairs with AliV0HelixIndex
+    Bool_t fkUseCascadeXYPreselection; //if true, skip V0-bachelor pairs too far apart in xy
     
     //Master MC switch
     Bool_t fkMonteCarlo; //do MC association in vertexing
@@ -419,6 +434,8 @@ private:
     //(pair) -> (OTF index) map
     std::map<std::pair<int, int>, int> fOTFMap; //std::map to store index pair <-> OTF index equiv
     
+    AliV0HelixIndex *fV0HelixIndex; //! per-event helix circles of the positive tracks
+    
 //===========================================================================================
 //   Histograms
 //===========================================================================================
@@ -438,8 +455,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: helix pre-selection of V0 daughter pairs
 };
 
 #endif
@@ -0,0 +1,346 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Precompiled index of AliCascadeResult configurations
+// See header for details
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "TMath.h"
+#include "AliCascadeResult.h"
+#include "AliCascadeResultIndex.h"
+#include "AliLog.h"
+
+ClassImp(AliCascadeResultIndex);
+
+//________________________________________________________________
+AliCascadeResultIndex::AliCascadeResultIndex() :
+TObject(),
+fNConfigs(0), fResults(), fListStart(),
+fMassHypo(), fCharge(), fMinEtaTracks(), fMaxEtaTracks(), fMinRapidity(), fMaxRapidity(),
+fDCANegToPV(), fDCAPosToPV(), fDCAV0Daughters(), fV0CosPA(), fV0Radius(),
+fDCAV0ToPV(), fV0Mass(), fDCABachToPV(), fDCACascDaughters(), fCascCosPA(), fCascRadius(),
+fV0MassSigma(), fProperLifetime(), fLeastNumberOfClusters(), fTPCdEdx(), fUseTOFUnchecked(),
+fXiRejection(), fDCABachToBaryon(), fBachBaryonCosPA(), fMinV0Lifetime(), fMaxV0Lifetime(),
+fUseITSRefitTracks(), fMaxChi2PerCluster(), fMinTrackLength(), fUseParametricLength(),
+fUse276TeVV0CosPA(), fDCACascadeToPV(), fAtLeastOneTOF(),
+fUseITSRefitNegative(), fUseITSRefitPositive(), fUseITSRefitBachelor(),
+fIsCowboy(), fIsCascadeCowboy(), fMinCrossedRowsOverLength(), fLeastNumberOfCrossedRows(), fITSorTOF(),
+fVarV0CosPASet(), fVarCascCosPASet(), fVarBBCosPASet(), fVarDCACascDauSet(),
+fVarV0CosPAPar(), fVarCascCosPAPar(), fVarBBCosPAPar(), fVarDCACascDauPar(),
+fVarV0CosPAValue(), fVarCascCosPAValue(), fVarBBCosPAValue(), fVarDCACascDauValue(),
+fPass(), fHits()
+{
+    // Empty index, use Build()
+}
+
+//________________________________________________________________
+AliCascadeResultIndex::~AliCascadeResultIndex(){
+    // Configurations are owned by the task lists. Nothing to delete.
+}
+
+//________________________________________________________________
+Int_t AliCascadeResultIndex::AddParSet( std::vector<Float_t> &lSets, const Float_t *lPar )
+{
+    // Index of the parametrization in lSets, appended if not yet there
+    Int_t lNSets = lSets.size()/5;
+    for(Int_t iset=0; iset<lNSets; iset++){
+        Bool_t lSame = kTRUE;
+        for(Int_t ip=0; ip<5; ip++) if( lSets[5*iset+ip] != lPar[ip] ) lSame = kFALSE;
+        if( lSame ) return iset;
+    }
+    for(Int_t ip=0; ip<5; ip++) lSets.push_back(lPar[ip]);
+    return lNSets;
+}
+
+//________________________________________________________________
+void AliCascadeResultIndex::Build( TList *lXiMinus, TList *lXiPlus, TList *lOmegaMinus, TList *lOmegaPlus )
+{
+    // Pack the cut values of all configurations, grouped by output list
+    fResults.clear();
+    fListStart.assign(5, 0);
+    TList *lLists[4] = {lXiMinus, lXiPlus, lOmegaMinus, lOmegaPlus};
+    for(Int_t il=0; il<4; il++){
+        fListStart[il] = fResults.size();
+        if( !lLists[il] ) continue;
+        for(Int_t icfg=0; icfg<lLists[il]->GetEntries(); icfg++)
+            fResults.push_back( (AliCascadeResult*) lLists[il]->At(icfg) );
+    }
+    fNConfigs = fResults.size();
+    fListStart[4] = fNConfigs;
+
+    fMassHypo.resize(fNConfigs); fCharge.resize(fNConfigs);
+    fMinEtaTracks.resize(fNConfigs); fMaxEtaTracks.resize(fNConfigs);
+    fMinRapidity.resize(fNConfigs); fMaxRapidity.resize(fNConfigs);
+    fDCANegToPV.resize(fNConfigs); fDCAPosToPV.resize(fNConfigs); fDCAV0Daughters.resize(fNConfigs);
+    fV0CosPA.resize(fNConfigs); fV0Radius.resize(fNConfigs);
+    fDCAV0ToPV.resize(fNConfigs); fV0Mass.resize(fNConfigs); fDCABachToPV.resize(fNConfigs);
+    fDCACascDaughters.resize(fNConfigs); fCascCosPA.resize(fNConfigs); fCascRadius.resize(fNConfigs);
+    fV0MassSigma.resize(fNConfigs); fProperLifetime.resize(fNConfigs);
+    fLeastNumberOfClusters.resize(fNConfigs); fTPCdEdx.resize(fNConfigs); fUseTOFUnchecked.resize(fNConfigs);
+    fXiRejection.resize(fNConfigs); fDCABachToBaryon.resize(fNConfigs); fBachBaryonCosPA.resize(fNConfigs);
+    fMinV0Lifetime.resize(fNConfigs); fMaxV0Lifetime.resize(fNConfigs);
+    fUseITSRefitTracks.resize(fNConfigs); fMaxChi2PerCluster.resize(fNConfigs);
+    fMinTrackLength.resize(fNConfigs); fUseParametricLength.resize(fNConfigs);
+    fUse276TeVV0CosPA.resize(fNConfigs); fDCACascadeToPV.resize(fNConfigs); fAtLeastOneTOF.resize(fNConfigs);
+    fUseITSRefitNegative.resize(fNConfigs); fUseITSRefitPositive.resize(fNConfigs); fUseITSRefitBachelor.resize(fNConfigs);
+    fIsCowboy.resize(fNConfigs); fIsCascadeCowboy.resize(fNConfigs);
+    fMinCrossedRowsOverLength.resize(fNConfigs); fLeastNumberOfCrossedRows.resize(fNConfigs); fITSorTOF.resize(fNConfigs);
+    fVarV0CosPASet.resize(fNConfigs); fVarCascCosPASet.resize(fNConfigs);
+    fVarBBCosPASet.resize(fNConfigs); fVarDCACascDauSet.resize(fNConfigs);
+    fVarV0CosPAPar.clear(); fVarCascCosPAPar.clear(); fVarBBCosPAPar.clear(); fVarDCACascDauPar.clear();
+
+    for(Long_t icfg=0; icfg<fNConfigs; icfg++){
+        AliCascadeResult *lCascadeResult = fResults[icfg];
+        const Int_t lHypo = lCascadeResult->GetMassHypothesis();
+        fMassHypo[icfg] = lHypo;
+        fCharge[icfg]   = ( lHypo == AliCascadeResult::kXiPlus || lHypo == AliCascadeResult::kOmegaPlus ) ? +1 : -1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) fCharge[icfg] *= -1;
+
+        fMinEtaTracks[icfg]     = lCascadeResult->GetCutMinEtaTracks();
+        fMaxEtaTracks[icfg]     = lCascadeResult->GetCutMaxEtaTracks();
+        fMinRapidity[icfg]      = lCascadeResult->GetCutMinRapidity();
+        fMaxRapidity[icfg]      = lCascadeResult->GetCutMaxRapidity();
+        fDCANegToPV[icfg]       = lCascadeResult->GetCutDCANegToPV();
+        fDCAPosToPV[icfg]       = lCascadeResult->GetCutDCAPosToPV();
+        fDCAV0Daughters[icfg]   = lCascadeResult->GetCutDCAV0Daughters();
+        fV0CosPA[icfg]          = lCascadeResult->GetCutV0CosPA();
+        fV0Radius[icfg]         = lCascadeResult->GetCutV0Radius();
+        fDCAV0ToPV[icfg]        = lCascadeResult->GetCutDCAV0ToPV();
+        fV0Mass[icfg]           = lCascadeResult->GetCutV0Mass();
+        fDCABachToPV[icfg]      = lCascadeResult->GetCutDCABachToPV();
+        fDCACascDaughters[icfg] = lCascadeResult->GetCutDCACascDaughters();
+        fCascCosPA[icfg]        = lCascadeResult->GetCutCascCosPA();
+        fCascRadius[icfg]       = lCascadeResult->GetCutCascRadius();
+        fV0MassSigma[icfg]      = lCascadeResult->GetCutV0MassSigma();
+        fProperLifetime[icfg]   = lCascadeResult->GetCutProperLifetime();
+        fLeastNumberOfClusters[icfg] = lCascadeResult->GetCutLeastNumberOfClusters();
+        fTPCdEdx[icfg]          = lCascadeResult->GetCutTPCdEdx();
+        fUseTOFUnchecked[icfg]  = lCascadeResult->GetCutUseTOFUnchecked();
+        fXiRejection[icfg]      = lCascadeResult->GetCutXiRejection();
+        fDCABachToBaryon[icfg]  = lCascadeResult->GetCutDCABachToBaryon();
+        fBachBaryonCosPA[icfg]  = lCascadeResult->GetCutBachBaryonCosPA();
+        fMinV0Lifetime[icfg]    = lCascadeResult->GetCutMinV0Lifetime();
+        fMaxV0Lifetime[icfg]    = lCascadeResult->GetCutMaxV0Lifetime();
+        fUseITSRefitTracks[icfg]   = lCascadeResult->GetCutUseITSRefitTracks();
+        fMaxChi2PerCluster[icfg]   = lCascadeResult->GetCutMaxChi2PerCluster();
+        fMinTrackLength[icfg]      = lCascadeResult->GetCutMinTrackLength();
+        fUseParametricLength[icfg] = lCascadeResult->GetCutUseParametricLength();
+        fUse276TeVV0CosPA[icfg]    = lCascadeResult->GetCutUse276TeVV0CosPA();
+        fDCACascadeToPV[icfg]      = lCascadeResult->GetCutDCACascadeToPV();
+        fAtLeastOneTOF[icfg]       = lCascadeResult->GetCutAtLeastOneTOF();
+        fUseITSRefitNegative[icfg] = lCascadeResult->GetCutUseITSRefitNegative();
+        fUseITSRefitPositive[icfg] = lCascadeResult->GetCutUseITSRefitPositive();
+        fUseITSRefitBachelor[icfg] = lCascadeResult->GetCutUseITSRefitBachelor();
+        fIsCowboy[icfg]            = lCascadeResult->GetCutIsCowboy();
+        fIsCascadeCowboy[icfg]     = lCascadeResult->GetCutIsCascadeCowboy();
+        fMinCrossedRowsOverLength[icfg] = lCascadeResult->GetCutMinCrossedRowsOverLength();
+        fLeastNumberOfCrossedRows[icfg] = lCascadeResult->GetCutLeastNumberOfCrossedRows();
+        fITSorTOF[icfg]            = lCascadeResult->GetCutITSorTOF();
+
+        //Variable cuts: share identical parametrizations
+        Float_t lPar[5];
+        fVarV0CosPASet[icfg] = -1;
+        if( lCascadeResult->GetCutUseVarV0CosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+            fVarV0CosPASet[icfg] = AddParSet( fVarV0CosPAPar, lPar );
+        }
+        fVarCascCosPASet[icfg] = -1;
+        if( lCascadeResult->GetCutUseVarCascCosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+            fVarCascCosPASet[icfg] = AddParSet( fVarCascCosPAPar, lPar );
+        }
+        fVarBBCosPASet[icfg] = -1;
+        if( lCascadeResult->GetCutUseVarBBCosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+            fVarBBCosPASet[icfg] = AddParSet( fVarBBCosPAPar, lPar );
+        }
+        fVarDCACascDauSet[icfg] = -1;
+        if( lCascadeResult->GetCutUseVarDCACascDau() ){
+            lPar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarDCACascDauConst();
+            fVarDCACascDauSet[icfg] = AddParSet( fVarDCACascDauPar, lPar );
+        }
+    }
+    fVarV0CosPAValue.resize(fVarV0CosPAPar.size()/5);
+    fVarCascCosPAValue.resize(fVarCascCosPAPar.size()/5);
+    fVarBBCosPAValue.resize(fVarBBCosPAPar.size()/5);
+    fVarDCACascDauValue.resize(fVarDCACascDauPar.size()/5);
+    fPass.resize(fNConfigs);
+    fHits.resize(fNConfigs);
+
+    AliInfo(Form("Indexed %li cascade configurations, %li distinct variable cut parametrizations", fNConfigs,
+                 (Long_t) (fVarV0CosPAValue.size()+fVarCascCosPAValue.size()+fVarBBCosPAValue.size()+fVarDCACascDauValue.size())));
+}
+
+//________________________________________________________________
+Long_t AliCascadeResultIndex::Evaluate( const Candidate &lCand, const Bool_t *lValidList )
+{
+    // Test the candidate against the configurations of the valid lists.
+    // The passing configurations are available via GetHits().
+    Long_t lNHits = 0;
+
+    //Variable cuts, once per distinct parametrization
+    for(UInt_t iset=0; iset<fVarV0CosPAValue.size(); iset++){
+        const Float_t *lPar = &fVarV0CosPAPar[5*iset];
+        fVarV0CosPAValue[iset] = TMath::Cos(
+                                            lPar[0]*TMath::Exp(lPar[1]*lCand.fPt) +
+                                            lPar[2]*TMath::Exp(lPar[3]*lCand.fPt) +
+                                            lPar[4]);
+    }
+    for(UInt_t iset=0; iset<fVarCascCosPAValue.size(); iset++){
+        const Float_t *lPar = &fVarCascCosPAPar[5*iset];
+        fVarCascCosPAValue[iset] = TMath::Cos(
+                                              lPar[0]*TMath::Exp(lPar[1]*lCand.fPt) +
+                                              lPar[2]*TMath::Exp(lPar[3]*lCand.fPt) +
+                                              lPar[4]);
+    }
+    for(UInt_t iset=0; iset<fVarBBCosPAValue.size(); iset++){
+        const Float_t *lPar = &fVarBBCosPAPar[5*iset];
+        fVarBBCosPAValue[iset] = TMath::Cos(
+                                            lPar[0]*TMath::Exp(lPar[1]*lCand.fPt) +
+                                            lPar[2]*TMath::Exp(lPar[3]*lCand.fPt) +
+                                            lPar[4]);
+    }
+    for(UInt_t iset=0; iset<fVarDCACascDauValue.size(); iset++){
+        const Float_t *lPar = &fVarDCACascDauPar[5*iset];
+        fVarDCACascDauValue[iset] = lPar[0]*TMath::Exp(lPar[1]*lCand.fPt) +
+        lPar[2]*TMath::Exp(lPar[3]*lCand.fPt) +
+        lPar[4];
+    }
+
+    //Candidate values per mass hypothesis
+    Float_t  lV0MassNSigma[4], lLifetime[4], lNegdEdx[4], lPosdEdx[4], lBachdEdx[4];
+    Double_t lV0MassDiff[4];
+    Bool_t   lTOFOK[4], lIsOmega[4];
+    for(Int_t lHypo=0; lHypo<4; lHypo++){
+        lV0MassDiff[lHypo]   = TMath::Abs(lCand.fV0Mass[lHypo]-1.116);
+        lV0MassNSigma[lHypo] = TMath::Abs( (lCand.fV0Mass[lHypo]-lCand.fExpV0Mass) / lCand.fExpV0Sigma );
+        lLifetime[lHypo]     = lCand.fDistOverTotMom*lCand.fPDGMass[lHypo];
+        lNegdEdx[lHypo]      = TMath::Abs(lCand.fNegdEdx[lHypo]);
+        lPosdEdx[lHypo]      = TMath::Abs(lCand.fPosdEdx[lHypo]);
+        lBachdEdx[lHypo]     = TMath::Abs(lCand.fBachdEdx[lHypo]);
+        lTOFOK[lHypo]        = TMath::Abs(lCand.fNegTOFsigma[lHypo])<4 &&
+                               TMath::Abs(lCand.fPosTOFsigma[lHypo])<4 &&
+                               TMath::Abs(lCand.fBachTOFsigma[lHypo])<4;
+        lIsOmega[lHypo]      = (lHypo == AliCascadeResult::kOmegaMinus || lHypo == AliCascadeResult::kOmegaPlus);
+    }
+    const Double_t lXiMassDiff        = TMath::Abs( lCand.fMassAsXi - 1.32171 );
+    const Bool_t   lAllITSrefit       = lCand.fPosITSrefit && lCand.fNegITSrefit && lCand.fBachITSrefit;
+    const Double_t lLengthShiftPt     = TMath::Power(1/(lCand.fPt+1e-6),1.5);
+    const Double_t lLengthShiftRadius = TMath::Max(lCand.fV0Radius-85., 0.);
+
+    for(Int_t il=0; il<4; il++){
+        if( !lValidList[il] ) continue;
+        const Int_t lFirst = fListStart[il];
+        const Int_t lLast  = fListStart[il+1];
+
+        //Branch-free pass over the configurations of the list
+        for(Int_t icfg=lFirst; icfg<lLast; icfg++){
+            const Int_t h = fMassHypo[icfg];
+
+            //Only use the variable cuts if tighter than the non-variable ones
+            Float_t lV0CosPACut = fV0CosPA[icfg];
+            if( fVarV0CosPASet[icfg] >= 0 && fVarV0CosPAValue[fVarV0CosPASet[icfg]] > lV0CosPACut )
+                lV0CosPACut = fVarV0CosPAValue[fVarV0CosPASet[icfg]];
+            Float_t lCascCosPACut = fCascCosPA[icfg];
+            if( fVarCascCosPASet[icfg] >= 0 && fVarCascCosPAValue[fVarCascCosPASet[icfg]] > lCascCosPACut )
+                lCascCosPACut = fVarCascCosPAValue[fVarCascCosPASet[icfg]];
+            //(WARNING: BEWARE INVERSE LOGIC)
+            Float_t lBBCosPACut = fBachBaryonCosPA[icfg];
+            if( fVarBBCosPASet[icfg] >= 0 && fVarBBCosPAValue[fVarBBCosPASet[icfg]] > lBBCosPACut )
+                lBBCosPACut = fVarBBCosPAValue[fVarBBCosPASet[icfg]];
+            //Loosest: default cut, parametric can go tighter
+            Float_t lDCACascDauCut = fDCACascDaughters[icfg];
+            if( fVarDCACascDauSet[icfg] >= 0 && fVarDCACascDauValue[fVarDCACascDauSet[icfg]] < lDCACascDauCut )
+                lDCACascDauCut = fVarDCACascDauValue[fVarDCACascDauSet[icfg]];
+
+            const Bool_t lLengthOK =
+            fMinTrackLength[icfg]<0 ||
+            (lCand.fMinTrackLength > fMinTrackLength[icfg] && !fUseParametricLength[icfg]) ||
+            (lCand.fMinTrackLength > fMinTrackLength[icfg] - lLengthShiftPt - lLengthShiftRadius && fUseParametricLength[icfg]);
+
+            fPass[icfg] =
+            //Check 1: Charge consistent with expectations
+            (lCand.fCharge == fCharge[icfg]) &
+            //Check 2: Basic Acceptance cuts
+            (fMinEtaTracks[icfg] < lCand.fPosEta) & (lCand.fPosEta < fMaxEtaTracks[icfg]) &
+            (fMinEtaTracks[icfg] < lCand.fNegEta) & (lCand.fNegEta < fMaxEtaTracks[icfg]) &
+            (fMinEtaTracks[icfg] < lCand.fBachEta) & (lCand.fBachEta < fMaxEtaTracks[icfg]) &
+            (lCand.fRap[h] > fMinRapidity[icfg]) & (lCand.fRap[h] < fMaxRapidity[icfg]) &
+            //Check 3: Topological Variables
+            // - V0 Selections
+            (lCand.fDCANegToPrimVtx > fDCANegToPV[icfg]) &
+            (lCand.fDCAPosToPrimVtx > fDCAPosToPV[icfg]) &
+            (lCand.fDCAV0Daughters < fDCAV0Daughters[icfg]) &
+            (lCand.fV0CosPointingAngle > lV0CosPACut) &
+            (lCand.fV0Radius > fV0Radius[icfg]) &
+            // - Cascade Selections
+            (lCand.fDCAV0ToPrimVtx > fDCAV0ToPV[icfg]) &
+            (lV0MassDiff[h] < fV0Mass[icfg]) &
+            (lCand.fDCABachToPrimVtx > fDCABachToPV[icfg]) &
+            (lCand.fDCACascDaughters < lDCACascDauCut) &
+            (lCand.fCascCosPointingAngle > lCascCosPACut) &
+            (lCand.fCascRadius > fCascRadius[icfg]) &
+            // - Parametric V0 Mass cut if requested
+            ((fV0MassSigma[icfg] > 50) | (lV0MassNSigma[h] < fV0MassSigma[icfg])) &
+            // - Miscellaneous
+            (lLifetime[h] < fProperLifetime[icfg]) &
+            (lCand.fLeastNbrClusters > fLeastNumberOfClusters[icfg]) &
+            //Check 4: TPC dEdx selections
+            (lNegdEdx[h] < fTPCdEdx[icfg]) & (lPosdEdx[h] < fTPCdEdx[icfg]) & (lBachdEdx[h] < fTPCdEdx[icfg]) &
+            //Check 4bis: TOF selections (experimental), always pass if not requested
+            (!fUseTOFUnchecked[icfg] | lTOFOK[h]) &
+            //Check 5: Xi rejection for Omega analysis
+            (!lIsOmega[h] | (lXiMassDiff > fXiRejection[icfg])) &
+            //Check 6: Experimental DCA Bachelor to Baryon cut
+            (lCand.fDCABachToBaryon > fDCABachToBaryon[icfg]) &
+            //Check 7: Experimental Bach Baryon CosPA
+            (lCand.fWrongCosPA < lBBCosPACut) &
+            //Check 8: Min/Max V0 Lifetime cut
+            (lCand.fV0Lifetime > fMinV0Lifetime[icfg]) &
+            ((lCand.fV0Lifetime < fMaxV0Lifetime[icfg]) | (fMaxV0Lifetime[icfg] > 1e+3)) &
+            //Check 9: kITSrefit track selection if requested
+            (lAllITSrefit | !fUseITSRefitTracks[icfg]) &
+            //Check 10: Max Chi2/Clusters if not absurd
+            ((fMaxChi2PerCluster[icfg]>1e+3) | (lCand.fMaxChi2PerCluster < fMaxChi2PerCluster[icfg])) &
+            //Check 11: Min Track Length if positive
+            lLengthOK &
+            //Check 12: special V0 CosPA cut
+            (!fUse276TeVV0CosPA[icfg] | (lCand.fV0CosPointingAngle > lCand.f276TeVV0CosPA)) &
+            //Check 13: 3D Cascade DCA to PV
+            ((fDCACascadeToPV[icfg] > 999) | (lCand.fCascDCAtoPV < fDCACascadeToPV[icfg])) &
+            //Check 14: has at least one track with some TOF info
+            (!fAtLeastOneTOF[icfg] | lCand.fAtLeastOneTOF) &
+            //Check 15: check each prong for ITS refit
+            (!fUseITSRefitNegative[icfg] | lCand.fNegITSrefit) &
+            (!fUseITSRefitPositive[icfg] | lCand.fPosITSrefit) &
+            (!fUseITSRefitBachelor[icfg] | lCand.fBachITSrefit) &
+            //Check 16: cowboy/sailor for V0
+            ((fIsCowboy[icfg]==0) | ((fIsCowboy[icfg]==1) & lCand.fIsCowboy) | ((fIsCowboy[icfg]==-1) & !lCand.fIsCowboy)) &
+            //Check 17: cowboy/sailor for cascade
+            ((fIsCascadeCowboy[icfg]==0) | ((fIsCascadeCowboy[icfg]==1) & lCand.fIsCascadeCowboy) | ((fIsCascadeCowboy[icfg]==-1) & !lCand.fIsCascadeCowboy)) &
+            //Check 18-19: modern track quality selections
+            ((fMinCrossedRowsOverLength[icfg]<0) | (lCand.fLeastNcrOverLength > fMinCrossedRowsOverLength[icfg])) &
+            ((fLeastNumberOfCrossedRows[icfg]<0) | (lCand.fLeastNbrCrossedRows > fLeastNumberOfCrossedRows[icfg])) &
+            //Check 20: ITS or TOF required
+            (!fITSorTOF[icfg] | lCand.fITSorTOF);
+        }
+        for(Int_t icfg=lFirst; icfg<lLast; icfg++)
+            if( fPass[icfg] ) fHits[lNHits++] = icfg;
+    }
+    return lNHits;
+}
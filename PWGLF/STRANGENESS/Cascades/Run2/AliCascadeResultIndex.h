@@ -0,0 +1,169 @@
+#ifndef AliCascadeResultIndex_H
+#define AliCascadeResultIndex_H
+#include <TObject.h>
+#include <vector>
+
+class TList;
+class AliCascadeResult;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Precompiled index of AliCascadeResult configurations
+//
+// Cascade counterpart of AliV0ResultIndex. The cut values of all
+// configurations are packed once into flat arrays, grouped by the
+// output list they come from (XiMinus, XiPlus, OmegaMinus, OmegaPlus),
+// so that a list rejected by the per-candidate pre-selection is skipped
+// as a whole. Distinct variable-cut parametrizations (V0 CosPA, cascade
+// CosPA, bachelor-baryon CosPA, DCA cascade daughters) are evaluated
+// once per candidate.
+//
+// The selections are the same as those of the superlight output mode
+// of AliAnalysisTaskStrangenessVsMultiplicityRun2.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliCascadeResultIndex : public TObject {
+
+public:
+    //Candidate properties needed by the selections
+    //Arrays are indexed by AliCascadeResult::EMassHypo
+    struct Candidate {
+        Int_t    fCharge;
+        Float_t  fPt;
+        Float_t  fNegEta;
+        Float_t  fPosEta;
+        Float_t  fBachEta;
+        Float_t  fDCANegToPrimVtx;
+        Float_t  fDCAPosToPrimVtx;
+        Float_t  fDCAV0Daughters;
+        Float_t  fV0CosPointingAngle;
+        Float_t  fV0Radius;
+        Float_t  fDCAV0ToPrimVtx;
+        Float_t  fDCABachToPrimVtx;
+        Float_t  fDCACascDaughters;
+        Float_t  fCascCosPointingAngle;
+        Float_t  fCascRadius;
+        Float_t  fExpV0Mass;
+        Float_t  fExpV0Sigma;
+        Float_t  fDistOverTotMom;
+        Int_t    fLeastNbrClusters;
+        Float_t  fMassAsXi;
+        Float_t  fDCABachToBaryon;
+        Float_t  fWrongCosPA;
+        Float_t  fV0Lifetime;
+        Bool_t   fPosITSrefit;
+        Bool_t   fNegITSrefit;
+        Bool_t   fBachITSrefit;
+        Float_t  fMaxChi2PerCluster;
+        Float_t  fMinTrackLength;
+        Float_t  f276TeVV0CosPA;
+        Double_t fCascDCAtoPV;
+        Bool_t   fAtLeastOneTOF;
+        Bool_t   fIsCowboy;
+        Bool_t   fIsCascadeCowboy;
+        Float_t  fLeastNcrOverLength;
+        Int_t    fLeastNbrCrossedRows;
+        Bool_t   fITSorTOF;
+        Float_t  fV0Mass[4];
+        Float_t  fRap[4];
+        Float_t  fPDGMass[4];
+        Float_t  fNegdEdx[4];
+        Float_t  fPosdEdx[4];
+        Float_t  fBachdEdx[4];
+        Float_t  fNegTOFsigma[4];
+        Float_t  fPosTOFsigma[4];
+        Float_t  fBachTOFsigma[4];
+    };
+
+    AliCascadeResultIndex();
+    ~AliCascadeResultIndex();
+
+    //Pack the configurations of the lists, in this order
+    void Build( TList *lXiMinus, TList *lXiPlus, TList *lOmegaMinus, TList *lOmegaPlus );
+
+    //Test a candidate against the configurations of the lists flagged
+    //valid (same order as in Build), returns number of hits
+    Long_t Evaluate( const Candidate &lCand, const Bool_t *lValidList );
+
+    Long_t GetNConfigurations() const { return fResults.size(); }
+    AliCascadeResult* GetResult(Long_t lcfg) const { return fResults[lcfg]; }
+    //Configurations that passed in the last Evaluate, in configuration order
+    const Int_t* GetHits() const { return fNConfigs ? &fHits[0] : 0x0; }
+
+private:
+    //Add a variable-cut parametrization, sharing identical ones
+    static Int_t AddParSet( std::vector<Float_t> &lSets, const Float_t *lPar );
+
+    Long_t fNConfigs; //! number of configurations
+    std::vector<AliCascadeResult*> fResults; //! configurations, list order
+    std::vector<Int_t> fListStart; //! first configuration of each list, one more than lists
+
+    //Packed cuts
+    std::vector<UChar_t>  fMassHypo; //!
+    std::vector<Int_t>    fCharge; //! expected charge, bachelor swap included
+    std::vector<Double_t> fMinEtaTracks; //!
+    std::vector<Double_t> fMaxEtaTracks; //!
+    std::vector<Double_t> fMinRapidity; //!
+    std::vector<Double_t> fMaxRapidity; //!
+    std::vector<Double_t> fDCANegToPV; //!
+    std::vector<Double_t> fDCAPosToPV; //!
+    std::vector<Double_t> fDCAV0Daughters; //!
+    std::vector<Float_t>  fV0CosPA; //!
+    std::vector<Double_t> fV0Radius; //!
+    std::vector<Double_t> fDCAV0ToPV; //!
+    std::vector<Double_t> fV0Mass; //!
+    std::vector<Double_t> fDCABachToPV; //!
+    std::vector<Float_t>  fDCACascDaughters; //!
+    std::vector<Float_t>  fCascCosPA; //!
+    std::vector<Double_t> fCascRadius; //!
+    std::vector<Double_t> fV0MassSigma; //!
+    std::vector<Double_t> fProperLifetime; //!
+    std::vector<Double_t> fLeastNumberOfClusters; //!
+    std::vector<Double_t> fTPCdEdx; //!
+    std::vector<UChar_t>  fUseTOFUnchecked; //!
+    std::vector<Double_t> fXiRejection; //!
+    std::vector<Double_t> fDCABachToBaryon; //!
+    std::vector<Float_t>  fBachBaryonCosPA; //!
+    std::vector<Double_t> fMinV0Lifetime; //!
+    std::vector<Double_t> fMaxV0Lifetime; //!
+    std::vector<UChar_t>  fUseITSRefitTracks; //!
+    std::vector<Double_t> fMaxChi2PerCluster; //!
+    std::vector<Double_t> fMinTrackLength; //!
+    std::vector<UChar_t>  fUseParametricLength; //!
+    std::vector<UChar_t>  fUse276TeVV0CosPA; //!
+    std::vector<Double_t> fDCACascadeToPV; //!
+    std::vector<UChar_t>  fAtLeastOneTOF; //!
+    std::vector<UChar_t>  fUseITSRefitNegative; //!
+    std::vector<UChar_t>  fUseITSRefitPositive; //!
+    std::vector<UChar_t>  fUseITSRefitBachelor; //!
+    std::vector<Int_t>    fIsCowboy; //!
+    std::vector<Int_t>    fIsCascadeCowboy; //!
+    std::vector<Double_t> fMinCrossedRowsOverLength; //!
+    std::vector<Double_t> fLeastNumberOfCrossedRows; //!
+    std::vector<UChar_t>  fITSorTOF; //!
+
+    //Variable cuts: index in the parameter sets, -1 if not used
+    std::vector<Int_t>    fVarV0CosPASet; //!
+    std::vector<Int_t>    fVarCascCosPASet; //!
+    std::vector<Int_t>    fVarBBCosPASet; //!
+    std::vector<Int_t>    fVarDCACascDauSet; //!
+
+    //Distinct parametrizations, 5 parameters each, and their per candidate values
+    std::vector<Float_t>  fVarV0CosPAPar; //!
+    std::vector<Float_t>  fVarCascCosPAPar; //!
+    std::vector<Float_t>  fVarBBCosPAPar; //!
+    std::vector<Float_t>  fVarDCACascDauPar; //!
+    std::vector<Float_t>  fVarV0CosPAValue; //!
+    std::vector<Float_t>  fVarCascCosPAValue; //!
+    std::vector<Float_t>  fVarBBCosPAValue; //!
+    std::vector<Float_t>  fVarDCACascDauValue; //!
+
+    //Output
+    std::vector<UChar_t>  fPass; //! per configuration
+    std::vector<Int_t>    fHits; //!
+
+    AliCascadeResultIndex(const AliCascadeResultIndex&);            // not implemented
+    AliCascadeResultIndex& operator=(const AliCascadeResultIndex&); // not implemented
+
+    ClassDef(AliCascadeResultIndex, 1);
+};
+#endif
@@ -0,0 +1,160 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Per-event index of V0 daughter helices in the transverse plane
+// See header for details
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include <algorithm>
+#include "TMath.h"
+#include "AliV0HelixIndex.h"
+
+ClassImp(AliV0HelixIndex);
+
+//________________________________________________________________
+AliV0HelixIndex::AliV0HelixIndex() :
+TObject(),
+fMaxCenterDistance(1000.),
+fSlot(), fXCenter(), fYCenter(), fRadius(),
+fNCells(0), fXMin(0), fYMin(0), fCellSize(1),
+fCellStart(), fCellTracks(), fCellRMin(), fCellRMax(), fOutside(),
+fCandidates()
+{
+    // Empty index, use AddTrack() and Build()
+}
+
+//________________________________________________________________
+AliV0HelixIndex::~AliV0HelixIndex(){
+    // Nothing to delete
+}
+
+//________________________________________________________________
+void AliV0HelixIndex::Clear(Option_t *)
+{
+    // Remove all tracks, capacities are kept for the next event
+    fSlot.clear(); fXCenter.clear(); fYCenter.clear(); fRadius.clear();
+    fNCells = 0;
+    fCellStart.clear(); fCellTracks.clear(); fCellRMin.clear(); fCellRMax.clear();
+    fOutside.clear();
+    fCandidates.clear();
+}
+
+//________________________________________________________________
+void AliV0HelixIndex::AddTrack( Int_t lSlot, Double_t lXCenter, Double_t lYCenter, Double_t lRadius )
+{
+    fSlot.push_back(lSlot);
+    fXCenter.push_back(lXCenter);
+    fYCenter.push_back(lYCenter);
+    fRadius.push_back(lRadius);
+}
+
+//________________________________________________________________
+void AliV0HelixIndex::Build()
+{
+    // Bucket the helix centres in a square grid of about two tracks
+    // per cell. Non-finite helices and far away centres are kept aside.
+    const Long_t lN = fSlot.size();
+    fOutside.clear();
+    std::vector<Int_t> lInGrid;
+    lInGrid.reserve(lN);
+    Double_t lXMax = -1e+30, lYMax = -1e+30;
+    fXMin = 1e+30; fYMin = 1e+30;
+    for(Long_t it=0; it<lN; it++){
+        if( !TMath::Finite(fXCenter[it]) || !TMath::Finite(fYCenter[it]) || !TMath::Finite(fRadius[it]) ||
+           TMath::Abs(fXCenter[it]) > fMaxCenterDistance || TMath::Abs(fYCenter[it]) > fMaxCenterDistance ){
+            fOutside.push_back(it);
+            continue;
+        }
+        lInGrid.push_back(it);
+        fXMin = TMath::Min(fXMin, fXCenter[it]); lXMax = TMath::Max(lXMax, fXCenter[it]);
+        fYMin = TMath::Min(fYMin, fYCenter[it]); lYMax = TMath::Max(lYMax, fYCenter[it]);
+    }
+    const Long_t lNGrid = lInGrid.size();
+    if( lNGrid == 0 ){
+        fNCells = 0;
+        fCellStart.assign(1, 0);
+        fCellTracks.clear(); fCellRMin.clear(); fCellRMax.clear();
+        return;
+    }
+    fNCells = TMath::Max(1, TMath::Min(64, (Int_t) TMath::Sqrt(0.5*lNGrid)));
+    fCellSize = TMath::Max(lXMax-fXMin, lYMax-fYMin) / fNCells;
+    if( fCellSize <= 0 ) fCellSize = 1.;
+
+    //Counting sort into cells
+    const Int_t lNCellsTot = fNCells*fNCells;
+    fCellStart.assign(lNCellsTot+1, 0);
+    fCellRMin.assign(lNCellsTot, 1e+30);
+    fCellRMax.assign(lNCellsTot, 0.);
+    std::vector<Int_t> lCell(lNGrid);
+    for(Long_t ig=0; ig<lNGrid; ig++){
+        Long_t it = lInGrid[ig];
+        Int_t ix = TMath::Min(fNCells-1, (Int_t) ((fXCenter[it]-fXMin)/fCellSize));
+        Int_t iy = TMath::Min(fNCells-1, (Int_t) ((fYCenter[it]-fYMin)/fCellSize));
+        lCell[ig] = ix*fNCells + iy;
+        fCellStart[lCell[ig]+1]++;
+        fCellRMin[lCell[ig]] = TMath::Min(fCellRMin[lCell[ig]], fRadius[it]);
+        fCellRMax[lCell[ig]] = TMath::Max(fCellRMax[lCell[ig]], fRadius[it]);
+    }
+    for(Int_t ic=0; ic<lNCellsTot; ic++) fCellStart[ic+1] += fCellStart[ic];
+    std::vector<Int_t> lFill(fCellStart.begin(), fCellStart.end()-1);
+    fCellTracks.resize(lNGrid);
+    for(Long_t ig=0; ig<lNGrid; ig++) fCellTracks[lFill[lCell[ig]]++] = lInGrid[ig];
+}
+
+//________________________________________________________________
+Bool_t AliV0HelixIndex::IsPassing( Long_t it, Double_t lXCenter, Double_t lYCenter, Double_t lRadius, Double_t lMargin ) const
+{
+    // Exact test, written as in AliAnalysisTaskWeakDecayVertexer::GetDCAV0Dau
+    Double_t lDist = TMath::Sqrt(
+                                 TMath::Power( lXCenter - fXCenter[it] , 2) +
+                                 TMath::Power( lYCenter - fYCenter[it] , 2)
+                                 );
+    if( lDist > lRadius + fRadius[it] + lMargin ) return kFALSE;
+    if( lDist < TMath::Abs(lRadius - fRadius[it]) - lMargin ) return kFALSE;
+    return kTRUE;
+}
+
+//________________________________________________________________
+const std::vector<Int_t>& AliV0HelixIndex::GetCandidates( Double_t lXCenter, Double_t lYCenter, Double_t lRadius, Double_t lMargin )
+{
+    fCandidates.clear();
+
+    //No geometry for a straight line: everything is a candidate
+    if( !TMath::Finite(lXCenter) || !TMath::Finite(lYCenter) || !TMath::Finite(lRadius) ){
+        fCandidates.assign(fSlot.begin(), fSlot.end());
+        return fCandidates;
+    }
+
+    std::vector<Int_t> &lTracks = fCandidates;
+    for(Long_t io=0; io<(Long_t)fOutside.size(); io++)
+        if( IsPassing(fOutside[io], lXCenter, lYCenter, lRadius, lMargin) ) lTracks.push_back(fOutside[io]);
+
+    for(Int_t ix=0; ix<fNCells; ix++){
+        //distance range of the cell column to the query centre, in x
+        Double_t lX0 = fXMin + ix*fCellSize, lX1 = lX0 + fCellSize;
+        Double_t lDxMin = lXCenter < lX0 ? lX0-lXCenter : (lXCenter > lX1 ? lXCenter-lX1 : 0.);
+        Double_t lDxMax = TMath::Max(TMath::Abs(lXCenter-lX0), TMath::Abs(lXCenter-lX1));
+        for(Int_t iy=0; iy<fNCells; iy++){
+            Int_t ic = ix*fNCells + iy;
+            if( fCellStart[ic] == fCellStart[ic+1] ) continue;
+            Double_t lY0 = fYMin + iy*fCellSize, lY1 = lY0 + fCellSize;
+            Double_t lDyMin = lYCenter < lY0 ? lY0-lYCenter : (lYCenter > lY1 ? lYCenter-lY1 : 0.);
+            Double_t lDyMax = TMath::Max(TMath::Abs(lYCenter-lY0), TMath::Abs(lYCenter-lY1));
+            Double_t lDMin = TMath::Sqrt(lDxMin*lDxMin + lDyMin*lDyMin);
+            Double_t lDMax = TMath::Sqrt(lDxMax*lDxMax + lDyMax*lDyMax);
+            //smallest |R1-R2| over the radius range of the cell
+            Double_t lGap = 0.;
+            if( lRadius < fCellRMin[ic] ) lGap = fCellRMin[ic] - lRadius;
+            if( lRadius > fCellRMax[ic] ) lGap = lRadius - fCellRMax[ic];
+            //conservative: allow for rounding and for centres on the cell edge
+            Double_t lSlack = 1e-6 + 1e-9*(lDMax + lRadius + fCellRMax[ic] + lMargin);
+            if( lDMin - lSlack > lRadius + fCellRMax[ic] + lMargin ) continue;
+            if( lDMax + lSlack < lGap - lMargin ) continue;
+            for(Int_t ip=fCellStart[ic]; ip<fCellStart[ic+1]; ip++)
+                if( IsPassing(fCellTracks[ip], lXCenter, lYCenter, lRadius, lMargin) ) lTracks.push_back(fCellTracks[ip]);
+        }
+    }
+
+    //back to AddTrack order, then to slots
+    std::sort(lTracks.begin(), lTracks.end());
+    for(Long_t ic=0; ic<(Long_t)lTracks.size(); ic++) lTracks[ic] = fSlot[lTracks[ic]];
+    return fCandidates;
+}
@@ -0,0 +1,79 @@
+#ifndef AliV0HelixIndex_H
+#define AliV0HelixIndex_H
+#include <TObject.h>
+#include <vector>
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Per-event index of V0 daughter helices in the transverse plane
+//
+// The tracks of one charge are stored with their helix centre and
+// radius and bucketed in a grid of helix centres, each grid cell
+// keeping the radius range of its tracks. For a track of the other
+// charge, GetCandidates returns the tracks whose circles come within
+// a given margin of its circle:
+//
+//   |R1-R2| - margin <= D <= R1 + R2 + margin
+//
+// with D the centre-to-centre distance. This is the same test, with
+// the same arithmetic, as the large DCAxy skip of
+// AliAnalysisTaskWeakDecayVertexer::GetDCAV0Dau, so that tracks not
+// returned here would have been rejected there anyway. Whole cells
+// are discarded with a conservative bound, the surviving tracks are
+// tested one by one. Tracks with a non-finite helix (straight line)
+// are always returned.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliV0HelixIndex : public TObject {
+
+public:
+    AliV0HelixIndex();
+    ~AliV0HelixIndex();
+
+    //Start a new event
+    void Clear(Option_t *option="");
+    //Store a track: lSlot is returned by GetCandidates, must be increasing
+    void AddTrack( Int_t lSlot, Double_t lXCenter, Double_t lYCenter, Double_t lRadius );
+    //Bucket the stored tracks, call once after the last AddTrack
+    void Build();
+
+    //Slots of the stored tracks whose circle comes within lMargin of
+    //the given circle, in increasing order
+    const std::vector<Int_t>& GetCandidates( Double_t lXCenter, Double_t lYCenter, Double_t lRadius, Double_t lMargin );
+
+    Long_t GetNTracks() const { return fSlot.size(); }
+
+    //Centres further away from the origin than this go to a list
+    //which is tested track by track (stiff tracks)
+    void SetMaxCenterDistance( Double_t lDist ) { fMaxCenterDistance = lDist; }
+
+private:
+    Bool_t IsPassing( Long_t lTrack, Double_t lXCenter, Double_t lYCenter, Double_t lRadius, Double_t lMargin ) const;
+
+    Double_t fMaxCenterDistance; //! extent of the centre grid
+
+    //Stored tracks, in AddTrack order
+    std::vector<Int_t>    fSlot;     //!
+    std::vector<Double_t> fXCenter;  //!
+    std::vector<Double_t> fYCenter;  //!
+    std::vector<Double_t> fRadius;   //!
+
+    //Centre grid
+    Int_t    fNCells;     //! cells per side
+    Double_t fXMin;       //!
+    Double_t fYMin;       //!
+    Double_t fCellSize;   //!
+    std::vector<Int_t>    fCellStart;   //! first position of each cell in fCellTracks, one more than cells
+    std::vector<Int_t>    fCellTracks;  //! tracks sorted by cell
+    std::vector<Double_t> fCellRMin;    //! smallest radius per cell
+    std::vector<Double_t> fCellRMax;    //! largest radius per cell
+    std::vector<Int_t>    fOutside;     //! tracks tested one by one
+
+    //Output
+    std::vector<Int_t>    fCandidates;  //!
+
+    AliV0HelixIndex(const AliV0HelixIndex&);            // not implemented
+    AliV0HelixIndex& operator=(const AliV0HelixIndex&); // not implemented
+
+    ClassDef(AliV0HelixIndex, 1);
+};
+#endif
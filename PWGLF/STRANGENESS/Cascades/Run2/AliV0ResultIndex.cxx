@@ -0,0 +1,232 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Precompiled index of AliV0Result configurations
+// See header for details
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "TMath.h"
+#include "AliV0Result.h"
+#include "AliV0ResultIndex.h"
+#include "AliLog.h"
+
+ClassImp(AliV0ResultIndex);
+
+//________________________________________________________________
+AliV0ResultIndex::AliV0ResultIndex() :
+TObject(),
+fNConfigs(0), fResults(), fGroupStart(), fOrder(),
+fMinEtaTracks(), fMaxEtaTracks(), fMinRapidity(), fMaxRapidity(),
+fV0Radius(), fMaxV0Radius(), fDCANegToPV(), fDCAPosToPV(), fDCAV0Daughters(),
+fV0CosPA(), fVarV0CosPASet(), fProperLifetime(),
+fLeastNumberOfCrossedRows(), fLeastNumberOfCrossedRowsOverFindable(),
+fMinBaryonMomentum(), fTPCdEdx(), fArmenteros(), fArmenterosParameter(),
+fUseITSRefitTracks(), fMaxChi2PerCluster(), fMinTrackLength(), fUseParametricLength(),
+f276TeVLikedEdx(), fAtLeastOneTOF(), fIsCowboy(), fMinCrossedRowsOverLength(), fITSorTOF(),
+fVarV0CosPAPar(), fVarV0CosPAValue(),
+fPass(), fHitMask(), fHits()
+{
+    // Empty index, use Build()
+}
+
+//________________________________________________________________
+AliV0ResultIndex::~AliV0ResultIndex(){
+    // Configurations are owned by the task lists. Nothing to delete.
+}
+
+//________________________________________________________________
+void AliV0ResultIndex::Build( TList *lK0Short, TList *lLambda, TList *lAntiLambda )
+{
+    // Pack the cut values of all configurations, grouped by
+    // (mass hypothesis, on-the-fly status)
+    fResults.clear();
+    TList *lLists[3] = {lK0Short, lLambda, lAntiLambda};
+    for(Int_t il=0; il<3; il++){
+        if( !lLists[il] ) continue;
+        for(Int_t icfg=0; icfg<lLists[il]->GetEntries(); icfg++)
+            fResults.push_back( (AliV0Result*) lLists[il]->At(icfg) );
+    }
+    fNConfigs = fResults.size();
+
+    //Stable counting sort into the 6 groups
+    const Int_t lNGroups = 6;
+    fGroupStart.assign(lNGroups+1, 0);
+    std::vector<Int_t> lGroup(fNConfigs);
+    for(Long_t icfg=0; icfg<fNConfigs; icfg++){
+        lGroup[icfg] = GroupOf( fResults[icfg]->GetMassHypothesis(), fResults[icfg]->GetUseOnTheFly() ? 1 : 0 );
+        fGroupStart[lGroup[icfg]+1]++;
+    }
+    for(Int_t ig=0; ig<lNGroups; ig++) fGroupStart[ig+1] += fGroupStart[ig];
+    std::vector<Int_t> lFill(fGroupStart.begin(), fGroupStart.end()-1);
+    fOrder.resize(fNConfigs);
+    for(Long_t icfg=0; icfg<fNConfigs; icfg++) fOrder[lFill[lGroup[icfg]]++] = icfg;
+
+    fMinEtaTracks.resize(fNConfigs); fMaxEtaTracks.resize(fNConfigs);
+    fMinRapidity.resize(fNConfigs); fMaxRapidity.resize(fNConfigs);
+    fV0Radius.resize(fNConfigs); fMaxV0Radius.resize(fNConfigs);
+    fDCANegToPV.resize(fNConfigs); fDCAPosToPV.resize(fNConfigs); fDCAV0Daughters.resize(fNConfigs);
+    fV0CosPA.resize(fNConfigs); fVarV0CosPASet.resize(fNConfigs); fProperLifetime.resize(fNConfigs);
+    fLeastNumberOfCrossedRows.resize(fNConfigs); fLeastNumberOfCrossedRowsOverFindable.resize(fNConfigs);
+    fMinBaryonMomentum.resize(fNConfigs); fTPCdEdx.resize(fNConfigs);
+    fArmenteros.resize(fNConfigs); fArmenterosParameter.resize(fNConfigs);
+    fUseITSRefitTracks.resize(fNConfigs); fMaxChi2PerCluster.resize(fNConfigs);
+    fMinTrackLength.resize(fNConfigs); fUseParametricLength.resize(fNConfigs);
+    f276TeVLikedEdx.resize(fNConfigs); fAtLeastOneTOF.resize(fNConfigs);
+    fIsCowboy.resize(fNConfigs); fMinCrossedRowsOverLength.resize(fNConfigs); fITSorTOF.resize(fNConfigs);
+    fVarV0CosPAPar.clear();
+
+    for(Long_t ipos=0; ipos<fNConfigs; ipos++){
+        AliV0Result *lV0Result = fResults[fOrder[ipos]];
+        fMinEtaTracks[ipos]   = lV0Result->GetCutMinEtaTracks();
+        fMaxEtaTracks[ipos]   = lV0Result->GetCutMaxEtaTracks();
+        fMinRapidity[ipos]    = lV0Result->GetCutMinRapidity();
+        fMaxRapidity[ipos]    = lV0Result->GetCutMaxRapidity();
+        fV0Radius[ipos]       = lV0Result->GetCutV0Radius();
+        fMaxV0Radius[ipos]    = lV0Result->GetCutMaxV0Radius();
+        fDCANegToPV[ipos]     = lV0Result->GetCutDCANegToPV();
+        fDCAPosToPV[ipos]     = lV0Result->GetCutDCAPosToPV();
+        fDCAV0Daughters[ipos] = lV0Result->GetCutDCAV0Daughters();
+        fV0CosPA[ipos]        = lV0Result->GetCutV0CosPA();
+        fProperLifetime[ipos] = lV0Result->GetCutProperLifetime();
+        fLeastNumberOfCrossedRows[ipos]             = lV0Result->GetCutLeastNumberOfCrossedRows();
+        fLeastNumberOfCrossedRowsOverFindable[ipos] = lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable();
+        fMinBaryonMomentum[ipos]   = lV0Result->GetCutMinBaryonMomentum();
+        fTPCdEdx[ipos]             = lV0Result->GetCutTPCdEdx();
+        fArmenteros[ipos]          = lV0Result->GetCutArmenteros();
+        fArmenterosParameter[ipos] = lV0Result->GetCutArmenterosParameter();
+        fUseITSRefitTracks[ipos]   = lV0Result->GetCutUseITSRefitTracks();
+        fMaxChi2PerCluster[ipos]   = lV0Result->GetCutMaxChi2PerCluster();
+        fMinTrackLength[ipos]      = lV0Result->GetCutMinTrackLength();
+        fUseParametricLength[ipos] = lV0Result->GetCutUseParametricLength();
+        f276TeVLikedEdx[ipos]      = lV0Result->GetCut276TeVLikedEdx();
+        fAtLeastOneTOF[ipos]       = lV0Result->GetCutAtLeastOneTOF();
+        fIsCowboy[ipos]            = lV0Result->GetCutIsCowboy();
+        fMinCrossedRowsOverLength[ipos] = lV0Result->GetCutMinCrossedRowsOverLength();
+        fITSorTOF[ipos]            = lV0Result->GetCutITSorTOF();
+
+        //Variable V0 CosPA: share identical parametrizations
+        fVarV0CosPASet[ipos] = -1;
+        if( lV0Result->GetCutUseVarV0CosPA() ){
+            Float_t lPar[5];
+            lPar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+            lPar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+            lPar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+            lPar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+            lPar[4] = lV0Result->GetCutVarV0CosPAConst();
+            Int_t lNSets = fVarV0CosPAPar.size()/5;
+            for(Int_t iset=0; iset<lNSets && fVarV0CosPASet[ipos]<0; iset++){
+                Bool_t lSame = kTRUE;
+                for(Int_t ip=0; ip<5; ip++) if( fVarV0CosPAPar[5*iset+ip] != lPar[ip] ) lSame = kFALSE;
+                if( lSame ) fVarV0CosPASet[ipos] = iset;
+            }
+            if( fVarV0CosPASet[ipos]<0 ){
+                fVarV0CosPASet[ipos] = lNSets;
+                for(Int_t ip=0; ip<5; ip++) fVarV0CosPAPar.push_back(lPar[ip]);
+            }
+        }
+    }
+    fVarV0CosPAValue.resize(fVarV0CosPAPar.size()/5);
+    fPass.resize(fNConfigs);
+    fHitMask.assign(fNConfigs, 0);
+    fHits.resize(fNConfigs);
+
+    AliInfo(Form("Indexed %li V0 configurations, %li distinct variable CosPA parametrizations", fNConfigs, (Long_t) fVarV0CosPAValue.size()));
+}
+
+//________________________________________________________________
+Long_t AliV0ResultIndex::Evaluate( const Candidate &lCand )
+{
+    // Test the candidate against all configurations. The hit mask and
+    // list of hits are available via GetHitMask() and GetHits().
+    for(Long_t icfg=0; icfg<fNConfigs; icfg++) fHitMask[icfg] = 0;
+    Long_t lNHits = 0;
+
+    //Check 1: Offline Vertexer -- only one group per mass hypothesis can match
+    if( lCand.fOnFlyStatus != 0 && lCand.fOnFlyStatus != 1 ) return 0;
+
+    //Variable V0 CosPA, once per distinct parametrization
+    for(UInt_t iset=0; iset<fVarV0CosPAValue.size(); iset++){
+        const Float_t *lPar = &fVarV0CosPAPar[5*iset];
+        fVarV0CosPAValue[iset] = TMath::Cos(
+                                            lPar[0]*TMath::Exp(lPar[1]*lCand.fPt) +
+                                            lPar[2]*TMath::Exp(lPar[3]*lCand.fPt) +
+                                            lPar[4]);
+    }
+
+    //Parametric track length shift, common to all configurations
+    const Double_t lLengthShiftPt     = TMath::Power(1/(lCand.fPt+1e-6),1.5);
+    const Double_t lLengthShiftRadius = TMath::Max(lCand.fV0Radius-85., 0.);
+
+    for(Int_t lHypo=0; lHypo<3; lHypo++){
+        const Int_t lGroup = GroupOf(lHypo, lCand.fOnFlyStatus);
+        const Int_t lFirst = fGroupStart[lGroup];
+        const Int_t lLast  = fGroupStart[lGroup+1];
+        if( lFirst == lLast ) continue;
+
+        //Candidate values for this hypothesis
+        const Bool_t  lIsK0Short = (lHypo == AliV0Result::kK0Short);
+        const Float_t lRap       = lCand.fRap[lHypo];
+        const Float_t lLifetime  = lCand.fDistOverTotMom*lCand.fPDGMass[lHypo];
+        const Float_t lNegdEdx   = TMath::Abs(lCand.fNegdEdx[lHypo]);
+        const Float_t lPosdEdx   = TMath::Abs(lCand.fPosdEdx[lHypo]);
+        const Float_t lBaryonMom = lCand.fBaryonMomentum[lHypo];
+        const Bool_t  l276dEdxOK = lIsK0Short || lCand.fBaryonPt[lHypo] > 1.0 || TMath::Abs(lCand.fBaryondEdxFromProton[lHypo])<3.0;
+        const Float_t lAbsAlpha  = TMath::Abs(lCand.fAlphaV0);
+
+        //Branch-free pass over the configurations of the group
+        for(Int_t ipos=lFirst; ipos<lLast; ipos++){
+            Float_t lV0CosPACut = fV0CosPA[ipos];
+            if( fVarV0CosPASet[ipos] >= 0 ){
+                //Only use if tighter than the non-variable cut
+                const Float_t lVarV0CosPA = fVarV0CosPAValue[fVarV0CosPASet[ipos]];
+                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+            }
+            const Bool_t lLengthOK =
+            fMinTrackLength[ipos]<0 ||
+            (lCand.fMinTrackLength > fMinTrackLength[ipos] && !fUseParametricLength[ipos]) ||
+            (lCand.fMinTrackLength > fMinTrackLength[ipos] - lLengthShiftPt - lLengthShiftRadius && fUseParametricLength[ipos]);
+
+            fPass[ipos] =
+            //Check 2: Basic Acceptance cuts
+            (fMinEtaTracks[ipos] < lCand.fNegEta) & (lCand.fNegEta < fMaxEtaTracks[ipos]) &
+            (fMinEtaTracks[ipos] < lCand.fPosEta) & (lCand.fPosEta < fMaxEtaTracks[ipos]) &
+            (lRap > fMinRapidity[ipos]) & (lRap < fMaxRapidity[ipos]) &
+            //Check 3: Topological Variables
+            (lCand.fV0Radius > fV0Radius[ipos]) & (lCand.fV0Radius < fMaxV0Radius[ipos]) &
+            (lCand.fDcaNegToPrimVertex > fDCANegToPV[ipos]) &
+            (lCand.fDcaPosToPrimVertex > fDCAPosToPV[ipos]) &
+            (lCand.fDcaV0Daughters < fDCAV0Daughters[ipos]) &
+            (lCand.fV0CosineOfPointingAngle > lV0CosPACut) &
+            (lLifetime < fProperLifetime[ipos]) &
+            (lCand.fLeastNbrCrossedRows > fLeastNumberOfCrossedRows[ipos]) &
+            (lCand.fLeastRatioCrossedRowsOverFindable > fLeastNumberOfCrossedRowsOverFindable[ipos]) &
+            //Check 4: Minimum momentum of baryon daughter
+            (lIsK0Short | (lBaryonMom > fMinBaryonMomentum[ipos])) &
+            //Check 5: TPC dEdx selections
+            (lNegdEdx < fTPCdEdx[ipos]) & (lPosdEdx < fTPCdEdx[ipos]) &
+            //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+            (!fArmenteros[ipos] | !lIsK0Short | (lCand.fPtArmV0 > fArmenterosParameter[ipos]*lAbsAlpha)) &
+            //Check 7: kITSrefit track selection if requested
+            (lCand.fBothITSrefit | !fUseITSRefitTracks[ipos]) &
+            //Check 8: Max Chi2/Clusters if not absurd
+            ((fMaxChi2PerCluster[ipos]>1e+3) | (lCand.fMaxChi2PerCluster < fMaxChi2PerCluster[ipos])) &
+            //Check 9: Min Track Length if positive
+            lLengthOK &
+            //Check 10: Special 2.76TeV-like dedx
+            (!f276TeVLikedEdx[ipos] | l276dEdxOK) &
+            //Check 14: has at least one track with some TOF info
+            (!fAtLeastOneTOF[ipos] | lCand.fAtLeastOneTOF) &
+            //Check 15: cowboy/sailor for V0
+            ((fIsCowboy[ipos]==0) | ((fIsCowboy[ipos]==1) & lCand.fIsCowboy) | ((fIsCowboy[ipos]==-1) & !lCand.fIsCowboy)) &
+            //Check 16: modern track quality selections
+            ((fMinCrossedRowsOverLength[ipos]<0) | (lCand.fLeastNcrOverLength > fMinCrossedRowsOverLength[ipos])) &
+            //Check 17: ITS or TOF required
+            (!fITSorTOF[ipos] | lCand.fITSorTOF);
+        }
+        for(Int_t ipos=lFirst; ipos<lLast; ipos++){
+            if( !fPass[ipos] ) continue;
+            fHitMask[fOrder[ipos]] = 1;
+            fHits[lNHits++] = fOrder[ipos];
+        }
+    }
+    return lNHits;
+}
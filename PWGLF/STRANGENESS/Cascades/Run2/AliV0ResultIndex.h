@@ -0,0 +1,127 @@
+#ifndef AliV0ResultIndex_H
+#define AliV0ResultIndex_H
+#include <TObject.h>
+#include <vector>
+
+class TList;
+class AliV0Result;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Precompiled index of AliV0Result configurations
+//
+// The cut values of all configurations are packed once into flat
+// arrays (one array per cut, structure-of-arrays), grouped by mass
+// hypothesis and on-the-fly status. A candidate is then tested against
+// all configurations of its group in one branch-free loop that
+// produces a hit mask. Configurations of the other groups fail as a
+// whole without being looked at. Distinct variable-CosPA
+// parametrizations are evaluated once per candidate.
+//
+// The selections are the same as those of the superlight output mode
+// of AliAnalysisTaskStrangenessVsMultiplicityRun2.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliV0ResultIndex : public TObject {
+
+public:
+    //Candidate properties needed by the selections
+    //Arrays are indexed by AliV0Result::EMassHypo
+    struct Candidate {
+        Int_t    fOnFlyStatus;
+        Float_t  fPt;
+        Float_t  fNegEta;
+        Float_t  fPosEta;
+        Float_t  fV0Radius;
+        Float_t  fDcaNegToPrimVertex;
+        Float_t  fDcaPosToPrimVertex;
+        Float_t  fDcaV0Daughters;
+        Float_t  fV0CosineOfPointingAngle;
+        Float_t  fDistOverTotMom;
+        Int_t    fLeastNbrCrossedRows;
+        Float_t  fLeastRatioCrossedRowsOverFindable;
+        Float_t  fPtArmV0;
+        Float_t  fAlphaV0;
+        Bool_t   fBothITSrefit;
+        Float_t  fMaxChi2PerCluster;
+        Float_t  fMinTrackLength;
+        Bool_t   fAtLeastOneTOF;
+        Bool_t   fIsCowboy;
+        Float_t  fLeastNcrOverLength;
+        Bool_t   fITSorTOF;
+        Float_t  fRap[3];
+        Float_t  fPDGMass[3];
+        Float_t  fNegdEdx[3];
+        Float_t  fPosdEdx[3];
+        Float_t  fBaryonMomentum[3];
+        Float_t  fBaryonPt[3];
+        Float_t  fBaryondEdxFromProton[3];
+    };
+
+    AliV0ResultIndex();
+    ~AliV0ResultIndex();
+
+    //Pack the configurations of the lists, in this order
+    void Build( TList *lK0Short, TList *lLambda, TList *lAntiLambda );
+
+    //Test a candidate against all configurations, returns number of hits
+    Long_t Evaluate( const Candidate &lCand );
+
+    Long_t GetNConfigurations() const { return fResults.size(); }
+    AliV0Result* GetResult(Long_t lcfg) const { return fResults[lcfg]; }
+    //Hit mask of the last Evaluate, in configuration order
+    const UChar_t* GetHitMask() const { return fNConfigs ? &fHitMask[0] : 0x0; }
+    //Configurations that passed in the last Evaluate
+    const Int_t* GetHits() const { return fNConfigs ? &fHits[0] : 0x0; }
+
+private:
+    Int_t GroupOf(Int_t lMassHypo, Int_t lOnFly) const { return 2*lMassHypo+lOnFly; }
+
+    Long_t fNConfigs; //! number of configurations
+    std::vector<AliV0Result*> fResults; //! configurations, original order
+    std::vector<Int_t> fGroupStart; //! first packed position of each group, one more than groups
+    std::vector<Int_t> fOrder;      //! packed position -> configuration
+
+    //Packed cuts
+    std::vector<Double_t> fMinEtaTracks; //!
+    std::vector<Double_t> fMaxEtaTracks; //!
+    std::vector<Double_t> fMinRapidity; //!
+    std::vector<Double_t> fMaxRapidity; //!
+    std::vector<Double_t> fV0Radius; //!
+    std::vector<Double_t> fMaxV0Radius; //!
+    std::vector<Double_t> fDCANegToPV; //!
+    std::vector<Double_t> fDCAPosToPV; //!
+    std::vector<Double_t> fDCAV0Daughters; //!
+    std::vector<Float_t>  fV0CosPA; //!
+    std::vector<Int_t>    fVarV0CosPASet; //! index in fVarV0CosPAPar, -1 if not used
+    std::vector<Double_t> fProperLifetime; //!
+    std::vector<Double_t> fLeastNumberOfCrossedRows; //!
+    std::vector<Double_t> fLeastNumberOfCrossedRowsOverFindable; //!
+    std::vector<Double_t> fMinBaryonMomentum; //!
+    std::vector<Double_t> fTPCdEdx; //!
+    std::vector<UChar_t>  fArmenteros; //!
+    std::vector<Double_t> fArmenterosParameter; //!
+    std::vector<UChar_t>  fUseITSRefitTracks; //!
+    std::vector<Double_t> fMaxChi2PerCluster; //!
+    std::vector<Double_t> fMinTrackLength; //!
+    std::vector<UChar_t>  fUseParametricLength; //!
+    std::vector<UChar_t>  f276TeVLikedEdx; //!
+    std::vector<UChar_t>  fAtLeastOneTOF; //!
+    std::vector<Int_t>    fIsCowboy; //!
+    std::vector<Double_t> fMinCrossedRowsOverLength; //!
+    std::vector<UChar_t>  fITSorTOF; //!
+
+    //Distinct variable CosPA parametrizations, 5 parameters each
+    std::vector<Float_t>  fVarV0CosPAPar; //!
+    std::vector<Float_t>  fVarV0CosPAValue; //! per candidate
+
+    //Output
+    std::vector<UChar_t>  fPass;    //! per packed position
+    std::vector<UChar_t>  fHitMask; //! per configuration
+    std::vector<Int_t>    fHits; //!
+
+    AliV0ResultIndex(const AliV0ResultIndex&);            // not implemented
+    AliV0ResultIndex& operator=(const AliV0ResultIndex&); // not implemented
+
+    ClassDef(AliV0ResultIndex, 1);
+};
+#endif
@@ -54,7 +54,10 @@
 #pragma link C++ class AliV0vertexerUncheckedCharges+;
 #pragma link C++ class AliVWeakResult+;
 #pragma link C++ class AliV0Result+;
+#pragma link C++ class AliV0ResultIndex+;
+#pragma link C++ class AliV0HelixIndex+;
 #pragma link C++ class AliCascadeResult+;
+#pragma link C++ class AliCascadeResultIndex+;
 #pragma link C++ class AliStrangenessModule+;
 #pragma link C++ class AliAnalysisTaskWeakDecayVertexer+;
 #pragma link C++ class AliAnalysisTaskStrEffStudy+;
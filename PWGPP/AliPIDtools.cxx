@@ -13,6 +13,20 @@ std::map<Int_t, AliPIDResponse *> AliPIDtools::pidAll;        /// we should use
 AliESDtrack  AliPIDtools::dummyTrack;/// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global variable t avoid object constructions
 TTree *       AliPIDtools::fFilteredTree = NULL;
 TTree *       AliPIDtools::fFilteredTreeV0 = NULL;
+TTree *       AliPIDtools::fLoadedTree[2] = {NULL, NULL};
+Long64_t      AliPIDtools::fLoadedEntry[2] = {-1, -1};
+Int_t         AliPIDtools::fLoadedTreeNumber[2] = {-1, -1};
+AliTPCPIDResponse * AliPIDtools::fEventInfoPID = NULL;
+TTree *       AliPIDtools::fEventInfoTree = NULL;
+Long64_t      AliPIDtools::fEventInfoEntry = -1;
+Bool_t        AliPIDtools::fEventInfoPileUp = kFALSE;
+Int_t         AliPIDtools::fCacheHash = 0;
+Int_t         AliPIDtools::fCacheCorrMask = -1;
+Int_t         AliPIDtools::fCacheSource = -1;
+TTree *       AliPIDtools::fCacheTree = NULL;
+Long64_t      AliPIDtools::fCacheFirstEntry = 0;
+Long64_t      AliPIDtools::fCacheNEntries = 0;
+std::vector<Double_t> AliPIDtools::fCacheData;
 
 AliPIDResponse* AliPIDtools::GetPID(Int_t hash ) {return pidAll[hash];}
 AliTPCPIDResponse& AliPIDtools::GetTPCPID(Int_t hash ) {return pidAll[hash]->GetTPCResponse();}
@@ -125,6 +139,7 @@ Bool_t AliPIDtools::SetFilteredTree(TTree * filteredTree){
     return kFALSE;
   }
   fFilteredTree=filteredTree;
+  ResetPIDCache();
   return kTRUE;
 }
 
@@ -137,9 +152,41 @@ Bool_t AliPIDtools::SetFilteredTreeV0(TTree * filteredTreeV0){
     return kFALSE;
   }
   fFilteredTreeV0=filteredTreeV0;
+  ResetPIDCache();
   return kTRUE;
 }
 
+/// Load the current entry of the filtered tree (fFilteredTree or fFilteredTreeV0)
+/// The full entry is read only once - further calls for the same entry, e.g. from several
+/// TTreeFormula expressions of one Draw, use the content already in the branch buffers
+/// \param tree   - filtered tree
+/// \return       - kTRUE if the entry was read
+Bool_t AliPIDtools::LoadCurrentEntry(TTree * tree){
+  Int_t slot = (tree==fFilteredTreeV0) ? 1:0;
+  Long64_t entry = tree->GetReadEntry();
+  if (tree==fLoadedTree[slot] && entry==fLoadedEntry[slot] && tree->GetTreeNumber()==fLoadedTreeNumber[slot]) return kFALSE;
+  tree->GetEntry(entry);
+  fLoadedTree[slot]=tree;
+  fLoadedEntry[slot]=entry;
+  fLoadedTreeNumber[slot]=tree->GetTreeNumber();
+  return kTRUE;
+}
+
+/// Check if the TPC event properties (multiplicity and optionally pile-up) of tpcPID were already set
+/// by SetTPCEventInfo/SetTPCEventInfoV0 for the given tree entry
+Bool_t AliPIDtools::IsEventInfoSet(AliTPCPIDResponse *tpcPID, TTree *tree, Long64_t entry, Bool_t corrPileUp){
+  if (tpcPID!=fEventInfoPID || tree!=fEventInfoTree || entry!=fEventInfoEntry) return kFALSE;
+  return fEventInfoPileUp || !corrPileUp;
+}
+
+/// Register TPC event properties set for the given tree entry, see IsEventInfoSet
+void AliPIDtools::SetEventInfo(AliTPCPIDResponse *tpcPID, TTree *tree, Long64_t entry, Bool_t corrPileUp){
+  fEventInfoPID=tpcPID;
+  fEventInfoTree=tree;
+  fEventInfoEntry=entry;
+  fEventInfoPileUp=corrPileUp;
+}
+
 
 
 
@@ -172,7 +219,7 @@ Double_t AliPIDtools::GetExpectedTPCSignal(Int_t hash, Int_t particleType, Int_t
     static TLeaf * leafPrim=0;
     static  Int_t treeNumber=-1;
     static TLeaf * leaftpcTrackBeforeClean=0;
-    fFilteredTree->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+    LoadCurrentEntry(fFilteredTree);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
     if (treeNumber!=fFilteredTree->GetTreeNumber()){
       branch=fFilteredTree->GetTree()->GetBranch("esdTrack.");
       if (fFilteredTree->GetFriend("E")) {
@@ -189,6 +236,7 @@ Double_t AliPIDtools::GetExpectedTPCSignal(Int_t hash, Int_t particleType, Int_t
       ppitsClustersPerLayer = (branchITS != NULL) ? (TVectorF **) (branchITS->GetAddress()) : NULL;
       SetPileUpProperties(**pptpcVertexInfo, **ppitsClustersPerLayer, leafPrim->GetValue(), tpcPID);
     }
+    fEventInfoPID=NULL;      // event properties of tpcPID are modified here, see SetTPCEventInfo
     if (corrMask==-1) return entry;
     if (corrMask==-2) return (*pptrack)->Pt();
     if (corrMask==-3) return treeNumber;
@@ -201,6 +249,7 @@ Double_t AliPIDtools::GetExpectedTPCSignal(Int_t hash, Int_t particleType, Int_t
   if (pptrack==0) return 0;
   if (corrMask==0x8) return tpcPID->GetPileupCorrectionValue(*pptrack);
   if (returnType==0) {
+    if (GetCachedPID(kCacheTPCExpected, hash, particleType, -1, corrMask, dEdx)) return dEdx;
     dEdx = tpcPID->GetExpectedSignal(*pptrack, (AliPID::EParticleType) particleType, AliTPCPIDResponse::kdEdxDefault, corrMask & kEtaCorr, corrMask & kMultCorr, corrMask & kPileUpCorr);
     return dEdx;
   }
@@ -237,7 +286,7 @@ Double_t AliPIDtools::GetExpectedTPCSignalV0(Int_t hash, Int_t particleType, Int
     static Int_t treeNumber=-1;
     static TLeaf * leafPrim=0;
     static TLeaf * leaftpcTrackBeforeClean=0;
-    fFilteredTreeV0->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+    LoadCurrentEntry(fFilteredTreeV0);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
     if (treeNumber!=fFilteredTreeV0->GetTreeNumber()){
       branch0=fFilteredTreeV0->GetTree()->GetBranch("track0.");
       branch1=fFilteredTreeV0->GetTree()->GetBranch("track1.");
@@ -255,6 +304,7 @@ Double_t AliPIDtools::GetExpectedTPCSignalV0(Int_t hash, Int_t particleType, Int
       ppitsClustersPerLayer = (branchITS != NULL) ? (TVectorF **) (branchITS->GetAddress()) : NULL;
       SetPileUpProperties(**pptpcVertexInfo, **ppitsClustersPerLayer, leafPrim->GetValue(), tpcPID);
     }
+    fEventInfoPID=NULL;      // event properties of tpcPID are modified here, see SetTPCEventInfo
     if (corrMask==-1) return entry;
     if (corrMask==-2) return (*pptrack)->Pt();
     if (corrMask==-3) return treeNumber;
@@ -265,6 +315,7 @@ Double_t AliPIDtools::GetExpectedTPCSignalV0(Int_t hash, Int_t particleType, Int
   if (pptrack==0) return 0;
   if (corrMask==0x8) return tpcPID->GetPileupCorrectionValue(*pptrack);
   if (returnType==0) {
+    if (GetCachedPID(kCacheTPCExpected, hash, particleType, (index==0) ? 0:1, corrMask, dEdx)) return dEdx;
     dEdx = tpcPID->GetExpectedSignal(*pptrack, (AliPID::EParticleType) particleType, AliTPCPIDResponse::kdEdxDefault, corrMask & kEtaCorr, corrMask & kMultCorr, corrMask & kPileUpCorr);
     return dEdx;
   }
@@ -295,16 +346,12 @@ AliESDtrack* AliPIDtools::GetCurrentTrack() {
   AliESDtrack **pptrack = 0;
   if (fFilteredTree) {  // data from filtered trees
     Int_t entry = fFilteredTree->GetReadEntry();
-    static Int_t lastEntry=-1;
     static TBranch *branch = NULL;
     static Int_t treeNumber = -1;
-    if (lastEntry!=entry) {
-      fFilteredTree->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain
-      if (treeNumber != fFilteredTree->GetTreeNumber()) {
-        branch = fFilteredTree->GetTree()->GetBranch("esdTrack.");
-        treeNumber = fFilteredTree->GetTreeNumber();
-      }
-      lastEntry=entry;
+    LoadCurrentEntry(fFilteredTree);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
+    if (treeNumber != fFilteredTree->GetTreeNumber()) {
+      branch = fFilteredTree->GetTree()->GetBranch("esdTrack.");
+      treeNumber = fFilteredTree->GetTreeNumber();
     }
     if (branch==NULL){
       ::Error("AliPIDtools::GetCurrentTrack","Branch does not exist, entry %d",entry);
@@ -321,7 +368,7 @@ AliESDtrack* AliPIDtools::GetCurrentTrackV0(Int_t index) {
     Int_t entry = fFilteredTreeV0->GetReadEntry();
     static TBranch *branch0, *branch1 = NULL;
     static Int_t treeNumber = -1;
-    fFilteredTreeV0->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+    LoadCurrentEntry(fFilteredTreeV0);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
     if (treeNumber != fFilteredTreeV0->GetTreeNumber()) {
       branch0 = fFilteredTreeV0->GetTree()->GetBranch("track0.");
       branch1 = fFilteredTreeV0->GetTree()->GetBranch("track1.");
@@ -347,7 +394,7 @@ TVectorD*     AliPIDtools::GetTOFInfo(Int_t infoType){
   Int_t entry = fFilteredTree->GetReadEntry();
   static TBranch *branchCl=NULL, *branchSigma = NULL;
   static Int_t treeNumber = -1;
-  fFilteredTree->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+  LoadCurrentEntry(fFilteredTree);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
   if (treeNumber != fFilteredTree->GetTreeNumber()) {
       branchCl = fFilteredTree->GetTree()->GetBranch("tofClInfo.");
       branchSigma = fFilteredTree->GetTree()->GetBranch("tofNsigma.");
@@ -369,7 +416,7 @@ TVectorD*     AliPIDtools::GetTOFInfoV0(Int_t source, Int_t infoType){
   static TBranch *branchCl0, *branchCl1 = NULL;
   static TBranch *branchSigma0, *branchSigma1 = NULL;
   static Int_t treeNumber = -1;
-  fFilteredTreeV0->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+  LoadCurrentEntry(fFilteredTreeV0);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
   if (treeNumber != fFilteredTreeV0->GetTreeNumber()) {
       branchCl0 = fFilteredTreeV0->GetTree()->GetBranch("tofClInfo0.");
       branchCl1 = fFilteredTreeV0->GetTree()->GetBranch("tofClInfo1.");
@@ -403,7 +450,7 @@ Bool_t       AliPIDtools::SetTPCEventInfo(Int_t pidHash,Int_t corrMaskTPC){
   static TLeaf * leaftpcTrackBeforeClean=0;
     static TLeaf *leafGID=0;
   static TLeaf *leafGIDEv=0;
-  fFilteredTree->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+  LoadCurrentEntry(fFilteredTree);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
   Bool_t reset= (branchVertex)? (branchVertex->GetTree() != fFilteredTree->GetTree()):kFALSE;
   if (reset||treeNumber!=fFilteredTree->GetTreeNumber()) {
     if (fFilteredTree->GetFriend("E")) {
@@ -425,12 +472,15 @@ Bool_t       AliPIDtools::SetTPCEventInfo(Int_t pidHash,Int_t corrMaskTPC){
     ::Error("AliPIDtools::SetTPCEventInfo", "invalid gid number Ev=%d, Tree= %d, gid0 =%llu gidEv=%llu",entry,treeNumber, gid0,gidEv);
     return kFALSE;
   }
-  if ((corrMaskTPC&kPileUpCorr)&& branchVertex!=NULL) {
+  Bool_t corrPileUp=(corrMaskTPC&kPileUpCorr)&& branchVertex!=NULL;
+  if (IsEventInfoSet(tpcPID,fFilteredTree,entry,corrPileUp)) return kTRUE;
+  if (corrPileUp) {
     pptpcVertexInfo = (branchVertex != NULL) ? (TVectorF **) (branchVertex->GetAddress()) : NULL;
     ppitsClustersPerLayer = (branchITS != NULL) ? (TVectorF **) (branchITS->GetAddress()) : NULL;
     SetPileUpProperties(**pptpcVertexInfo, **ppitsClustersPerLayer, leafPrim->GetValue(), tpcPID);
   }
   tpcPID->SetCurrentEventMultiplicity(leaftpcTrackBeforeClean->GetValue());
+  SetEventInfo(tpcPID,fFilteredTree,entry,corrPileUp);
   return kTRUE;
 }
 
@@ -454,7 +504,7 @@ Bool_t       AliPIDtools::SetTPCEventInfoV0(Int_t pidHash,Int_t corrMaskTPC){
   static TLeaf * leaftpcTrackBeforeClean=0;
   static TLeaf *leafGID=0;
   static TLeaf *leafGIDEv=0;
-  fFilteredTreeV0->GetEntry(entry);   // load full tree - branch GetEntry is loading only for fit file in TChain  //TODO fix
+  LoadCurrentEntry(fFilteredTreeV0);   // load full tree once per entry - branch GetEntry is loading only for fit file in TChain
   Bool_t reset= (branchVertex)? (branchVertex->GetTree() != fFilteredTreeV0->GetTree()):kFALSE;
   Int_t entryEv=0;
   TTree *treeEv=0;
@@ -482,13 +532,16 @@ Bool_t       AliPIDtools::SetTPCEventInfoV0(Int_t pidHash,Int_t corrMaskTPC){
   }else{
       //::Info("AliPIDtools::SetTPCEventInfoV0", "invalid gid number Ev=%d, Tree= %d",entry,treeNumber);
   }
-  if ((corrMaskTPC&kPileUpCorr)&& branchVertex!=NULL) {
+  Bool_t corrPileUp=(corrMaskTPC&kPileUpCorr)&& branchVertex!=NULL;
+  if (IsEventInfoSet(tpcPID,fFilteredTreeV0,entry,corrPileUp)) return kTRUE;
+  if (corrPileUp) {
     pptpcVertexInfo = (branchVertex != NULL) ? (TVectorF **) (branchVertex->GetAddress()) : NULL;
     ppitsClustersPerLayer = (branchITS != NULL) ? (TVectorF **) (branchITS->GetAddress()) : NULL;
     SetPileUpProperties(**pptpcVertexInfo, **ppitsClustersPerLayer, leafPrim->GetValue(), tpcPID);
   }
   Int_t tpcTrackBeforeClean=leaftpcTrackBeforeClean->GetValue();
   tpcPID->SetCurrentEventMultiplicity(tpcTrackBeforeClean);
+  SetEventInfo(tpcPID,fFilteredTreeV0,entry,corrPileUp);
   return kTRUE;
 }
 
@@ -540,6 +593,7 @@ Double_t AliPIDtools::GetITSPID(Int_t hash, Int_t particleType, Int_t valueType,
 Float_t AliPIDtools::NumberOfSigmas(Int_t hash, Int_t detCode, Int_t particleType, Int_t source, Int_t corrMask){
   if (pidAll[hash]==NULL) return 0;
   AliPIDResponse *pid = pidAll[hash];
+  const Int_t corrMaskQuery=corrMask;     // the PID cache is filled for explicit masks only
   //
   Int_t maskBackup=0;                     // make backup of PID state
   if (pid->UseTPCEtaCorrection()) maskBackup+=kEtaCorr;
@@ -570,7 +624,10 @@ Float_t AliPIDtools::NumberOfSigmas(Int_t hash, Int_t detCode, Int_t particleTyp
     if (source<0) return AliPIDtools::GetTOFInfoAt(1,particleType);
     if (source>=0) return AliPIDtools::GetTOFInfoV0At(source,1,particleType);
   }
-  Double_t value=pidAll[hash]->NumberOfSigmas((AliPIDResponse::EDetector) detCode, track, (AliPID::EParticleType)particleType);
+  Double_t value=0;
+  if (!GetCachedPID(kCacheNSigma+detCode, hash, particleType, source, corrMaskQuery, value)) {
+    value=pidAll[hash]->NumberOfSigmas((AliPIDResponse::EDetector) detCode, track, (AliPID::EParticleType)particleType);
+  }
   // restore flags
   pid->SetUseTPCEtaCorrection(kEtaCorr&maskBackup);
   pid->SetUseTPCMultiplicityCorrection(maskBackup&kMultCorr);
@@ -781,6 +838,142 @@ Float_t AliPIDtools::ComputePIDProbabilityCombinedMask(Int_t hash, Int_t detMask
 
 
 
+/// Batched evaluation of PID quantities for an entry range of the filtered trees
+/// For each entry the tree is read once and the expected TPC signal and the number of sigmas
+/// of ITS, TPC and TRD are evaluated for all species, the results are kept in columnar buffers
+/// (one column per quantity, detector, species and V0 leg). GetExpectedTPCSignal(V0) with returnType 0
+/// and NumberOfSigmas called later with the same hash and corrMask return the cached values
+/// for entries in the range. The buffers can be exported with MakePIDCacheTree.
+/// TOF is not cached - NumberOfSigmas returns the tree values for it. HMPID and EMCAL need
+/// the event of the track (matched cluster), which is not available for the filtered trees.
+/// #### Example
+/// \code
+///  AliPIDtools::CachePID(pidHash,3,-1,0,100000);
+///  treeTrack->Draw("AliPIDtools::NumberOfSigmas(pidHash,1,2,-1,3)","AliPIDtools::NumberOfSigmas(pidHash,0,2,-1,3)<2","",100000);
+/// \endcode
+/// \param hash         - hash value of PID
+/// \param corrMask     - TPC correction mask (>=0) - see GetExpectedTPCSignal
+/// \param source       - <0 - fFilteredTree, >=0 - both legs of fFilteredTreeV0
+/// \param firstEntry   - first entry
+/// \param nEntries     - number of entries (-1 - up to the end of the tree)
+/// \param maxEntries   - max. number of cached entries - 0.3 kB per entry (0.6 kB for V0)
+/// \return             - number of cached entries
+Long64_t AliPIDtools::CachePID(Int_t hash, Int_t corrMask, Int_t source, Long64_t firstEntry, Long64_t nEntries, Long64_t maxEntries){
+  ResetPIDCache();
+  if (pidAll[hash]==NULL){
+    ::Error("AliPIDtools::CachePID","Invalid PID hash %d",hash);
+    return 0;
+  }
+  if (corrMask<0){
+    ::Error("AliPIDtools::CachePID","Invalid correction mask %d",corrMask);
+    return 0;
+  }
+  TTree * tree = (source<0) ? fFilteredTree:fFilteredTreeV0;
+  if (tree==NULL){
+    ::Error("AliPIDtools::CachePID","Non initialized tree");
+    return 0;
+  }
+  if (firstEntry<0) firstEntry=0;
+  Long64_t treeEntries=tree->GetEntries()-firstEntry;
+  if (nEntries<0 || nEntries>treeEntries) nEntries=treeEntries;
+  if (nEntries<=0) return 0;
+  if (nEntries>maxEntries){
+    ::Warning("AliPIDtools::CachePID","Cache limited to %lld entries, requested %lld - use several entry ranges",maxEntries,nEntries);
+    nEntries=maxEntries;
+  }
+  //
+  const Int_t nLegs = (source<0) ? 1:2;
+  const Int_t nColumns = nLegs*kCacheNTypes*AliPID::kSPECIESC;
+  std::vector<Double_t> data(nColumns*nEntries);
+  for (Long64_t iEntry=0; iEntry<nEntries; iEntry++){
+    tree->LoadTree(firstEntry+iEntry);
+    LoadCurrentEntry(tree);
+    for (Int_t iLeg=0; iLeg<nLegs; iLeg++){
+      Int_t legSource = (source<0) ? -1:iLeg;
+      for (Int_t iPID=0; iPID<AliPID::kSPECIESC; iPID++){
+        Double_t *column = &data[((iLeg*kCacheNTypes)*AliPID::kSPECIESC+iPID)*nEntries];
+        column[iEntry] = (source<0) ? GetExpectedTPCSignal(hash,iPID,corrMask,0) : GetExpectedTPCSignalV0(hash,iPID,corrMask,iLeg,0);
+        for (Int_t iDet=0; iDet<kCacheNDetectors; iDet++){
+          column = &data[((iLeg*kCacheNTypes+kCacheNSigma+iDet)*AliPID::kSPECIESC+iPID)*nEntries];
+          column[iEntry] = NumberOfSigmas(hash,iDet,iPID,legSource,corrMask);
+        }
+      }
+    }
+  }
+  // register only now - the values above are evaluated without cache
+  fCacheData.swap(data);
+  fCacheHash=hash;
+  fCacheCorrMask=corrMask;
+  fCacheSource=source;
+  fCacheTree=tree;
+  fCacheFirstEntry=firstEntry;
+  fCacheNEntries=nEntries;
+  return nEntries;
+}
+
+/// Clear the PID cache of CachePID and the entry/event caches of the TTree interface
+/// To be called if the trees or the PID objects are modified by the user
+void AliPIDtools::ResetPIDCache(){
+  fCacheData.clear();
+  fCacheTree=NULL;
+  fCacheNEntries=0;
+  for (Int_t i=0; i<2; i++){
+    fLoadedTree[i]=NULL;
+    fLoadedEntry[i]=-1;
+    fLoadedTreeNumber[i]=-1;
+  }
+  fEventInfoPID=NULL;
+}
+
+/// Cached value of a PID quantity for the current entry of the filtered tree
+/// \param type          - kCacheTPCExpected or kCacheNSigma+detCode
+/// \param source        - <0 - fFilteredTree, 0/1 - leg of fFilteredTreeV0
+/// \return              - kTRUE if the value is in the cache
+Bool_t AliPIDtools::GetCachedPID(Int_t type, Int_t hash, Int_t particleType, Int_t source, Int_t corrMask, Double_t &value){
+  if (fCacheData.empty() || hash!=fCacheHash || corrMask!=fCacheCorrMask) return kFALSE;
+  if (type<0 || type>=kCacheNTypes || particleType<0 || particleType>=AliPID::kSPECIESC || source>1) return kFALSE;
+  if ((source<0) != (fCacheSource<0)) return kFALSE;
+  TTree * tree = (source<0) ? fFilteredTree:fFilteredTreeV0;
+  if (tree!=fCacheTree) return kFALSE;
+  Long64_t iEntry=tree->GetReadEntry()-fCacheFirstEntry;
+  if (iEntry<0 || iEntry>=fCacheNEntries) return kFALSE;
+  Int_t iLeg = (source<0) ? 0:source;
+  value=fCacheData[((iLeg*kCacheNTypes+type)*AliPID::kSPECIESC+particleType)*fCacheNEntries+iEntry];
+  return kTRUE;
+}
+
+/// Export the PID cache of CachePID as a tree with one entry per cached entry, e.g. for RDataFrame
+/// or as a friend of the filtered tree if the cache starts at entry 0
+/// Branch names: expTPC<species>, nSigma<det>_<species>,
+/// for V0 legs expTPC<leg>_<species>, nSigma<leg>_<det>_<species>
+/// \param name      - name of the tree
+/// \return          - tree in memory, owned by the caller
+TTree * AliPIDtools::MakePIDCacheTree(const char *name){
+  if (fCacheData.empty()){
+    ::Error("AliPIDtools::MakePIDCacheTree","Empty cache - use CachePID");
+    return NULL;
+  }
+  const Int_t nLegs = (fCacheSource<0) ? 1:2;
+  const Int_t nColumns = nLegs*kCacheNTypes*AliPID::kSPECIESC;
+  std::vector<Double_t> row(nColumns);
+  TTree * tree = new TTree(name, Form("AliPIDtools cache hash=%d corrMask=%d",fCacheHash,fCacheCorrMask));
+  for (Int_t iLeg=0; iLeg<nLegs; iLeg++){
+    TString prefix = (fCacheSource<0) ? "":TString::Format("%d_",iLeg);
+    for (Int_t iType=0; iType<kCacheNTypes; iType++){
+      for (Int_t iPID=0; iPID<AliPID::kSPECIESC; iPID++){
+        TString bName = (iType==kCacheTPCExpected) ? TString::Format("expTPC%s%d",prefix.Data(),iPID) : TString::Format("nSigma%s%d_%d",prefix.Data(),iType-kCacheNSigma,iPID);
+        tree->Branch(bName.Data(), &row[(iLeg*kCacheNTypes+iType)*AliPID::kSPECIESC+iPID], (bName+"/D").Data());
+      }
+    }
+  }
+  for (Long64_t iEntry=0; iEntry<fCacheNEntries; iEntry++){
+    for (Int_t iColumn=0; iColumn<nColumns; iColumn++) row[iColumn]=fCacheData[iColumn*fCacheNEntries+iEntry];
+    tree->Fill();
+  }
+  tree->ResetBranchAddresses();
+  return tree;
+}
+
 /// Unit test of invariants - check internal consistency of wrappers
 void AliPIDtools::UnitTest() {
   Bool_t status=0;
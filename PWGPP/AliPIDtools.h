@@ -21,8 +21,16 @@
 /// #### Example 3: Draw Expected dEdx
 /// AliPIDtools::SetFilteredTreeV0(treeV0)
 /// treeV0->Draw("log(track0.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,0)))","type==1&&abs(log(track1.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,1))))<0.1","colz",20000)
+/// #### Example 4: Evaluate PID once for an entry range and use the cache in several queries
+/// \code
+///  AliPIDtools::CachePID(pidHash,3,-1,0,100000);
+///  treeTrack->Draw("AliPIDtools::NumberOfSigmas(pidHash,1,2,-1,3)","","",100000);   // cached values for the same hash and corrMask
+///  TTree *pidTree = AliPIDtools::MakePIDCacheTree("pid");            // columns for TTree::AddFriend or RDataFrame
+///  treeTrack->AddFriend(pidTree,"pid");
+/// \endcode
 
 #include "map"
+#include "vector"
 #include  "AliESDtrack.h"
 class AliPIDResponse;
 class AliTPCPIDResponse;
@@ -79,12 +87,35 @@ public:
   static Bool_t SetFilteredTreeV0(TTree * filteredTreeV0); /// set variable address in filtered trees
   //static Bool_t SetPileUpProperties(const TVectorF * tpcVertex, const TVectorF *itsMult, AliTPCPIDResponse *pidTPC);
   static Bool_t SetPileUpProperties(const TVectorF & tpcVertexInfo, const TVectorF &itsClustersPerLayer, Int_t primMult, AliTPCPIDResponse *pidTPC);
+  //  batched evaluation for an entry range - cache used by GetExpectedTPCSignal(V0) and NumberOfSigmas
+  static Long64_t CachePID(Int_t hash, Int_t corrMask=3, Int_t source=-1, Long64_t firstEntry=0, Long64_t nEntries=-1, Long64_t maxEntries=200000);
+  static void     ResetPIDCache();
+  static TTree *  MakePIDCacheTree(const char *name="pidCache");
   //
   static TTree *       fFilteredTree;  /// pointer to filteredTree
   static TTree *       fFilteredTreeV0;  /// pointer to filteredTree V0
   static void UnitTest();                       /// unit test of invariants
 private:
+  enum { kCacheNDetectors=3, kCacheTPCExpected=0, kCacheNSigma=1, kCacheNTypes=1+kCacheNDetectors };  /// cached quantities: expected TPC signal, nsigma for kITS, kTPC and kTRD
+  static Bool_t  LoadCurrentEntry(TTree * tree);
+  static Bool_t  IsEventInfoSet(AliTPCPIDResponse *tpcPID, TTree *tree, Long64_t entry, Bool_t corrPileUp);
+  static void    SetEventInfo(AliTPCPIDResponse *tpcPID, TTree *tree, Long64_t entry, Bool_t corrPileUp);
+  static Bool_t  GetCachedPID(Int_t type, Int_t hash, Int_t particleType, Int_t source, Int_t corrMask, Double_t &value);
   static AliESDtrack  dummyTrack;     /// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global varaible t avoid object constructions
+  static TTree *       fLoadedTree[2];        /// trees (filtered, V0) of the last loaded entries
+  static Long64_t      fLoadedEntry[2];       /// last loaded entries
+  static Int_t         fLoadedTreeNumber[2];  /// tree numbers of the last loaded entries
+  static AliTPCPIDResponse * fEventInfoPID;   /// TPC response with event properties set by SetTPCEventInfo(V0)
+  static TTree *       fEventInfoTree;        /// tree of the event properties
+  static Long64_t      fEventInfoEntry;       /// entry of the event properties
+  static Bool_t        fEventInfoPileUp;      /// pile-up properties set as well
+  static Int_t         fCacheHash;            /// PID hash of the cache
+  static Int_t         fCacheCorrMask;        /// TPC correction mask of the cache
+  static Int_t         fCacheSource;          /// <0 filtered tree, >=0 V0 tree
+  static TTree *       fCacheTree;            /// tree of the cache
+  static Long64_t      fCacheFirstEntry;      /// first cached entry
+  static Long64_t      fCacheNEntries;        /// number of cached entries
+  static std::vector<Double_t> fCacheData;    /// columnar buffer - column ((leg*kCacheNTypes+type)*kSPECIESC+species), fCacheNEntries values each
 
 };
 
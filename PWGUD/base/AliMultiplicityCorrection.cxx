@@ -37,6 +37,7 @@
 #include <TLegend.h>
 #include <TLine.h>
 #include <TRandom.h>
+#include <TRandom3.h>
 #include <TProfile.h>
 #include <TProfile2D.h>
 #include <AliLog.h>
@@ -98,7 +99,7 @@ void AliMultiplicityCorrection::SetQualityRegions(Bool_t SPDStudy)
 
 //____________________________________________________________________
 AliMultiplicityCorrection::AliMultiplicityCorrection() :
-  TNamed(), fCurrentESD(0), fCurrentCorrelation(0), fCurrentEfficiency(0), fLastBinLimit(0), fLastChi2MC(0), fLastChi2MCLimit(0), fLastChi2Residuals(0), fRatioAverage(0), fVtxBegin(0), fVtxEnd(0)
+  TNamed(), fCurrentESD(0), fCurrentCorrelation(0), fCurrentEfficiency(0), fLastBinLimit(0), fLastChi2MC(0), fLastChi2MCLimit(0), fLastChi2Residuals(0), fRatioAverage(0), fVtxBegin(0), fVtxEnd(0), fRandomSeed(0), fToyRandom(0)
 {
   //
   // default constructor
@@ -163,7 +164,9 @@ AliMultiplicityCorrection::AliMultiplicityCorrection(const Char_t* name, const C
   fLastChi2Residuals(0),
   fRatioAverage(0),
   fVtxBegin(0),
-  fVtxEnd(0)
+  fVtxEnd(0),
+  fRandomSeed(0),
+  fToyRandom(0)
 {
   //
   // named constructor
@@ -359,6 +362,9 @@ AliMultiplicityCorrection::~AliMultiplicityCorrection()
 
   Printf("AliMultiplicityCorrection::~AliMultiplicityCorrection called");
 
+  delete fToyRandom;
+  fToyRandom = 0;
+
   for (Int_t i = 0; i < kESDHists; ++i)
   {
     if (fMultiplicityESD[i])
@@ -785,6 +791,102 @@ void AliMultiplicityCorrection::SetupCurrentHists(Int_t inputRange, Bool_t fullP
   //fCurrentEfficiency->Scale(0.5);
 }
 
+//____________________________________________________________________
+void AliMultiplicityCorrection::HistToMatrix(const TH2* hist, TMatrixD& content)
+{
+  //
+  // copies the bin contents of hist into a dense matrix (row = x bin, column = y bin)
+  // under/overflow bins are included, i.e. element (i, j) is bin (i, j) of the histogram
+  //
+
+  Int_t nX = hist->GetNbinsX() + 2;
+  Int_t nY = hist->GetNbinsY() + 2;
+  content.ResizeTo(nX, nY);
+
+  for (Int_t i=0; i<nX; ++i)
+    for (Int_t j=0; j<nY; ++j)
+      content(i, j) = hist->GetBinContent(i, j);
+}
+
+//____________________________________________________________________
+void AliMultiplicityCorrection::MatrixToHist(const TMatrixD& content, TH2* hist)
+{
+  //
+  // copies a matrix filled by HistToMatrix back into hist
+  //
+
+  Double_t entries = hist->GetEntries();
+
+  for (Int_t i=0; i<content.GetNrows(); ++i)
+    for (Int_t j=0; j<content.GetNcols(); ++j)
+      hist->SetBinContent(i, j, content(i, j));
+
+  hist->SetEntries(entries);
+}
+
+//____________________________________________________________________
+void AliMultiplicityCorrection::NormalizeCurrentCorrelation(Bool_t toEfficiency)
+{
+  //
+  // normalizes the response for each true multiplicity (x bin) of fCurrentCorrelation
+  //   toEfficiency = kFALSE: to 1, empty bins are left as they are
+  //   toEfficiency = kTRUE: to fCurrentEfficiency, bins without efficiency are set to 0
+  //
+
+  for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
+  {
+    // with this it is normalized to 1
+    Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
+
+    if (toEfficiency)
+    {
+      // with this normalized to the given efficiency
+      if (fCurrentEfficiency->GetBinContent(i) > 0)
+        sum /= fCurrentEfficiency->GetBinContent(i);
+      else
+        sum = 0;
+    }
+    else if (sum <= 0)
+      continue;
+
+    for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
+    {
+      if (sum > 0)
+      {
+        fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
+        fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
+      }
+      else
+      {
+        fCurrentCorrelation->SetBinContent(i, j, 0);
+        fCurrentCorrelation->SetBinError(i, j, 0);
+      }
+    }
+  }
+}
+
+//____________________________________________________________________
+TRandom* AliMultiplicityCorrection::GetToyRandom(Int_t toy, Int_t retry)
+{
+  //
+  // returns the random generator for the randomized unfolding number <toy>
+  // without seed (see SetRandomSeed) this is gRandom, seeded with the current time by the caller
+  // otherwise each unfolding gets a generator seeded with fRandomSeed + toy, so that its input
+  // does not depend on the others and the error determination is reproducible
+  // <retry> counts the failed unfoldings of this toy, a retried toy is seeded with
+  // fRandomSeed + toy + retry * kToyRetrySeedStep to get a new input
+  //
+
+  if (fRandomSeed == 0)
+    return gRandom;
+
+  if (!fToyRandom)
+    fToyRandom = new TRandom3;
+  fToyRandom->SetSeed(fRandomSeed + toy + retry * kToyRetrySeedStep);
+
+  return fToyRandom;
+}
+
 //____________________________________________________________________
 TH1* AliMultiplicityCorrection::GetEfficiency(Int_t inputRange, EventType eventType)
 {
@@ -1463,7 +1565,8 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
   Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
 
   // initialize seed with current time
-  gRandom->SetSeed(0);
+  if (fRandomSeed == 0)
+    gRandom->SetSeed(0);
   
   if (methodType == AliUnfolding::kChi2Minimization)
   {
@@ -1480,11 +1583,37 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
   TH1** results = new TH1*[kErrorIterations];
 
+  // the input is projected once, each unfolding starts from a copy of it
+  // (the response is randomized and normalized in place, the efficiency may be changed by AliUnfolding)
+  SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+
+  TMatrixD correlation;
+  HistToMatrix(fCurrentCorrelation, correlation);
+  TArrayD correlationSumw2(*fCurrentCorrelation->GetSumw2());
+
+  Int_t nEfficiencyBins = fCurrentEfficiency->GetNbinsX() + 2;
+  TVectorD efficiency(nEfficiencyBins);
+  for (Int_t i=0; i<nEfficiencyBins; ++i)
+    efficiency[i] = fCurrentEfficiency->GetBinContent(i);
+  TArrayD efficiencySumw2(*fCurrentEfficiency->GetSumw2());
+
+  // the unfoldings are done one after the other: AliUnfolding keeps its configuration in
+  // static members and the chi2 method minimizes with the global Minuit instance
+  Int_t retry = 0;
   for (Int_t n=0; n<kErrorIterations; ++n)
   {
     Printf("Iteration %d of %d...", n, kErrorIterations);
 
-    SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+    if (n > 0 || retry > 0)
+    {
+      MatrixToHist(correlation, fCurrentCorrelation);
+      fCurrentCorrelation->GetSumw2()->Set(correlationSumw2.GetSize(), correlationSumw2.GetArray());
+
+      for (Int_t i=0; i<nEfficiencyBins; ++i)
+        fCurrentEfficiency->SetBinContent(i, efficiency[i]);
+      fCurrentEfficiency->GetSumw2()->Set(efficiencySumw2.GetSize(), efficiencySumw2.GetArray());
+    }
+    TRandom* random = GetToyRandom(n, retry);
 
     TH1* measured = (TH1*) fCurrentESD->Clone("measured");
 
@@ -1495,7 +1624,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
         // randomize response matrix
         for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
           for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-            fCurrentCorrelation->SetBinContent(i, j, gRandom->Poisson(fCurrentCorrelation->GetBinContent(i, j)));
+            fCurrentCorrelation->SetBinContent(i, j, random->Poisson(correlation(i, j)));
       }
 
       if (randomizeMeasured)
@@ -1503,7 +1632,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
         // randomize measured spectrum
         for (Int_t x=1; x<=measured->GetNbinsX(); x++) // mult. axis
         {
-          Int_t randomValue = gRandom->Poisson(fCurrentESD->GetBinContent(x));
+          Int_t randomValue = random->Poisson(fCurrentESD->GetBinContent(x));
           measured->SetBinContent(x, randomValue);
           measured->SetBinError(x, TMath::Sqrt(randomValue));
         }
@@ -1512,33 +1641,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
     // only for bayesian method we have to do it before the call to Unfold...
     if (methodType == AliUnfolding::kBayesian)
-    {
-      for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-      {
-        // with this it is normalized to 1
-        Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
-
-        // with this normalized to the given efficiency
-        if (fCurrentEfficiency->GetBinContent(i) > 0)
-          sum /= fCurrentEfficiency->GetBinContent(i);
-        else
-          sum = 0;
-
-        for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-        {
-          if (sum > 0)
-          {
-            fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
-            fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
-          }
-          else
-          {
-            fCurrentCorrelation->SetBinContent(i, j, 0);
-            fCurrentCorrelation->SetBinError(i, j, 0);
-          }
-        }
-      }
-    }
+      NormalizeCurrentCorrelation(kTRUE);
 
     TH1* result = 0;
     if (n == 0 && compareTo)
@@ -1555,10 +1658,12 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
       if (returnCode != 0)
       {
+	++retry;
 	n--;
 	continue;
       }
     }
+    retry = 0;
 
     // normalize
     result->Scale(1.0 / result->Integral());
@@ -1709,36 +1814,13 @@ void AliMultiplicityCorrection::ApplyBayesianMethod(Int_t inputRange, Bool_t ful
   //   2 = with UnfoldGetBias
 
   // initialize seed with current time
-  gRandom->SetSeed(0);
+  if (fRandomSeed == 0)
+    gRandom->SetSeed(0);
 
   SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
 
   // normalize correction for given nPart
-  for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-  {
-    // with this it is normalized to 1
-    Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
-
-    // with this normalized to the given efficiency
-    if (fCurrentEfficiency->GetBinContent(i) > 0)
-      sum /= fCurrentEfficiency->GetBinContent(i);
-    else
-      sum = 0;
-
-    for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-    {
-      if (sum > 0)
-      {
-        fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
-        fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
-      }
-      else
-      {
-        fCurrentCorrelation->SetBinContent(i, j, 0);
-        fCurrentCorrelation->SetBinError(i, j, 0);
-      }
-    }
-  }
+  NormalizeCurrentCorrelation(kTRUE);
 
   Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
 
@@ -1773,12 +1855,15 @@ void AliMultiplicityCorrection::ApplyBayesianMethod(Int_t inputRange, Bool_t ful
 
   TH1* randomized = (TH1*) fCurrentESD->Clone("randomized");
   TH1* resultArray[kErrorIterations+1];
+  Int_t retry = 0;
   for (Int_t n=0; n<kErrorIterations; ++n)
   {
+    TRandom* random = GetToyRandom(n, retry);
+
     // randomize the content of clone following a poisson with the mean = the value of that bin
     for (Int_t x=1; x<=randomized->GetNbinsX(); x++) // mult. axis
     {
-      Int_t randomValue = gRandom->Poisson(fCurrentESD->GetBinContent(x));
+      Int_t randomValue = random->Poisson(fCurrentESD->GetBinContent(x));
       //printf("%d --> %d\n", fCurrentESD->GetBinContent(x), randomValue);
       randomized->SetBinContent(x, randomValue);
       randomized->SetBinError(x, TMath::Sqrt(randomValue));
@@ -1788,9 +1873,11 @@ void AliMultiplicityCorrection::ApplyBayesianMethod(Int_t inputRange, Bool_t ful
     result2->Reset();
     if (AliUnfolding::Unfold(fCurrentCorrelation, fCurrentEfficiency, randomized, initialConditions, result2) != 0)
     {
+      ++retry;
       n--;
       continue;
     }
+    retry = 0;
 
     resultArray[n+1] = result2;
   }
@@ -1854,20 +1941,8 @@ void AliMultiplicityCorrection::ApplyLaszloMethod(Int_t inputRange, Bool_t fullP
   // TODO should be taken from correlation map
   //TH1* sumHist = GetMultiplicityMC(inputRange, eventType)->ProjectionY("sumHist", 1, GetMultiplicityMC(inputRange, eventType)->GetNbinsX());
 
-  // normalize correction for given nPart
-  for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-  {
-    Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
-    //Double_t sum = sumHist->GetBinContent(i);
-    if (sum <= 0)
-      continue;
-    for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-    {
-      // npart sum to 1
-      fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
-      fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
-    }
-  }
+  // normalize correction for given nPart, npart sum to 1
+  NormalizeCurrentCorrelation(kFALSE);
 
   new TCanvas;
   fCurrentCorrelation->Draw("COLZ");
@@ -1891,17 +1966,32 @@ void AliMultiplicityCorrection::ApplyLaszloMethod(Int_t inputRange, Bool_t fullP
   // just a shortcut
   TH2F* hResponse = (TH2F*) fCurrentCorrelation;
 
+  // the response does not change during the iterations: fold with a dense copy
+  // stored transposed (row = measured bin) so that the inner loop runs over contiguous elements
+  Int_t nTrue = hResponse->GetNbinsX();
+  Int_t nMeasured = hResponse->GetNbinsY();
+  TMatrixD content;
+  HistToMatrix(hResponse, content);
+  TMatrixD response(TMatrixD::kTransposed, content);
+  const Double_t* responseArray = response.GetMatrixArray();
+  Int_t responseColumns = response.GetNcols();
+  TVectorD prior(nTrue + 1);
+
   // unfold...
   Int_t iterations = 25;
   for (Int_t i=0; i<iterations; i++)
   {
     //printf(" iteration %i \n", i);
 
-    for (Int_t m=1; m<=hResponse->GetNbinsY(); m++)
+    for (Int_t t = 1; t<=nTrue; t++)
+      prior[t] = hPrior->GetBinContent(t);
+
+    for (Int_t m=1; m<=nMeasured; m++)
     {
+      const Double_t* row = responseArray + m * responseColumns;
       Float_t value = 0;
-      for (Int_t t = 1; t<=hResponse->GetNbinsX(); t++)
-        value += hResponse->GetBinContent(t, m) * hPrior->GetBinContent(t);
+      for (Int_t t = 1; t<=nTrue; t++)
+        value += row[t] * prior[t];
       hTemp->SetBinContent(m, value);
       //printf("%d %f %f %f\n", m, zero->GetBinContent(m), hPrior->GetBinContent(m), value);
     }
@@ -18,6 +18,7 @@ class TH2F;
 class TH3F;
 class TF1;
 class TCollection;
+class TRandom;
 
 // defined here, because it does not seem possible to predeclare these (or i do not know how)
 // -->
@@ -33,6 +34,7 @@ class AliMultiplicityCorrection : public TNamed {
   public:
     enum EventType { kTrVtx = 0, kMB, kINEL, kNSD };
     enum { kESDHists = 3, kMCHists = 4, kCorrHists = 6, kQualityRegions = 3 };
+    enum { kToyRetrySeedStep = 1000 }; // seed offset of a retried randomized unfolding, larger than the number of unfoldings
 
     AliMultiplicityCorrection();
     AliMultiplicityCorrection(const Char_t* name, const Char_t* title);
@@ -117,8 +119,18 @@ class AliMultiplicityCorrection : public TNamed {
     
     void SetVertexRange(Int_t begin, Int_t end) { fVtxBegin = begin; fVtxEnd = end; }
 
+    // seed of the randomized unfoldings for the error determination, 0 = current time (default)
+    // with a seed > 0 each unfolding n uses its own generator seeded with seed + n and the errors are reproducible
+    // (an unfolding that fails is repeated with seed + n + retry * kToyRetrySeedStep)
+    void SetRandomSeed(UInt_t seed) { fRandomSeed = seed; }
+
   protected:
     void SetupCurrentHists(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType);
+    void NormalizeCurrentCorrelation(Bool_t toEfficiency);
+    TRandom* GetToyRandom(Int_t toy, Int_t retry);
+
+    static void HistToMatrix(const TH2* hist, TMatrixD& content);
+    static void MatrixToHist(const TMatrixD& content, TH2* hist);
 
     Float_t BayesCovarianceDerivate(Float_t matrixM[251][251], const TH2* hResponse, Int_t k, Int_t i, Int_t r, Int_t u);
     
@@ -147,6 +159,9 @@ class AliMultiplicityCorrection : public TNamed {
     
     Int_t fVtxBegin;            //! vertex range for analysis
     Int_t fVtxEnd;              //! vertex range for analysis
+
+    UInt_t fRandomSeed;         //! seed for the error determination, see SetRandomSeed
+    TRandom* fToyRandom;        //! generator of the randomized unfoldings if fRandomSeed > 0
     
     static Double_t fgVtxRangeBegin[kESDHists]; //! begin of allowed vertex range for this eta bin
     static Double_t fgVtxRangeEnd[kESDHists];   //! end of allowed vertex range for this eta bin
@@ -159,7 +174,7 @@ class AliMultiplicityCorrection : public TNamed {
     AliMultiplicityCorrection(const AliMultiplicityCorrection&);
     AliMultiplicityCorrection& operator=(const AliMultiplicityCorrection&);
 
-  ClassDef(AliMultiplicityCorrection, 7);
+  ClassDef(AliMultiplicityCorrection, 8);
 };
 
 #endif
@@ -41,7 +41,9 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFuseTrackLoops(kFALSE),
+           fFused(NULL)
 {
 // Dummy constructor
 }
@@ -58,7 +60,9 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFuseTrackLoops(kFALSE),
+           fFused(NULL)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +76,7 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fFused;
 }
 
 //______________________________________________________________________________
@@ -172,7 +177,24 @@ void AliTender::UserExec(Option_t* option)
   }
   TIter next(fSupplies);
   AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  if (!fFuseTrackLoops) {
+    while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  } else {
+    // Supplies with per-track processing are collected after their pre-hook
+    // and their tracks are corrected in one loop, until a supply which needs
+    // the corrected tracks comes.
+    if (!fFused) fFused = new TObjArray();
+    while ((supply=(AliTenderSupply*)next())) {
+      if (!supply->HasTrackProcessing()) {
+        ProcessFusedTracks();
+        supply->ProcessEvent();
+        continue;
+      }
+      if (supply->TrackDependentPreProcess()) ProcessFusedTracks();
+      if (supply->PreProcessEvent()) fFused->Add(supply);
+    }
+    ProcessFusedTracks();
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -181,6 +203,21 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::ProcessFusedTracks()
+{
+// Single loop over the tracks for the collected supplies, then their post-hooks.
+  Int_t nfused = fFused->GetEntriesFast();
+  if (!nfused) return;
+  Int_t ntracks = fESD->GetNumberOfTracks();
+  for (Int_t itrack=0; itrack<ntracks; itrack++) {
+    AliESDtrack *track = fESD->GetTrack(itrack);
+    for (Int_t is=0; is<nfused; is++) ((AliTenderSupply*)fFused->UncheckedAt(is))->ProcessTrack(track);
+  }
+  for (Int_t is=0; is<nfused; is++) ((AliTenderSupply*)fFused->UncheckedAt(is))->PostProcessEvent();
+  fFused->Clear();
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
@@ -43,9 +43,12 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Bool_t                    fFuseTrackLoops; // Visit the tracks once for all supplies with per-track processing
+  TObjArray                *fFused;          //! Supplies waiting for the fused track loop
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
+  void                      ProcessFusedTracks();
 
 public:  
   AliTender();
@@ -68,6 +71,12 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Apply the per-track corrections of all supplies implementing
+   * AliTenderSupply::ProcessTrack() in a single loop over the tracks,
+   * in the order of the supplies (default: false)
+   */
+  void                      SetFuseTrackLoops(Bool_t flag=kTRUE) {fFuseTrackLoops = flag;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +84,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
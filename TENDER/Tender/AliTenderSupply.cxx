@@ -17,6 +17,7 @@
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
+#include "AliESDEvent.h"
 
 ClassImp(AliTenderSupply)
 
@@ -60,3 +61,15 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    fTender = other.fTender;
    return *this;
 }
+
+//______________________________________________________________________________
+void AliTenderSupply::ProcessEventByTrack()
+{
+// Standalone processing of one event by a supply implementing the per-track
+// interface: same sequence as in the fused track loop of the tender.
+   if (!PreProcessEvent()) return;
+   AliESDEvent *event = fTender->GetEvent();
+   Int_t ntracks = event->GetNumberOfTracks();
+   for (Int_t itrack=0; itrack<ntracks; itrack++) ProcessTrack(event->GetTrack(itrack));
+   PostProcessEvent();
+}
@@ -15,6 +15,7 @@
 #endif
 
 class AliTender;
+class AliESDtrack;
 
 class AliTenderSupply : public TNamed {
 
@@ -31,8 +32,24 @@ public:
   // Run control
   virtual void              Init() = 0;
   virtual void              ProcessEvent() = 0;
+
+  // Optional per-track interface, used by AliTender::SetFuseTrackLoops().
+  // A supply implementing it splits its work into an event-level pre-hook,
+  // a correction of a single track and an event-level post-hook.
+  // PreProcessEvent() returns kFALSE if no track should be processed in this
+  // event. The hooks must not use track data, unless TrackDependentPreProcess()
+  // says so: the tender then finishes the track loop of the preceding
+  // supplies before calling the pre-hook.
+  virtual Bool_t            HasTrackProcessing() const {return kFALSE;}
+  virtual Bool_t            TrackDependentPreProcess() const {return kFALSE;}
+  virtual Bool_t            PreProcessEvent() {return kTRUE;}
+  virtual void              ProcessTrack(AliESDtrack * /*track*/) {}
+  virtual void              PostProcessEvent() {}
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+
+protected:
+  void                      ProcessEventByTrack();
     
   ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
 };
@@ -33,7 +33,8 @@ ClassImp(AliPIDTenderSupply)
 
 AliPIDTenderSupply::AliPIDTenderSupply() :
   AliTenderSupply(),
-  fCachePID(kFALSE)
+  fCachePID(kFALSE),
+  fESDpid(0x0)
 {
   //
   // default ctor
@@ -43,7 +44,8 @@ AliPIDTenderSupply::AliPIDTenderSupply() :
 //_____________________________________________________
 AliPIDTenderSupply::AliPIDTenderSupply(const char *name, const AliTender *tender) :
   AliTenderSupply(name,tender),
-  fCachePID(kFALSE)
+  fCachePID(kFALSE),
+  fESDpid(0x0)
 {
   //
   // named ctor
@@ -51,27 +53,29 @@ AliPIDTenderSupply::AliPIDTenderSupply(const char *name, const AliTender *tender
 }
 
 //_____________________________________________________
-void AliPIDTenderSupply::ProcessEvent()
+Bool_t AliPIDTenderSupply::PreProcessEvent()
 {
   //
-  // Combine PID information
+  // Get the PID object, fill the PID cache
   //
 
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  if (!event) return kFALSE;
 
-  AliESDpid *pid=fTender->GetESDhandler()->GetESDpid();
-  if (!pid) return;
+  fESDpid=fTender->GetESDhandler()->GetESDpid();
+  if (!fESDpid) return kFALSE;
   // chache pid if requested
   if (fCachePID) {
-    pid->FillTrackDetectorPID();
+    fESDpid->FillTrackDetectorPID();
   }
-  
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliPIDTenderSupply::ProcessTrack(AliESDtrack *track)
+{
   //
   // recalculate combined PID probabilities
   //
-  Int_t ntracks=event->GetNumberOfTracks();
-  for(Int_t itrack = 0; itrack < ntracks; itrack++)
-    pid->CombinePID(event->GetTrack(itrack));
-  
+  fESDpid->CombinePID(track);
 }
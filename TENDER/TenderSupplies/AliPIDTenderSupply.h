@@ -14,6 +14,8 @@
 
 #include <AliTenderSupply.h>
 
+class AliESDpid;
+
 class AliPIDTenderSupply: public AliTenderSupply {
   
 public:
@@ -23,16 +25,23 @@ public:
   virtual ~AliPIDTenderSupply(){;}
   
   virtual void              Init(){;}
-  virtual void              ProcessEvent();
+  virtual void              ProcessEvent() {ProcessEventByTrack();}
+
+  // Per-track interface, the PID cache needs the final tracks
+  virtual Bool_t            HasTrackProcessing() const {return kTRUE;}
+  virtual Bool_t            TrackDependentPreProcess() const {return fCachePID;}
+  virtual Bool_t            PreProcessEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
 
   void SetCachePID(Bool_t cachePID) { fCachePID=cachePID; }
 private:
   Bool_t fCachePID;                    // Cache PID values in transient object
+  AliESDpid *fESDpid;                  //! PID object of the current event
   
   AliPIDTenderSupply(const AliPIDTenderSupply&c);
   AliPIDTenderSupply& operator= (const AliPIDTenderSupply&c);
   
-  ClassDef(AliPIDTenderSupply, 2);  // PID tender task
+  ClassDef(AliPIDTenderSupply, 3);  // PID tender task
 };
 
 
@@ -299,16 +299,17 @@ void AliTOFTenderSupply::Init()
 }
 
 //_____________________________________________________
-void AliTOFTenderSupply::ProcessEvent()
+Bool_t AliTOFTenderSupply::PreProcessEvent()
 {
   //
-  // Use updated calibrations for TOF and T0, reapply PID information
+  // Use updated calibrations for TOF and T0, the PID information is
+  // reapplied track by track in ProcessTrack
   // For MC: timeZero sampling and additional smearing for T0
 
   if (fDebugLevel > 1) AliInfo("process event");
 
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  if (!event) return kFALSE;
   if (fDebugLevel > 1) AliInfo("event read");
 
 
@@ -317,7 +318,7 @@ void AliTOFTenderSupply::ProcessEvent()
 
     Init();
 
-    if (fTenderNoAction) return;            
+    if (fTenderNoAction) return kFALSE;
     Int_t versionNumber = GetOCDBVersion(fTender->GetRun());
     fTOFCalib->SetRunParamsSpecificVersion(versionNumber);
     fTOFCalib->Init(fTender->GetRun());
@@ -346,14 +347,22 @@ void AliTOFTenderSupply::ProcessEvent()
     }
   }
 
-  if (fTenderNoAction) return;
+  if (fTenderNoAction) return kFALSE;
 
   fTOFCalib->CalibrateESD(event);   //recalculate TOF signal (no harm for MC, see settings inside init)
 
 
-  // patches for various reconstruction bugs
-  if (fLHC10dPatch && !(fIsMC)) RecomputeTExp(event);   // LHC10d pass2: fake full TRD geometry
-  if ( (fCorrectTRDBug && !(fIsMC)) || (fForceCorrectTRDBug)) FixTRDBug(event);     // LHC10b,c pass3: wrong TRD dE/dx 
+  // patches for various reconstruction bugs, done in a single pass over the tracks
+  Bool_t recomputeTExp = fLHC10dPatch && !(fIsMC);                              // LHC10d pass2: fake full TRD geometry
+  Bool_t fixTRDBug = (fCorrectTRDBug && !(fIsMC)) || (fForceCorrectTRDBug);     // LHC10b,c pass3: wrong TRD dE/dx 
+  if (recomputeTExp || fixTRDBug) {
+    if (fixTRDBug && fGeomSet == kFALSE) InitGeom();
+    for (Int_t itrk = 0; itrk < event->GetNumberOfTracks(); itrk++) {
+      AliESDtrack *track = event->GetTrack(itrk);
+      if (recomputeTExp) RecomputeTExp(track);
+      if (fixTRDBug) FixTRDBug(track);
+    }
+  }
 
   Double_t startTime = 0.;
   if (fIsMC) startTime = fTOFCalib->TuneForMC(event,fTOFPIDParams->GetTOFresolution());   // this is for old MC when we didn't jitter startTime in MC
@@ -434,19 +443,15 @@ void AliTOFTenderSupply::ProcessEvent()
   //  set preferred startTime: this is now done via AliPIDResponseTask
   fESDpid->SetTOFResponse(event, (AliESDpid::EStartTimeType_t)fTOFPIDParams->GetStartTimeMethod());
 
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliTOFTenderSupply::ProcessTrack(AliESDtrack *track)
+{
   // recalculate PID probabilities
   // this is for safety, especially if the user doesn't attach a PID tender after TOF tender  
-  Int_t ntracks=event->GetNumberOfTracks();
-  //  AliESDtrack *track = NULL;
-  //  Float_t tzeroTrack = 0;
-  for(Int_t itrack = 0; itrack < ntracks; itrack++){
-    //    track = event->GetTrack(itrack);
-    //    tzeroTrack = fESDpid->GetTOFResponse().GetStartTime(track->P());
-    //    Printf("================> Track # %d mom: %f tzeroTrack %f",itrack,track->P(),tzeroTrack);
-    fESDpid->MakeTOFPID(event->GetTrack(itrack),0);   
-  }
-  
-  
+  fESDpid->MakeTOFPID(track,0);   
 }
 
 
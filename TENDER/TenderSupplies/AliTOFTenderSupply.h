@@ -28,7 +28,14 @@ public:
   virtual ~AliTOFTenderSupply(){;}
 
   virtual void              Init();
-  virtual void              ProcessEvent();
+  virtual void              ProcessEvent() {ProcessEventByTrack();}
+
+  // Per-track interface: calibration and T0 need all tracks, only the
+  // final TOF PID is done track by track
+  virtual Bool_t            HasTrackProcessing() const {return kTRUE;}
+  virtual Bool_t            TrackDependentPreProcess() const {return kTRUE;}
+  virtual Bool_t            PreProcessEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
 
   // TOF tender methods
   void SetIsMC(Bool_t flag=kFALSE){fIsMC=flag;}
@@ -21,6 +21,7 @@ class AliGRPObject;
 class TGraphErrors;
 class AliAnalysisManager;
 class TF1;
+class AliESDtrack;
 
 class AliTPCTenderSupply: public AliTenderSupply {
   
@@ -41,7 +42,12 @@ public:
   void AddSpecificStorage(const char* cdbPath, const char* storage);
 
   virtual void              Init();
-  virtual void              ProcessEvent();
+  virtual void              ProcessEvent() {ProcessEventByTrack();}
+
+  // Per-track interface
+  virtual Bool_t            HasTrackProcessing() const {return kTRUE;}
+  virtual Bool_t            PreProcessEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
   
 private:
   AliESDpid          *fESDpid;         //! ESD pid object
@@ -69,6 +75,10 @@ private:
   TString fMCperiod;                 //! corresponding MC period to use for the splines
   Int_t   fRecoPass;                 //! reconstruction pass
 
+  Double_t fCorrFactor;              //! gain correction factor of the current event
+  Double_t fCorrAttachSlope;         //! attachment correction slope of the current event
+  Double_t fCorrGainMultiplicityPbPb;//! multiplicity correction of the current event
+
   void SetSplines();
   Double_t GetGainCorrection();
 
@@ -82,7 +92,7 @@ private:
   AliTPCTenderSupply(const AliTPCTenderSupply&c);
   AliTPCTenderSupply& operator= (const AliTPCTenderSupply&c);
   
-  ClassDef(AliTPCTenderSupply, 2);  // TPC tender task
+  ClassDef(AliTPCTenderSupply, 3);  // TPC tender task
 };
 
 
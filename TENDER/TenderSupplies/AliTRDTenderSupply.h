@@ -44,7 +44,13 @@ public:
   void SetRedoTRDMatching(Bool_t redo = kTRUE) {fRedoTrdMatching = redo;}
 
   virtual void              Init();
-  virtual void              ProcessEvent();
+  virtual void              ProcessEvent() {ProcessEventByTrack();}
+
+  // Per-track interface, the online track matching needs the final tracks
+  virtual Bool_t            HasTrackProcessing() const {return kTRUE;}
+  virtual Bool_t            TrackDependentPreProcess() const {return fRedoTrdMatching;}
+  virtual Bool_t            PreProcessEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
   
   void SwitchOnGainCorrection() { fGainCorrection = kTRUE; }
   void SwitchOffGainCorrection() { fGainCorrection = kFALSE; }
@@ -30,9 +30,14 @@ public:
   AliTrackFixTenderSupply();
   AliTrackFixTenderSupply(const char *name, const AliTender *tender=NULL);
   virtual ~AliTrackFixTenderSupply();
-  virtual  void ProcessEvent();
+  virtual  void ProcessEvent() {ProcessEventByTrack();}
   virtual  void Init() {}
   //
+  // per-track interface
+  virtual  Bool_t HasTrackProcessing() const {return kTRUE;}
+  virtual  Bool_t PreProcessEvent();
+  virtual  void   ProcessTrack(AliESDtrack* trc);
+  //
   Double_t GetSideAFraction(const AliESDtrack* track) const;
   void     CorrectTrackPtInv(AliExternalTrackParam* trc, int mode, double sideAfraction, double phi) const;
   Bool_t   GetRunCorrections(int run);
@@ -57,8 +62,10 @@ private:
   TString           fOADBObjPath;            // path of file with parameters to use, starting from OADB dir
   TString           fOADBObjName;            // name of the corrections object in the OADB container
   AliOADBContainer* fOADBCont;               // OADB container with parameters collection
+  const AliESDVertex* fVtx;                  //! vertex for RelateToVertex in current event
+  const AliESDVertex* fVtxTPC;               //! vertex for RelateToVertexTPC in current event
   //
-  ClassDef(AliTrackFixTenderSupply, 1);  // track fixing tender task 
+  ClassDef(AliTrackFixTenderSupply, 2);  // track fixing tender task 
 };
 
 